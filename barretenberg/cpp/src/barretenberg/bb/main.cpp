@@ -109,15 +109,24 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
  * @param witnessPath Path to the file containing the serialized witness
  * @param recursive Whether to use recursive proof generation of non-recursive
  * @param outputPath Path to write the proof to
+ * @param pkPath Path to a proving key written by `write_pk --mmap`, which is mapped rather than computed (optional)
  */
 void prove(const std::string& bytecodePath,
            const std::string& witnessPath,
            bool recursive,
-           const std::string& outputPath)
+           const std::string& outputPath,
+           const std::string& pkPath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     auto witness = get_witness(witnessPath);
     auto acir_composer = init(constraint_system);
+    if (!pkPath.empty()) {
+        plonk::proving_key_data pk_data;
+        sha256::hash circuit_hash;
+        plonk::read_mmap(pkPath, pk_data, circuit_hash);
+        acir_composer.load_proving_key(std::move(pk_data), circuit_hash);
+        vinfo("pk mapped from: ", pkPath);
+    }
     auto proof = acir_composer.create_proof(constraint_system, witness, recursive);
 
     if (outputPath == "-") {
@@ -200,13 +209,38 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
     }
 }
 
-void write_pk(const std::string& bytecodePath, const std::string& outputPath)
+/**
+ * @brief Writes a proving key for an ACIR circuit to a file
+ *
+ * Communication:
+ * - stdout: The proving key is written to stdout as a byte array
+ * - Filesystem: The proving key is written to the path specified by outputPath
+ *
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @param outputPath Path to write the proving key to
+ * @param mmap Whether to write the memory-mapped format read by `prove --pk`, rather than the serialized format that
+ * bb.js also writes
+ */
+void write_pk(const std::string& bytecodePath, const std::string& outputPath, bool mmap)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     auto acir_composer = init(constraint_system);
     auto pk = acir_composer.init_proving_key(constraint_system);
-    auto serialized_pk = to_buffer(*pk);
 
+    if (mmap) {
+        const auto circuit_hash = acir_composer.get_circuit_hash();
+        if (outputPath == "-") {
+            plonk::write_mmap(std::cout, *pk, circuit_hash);
+            vinfo("pk written to stdout");
+        } else {
+            std::ofstream os(outputPath, std::ios::binary);
+            plonk::write_mmap(os, *pk, circuit_hash);
+            vinfo("pk written to: ", outputPath);
+        }
+        return;
+    }
+
+    auto serialized_pk = to_buffer(*pk);
     if (outputPath == "-") {
         writeRawBytesToStdout(serialized_pk);
         vinfo("pk written to stdout");
@@ -380,7 +414,7 @@ int main(int argc, char* argv[])
         std::string witness_path = get_option(args, "-w", "./target/witness.gz");
         std::string proof_path = get_option(args, "-p", "./proofs/proof");
         std::string vk_path = get_option(args, "-k", "./target/vk");
-        std::string pk_path = get_option(args, "-r", "./target/pk");
+        std::string pk_path = get_option(args, "--pk", "");
         CRS_PATH = get_option(args, "-c", "./crs");
         bool recursive = flag_present(args, "-r") || flag_present(args, "--recursive");
 
@@ -400,7 +434,7 @@ int main(int argc, char* argv[])
         }
         if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
-            prove(bytecode_path, witness_path, recursive, output_path);
+            prove(bytecode_path, witness_path, recursive, output_path, pk_path);
         } else if (command == "gates") {
             gateCount(bytecode_path);
         } else if (command == "verify") {
@@ -413,7 +447,7 @@ int main(int argc, char* argv[])
             write_vk(bytecode_path, output_path);
         } else if (command == "write_pk") {
             std::string output_path = get_option(args, "-o", "./target/pk");
-            write_pk(bytecode_path, output_path);
+            write_pk(bytecode_path, output_path, flag_present(args, "--mmap"));
         } else if (command == "proof_as_fields") {
             std::string output_path = get_option(args, "-o", proof_path + "_fields.json");
             proof_as_fields(proof_path, vk_path, output_path);
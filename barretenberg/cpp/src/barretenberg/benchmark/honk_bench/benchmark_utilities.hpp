@@ -135,17 +135,19 @@ template <typename Builder> void generate_ecdsa_verification_test_circuit(Builde
 /**
  * @brief Generate test circuit with specified number of merkle membership checks
  *
+ * @tparam HashingPolicy hash used by the tree and by the membership checks
  * @param builder
  * @param num_iterations
  */
-template <typename Builder> void generate_merkle_membership_test_circuit(Builder& builder, size_t num_iterations)
+template <typename Builder,
+          typename HashingPolicy = proof_system::plonk::stdlib::merkle_tree::PedersenHashPolicy>
+void generate_merkle_membership_test_circuit(Builder& builder, size_t num_iterations)
 {
     using namespace proof_system::plonk::stdlib;
     using field_ct = field_t<Builder>;
     using witness_ct = witness_t<Builder>;
-    using witness_ct = witness_t<Builder>;
     using MemStore = merkle_tree::MemoryStore;
-    using MerkleTree_ct = merkle_tree::MerkleTree<MemStore>;
+    using MerkleTree_ct = merkle_tree::MerkleTree<MemStore, HashingPolicy>;
 
     MemStore store;
     const size_t tree_depth = 7;
@@ -161,7 +163,7 @@ template <typename Builder> void generate_merkle_membership_test_circuit(Builder
         auto idx_ct = field_ct(witness_ct(&builder, fr(idx))).decompose_into_bits();
         auto value_ct = field_ct(value);
 
-        merkle_tree::check_membership(
+        merkle_tree::check_membership<Builder, HashingPolicy>(
             root_ct, merkle_tree::create_witness_hash_path(builder, merkle_tree.get_hash_path(idx)), value_ct, idx_ct);
     }
 }
@@ -178,6 +180,18 @@ inline proof_system::honk::UltraProver get_prover(
     return composer.create_prover(instance);
 }
 
+// goblin ultrahonk
+inline proof_system::honk::GoblinUltraProver get_prover(
+    proof_system::honk::GoblinUltraComposer& composer,
+    void (*test_circuit_function)(proof_system::honk::GoblinUltraComposer::CircuitBuilder&, size_t),
+    size_t num_iterations)
+{
+    proof_system::honk::GoblinUltraComposer::CircuitBuilder builder;
+    test_circuit_function(builder, num_iterations);
+    std::shared_ptr<proof_system::honk::GoblinUltraComposer::Instance> instance = composer.create_instance(builder);
+    return composer.create_prover(instance);
+}
+
 // standard plonk
 inline proof_system::plonk::Prover get_prover(proof_system::plonk::StandardComposer& composer,
                                               void (*test_circuit_function)(proof_system::StandardCircuitBuilder&,
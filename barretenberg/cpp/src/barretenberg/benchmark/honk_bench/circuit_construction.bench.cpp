@@ -0,0 +1,83 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+
+#include "barretenberg/benchmark/honk_bench/benchmark_utilities.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+
+using namespace benchmark;
+using namespace proof_system;
+
+namespace {
+// Counts every heap allocation made by this executable, so that the benchmarks can report allocations per circuit
+std::atomic<size_t> allocation_count{ 0 };
+} // namespace
+
+// GCC flags the malloc/free pairing once the replacement operators are inlined into their callers
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*unused*/) noexcept
+{
+    std::free(ptr);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * @brief Benchmark: Construction of an Ultra circuit determined by the provided circuit function. Only the circuit
+ * builder is measured; no proving key is constructed. The number of heap allocations per circuit is reported as a
+ * counter.
+ */
+static void construct_circuit_ultra(State& state, void (*test_circuit_function)(UltraCircuitBuilder&, size_t)) noexcept
+{
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    size_t num_allocations = 0;
+    size_t num_gates = 0;
+    for (auto _ : state) {
+        const size_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+        UltraCircuitBuilder builder;
+        test_circuit_function(builder, num_iterations);
+        num_allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+        num_gates = builder.get_num_gates();
+
+        // Don't include the destruction of the builder in the measurement
+        state.PauseTiming();
+        builder = UltraCircuitBuilder();
+        state.ResumeTiming();
+    }
+    state.counters["gates"] = static_cast<double>(num_gates);
+    state.counters["allocations"] = static_cast<double>(num_allocations);
+}
+
+BENCHMARK_CAPTURE(construct_circuit_ultra, sha256, &bench_utils::generate_sha256_test_circuit<UltraCircuitBuilder>)
+    ->Arg(1)
+    ->Arg(10)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_circuit_ultra, keccak, &bench_utils::generate_keccak_test_circuit<UltraCircuitBuilder>)
+    ->Arg(1)
+    ->Arg(10)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_circuit_ultra,
+                  ecdsa_verification,
+                  &bench_utils::generate_ecdsa_verification_test_circuit<UltraCircuitBuilder>)
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(kMillisecond);
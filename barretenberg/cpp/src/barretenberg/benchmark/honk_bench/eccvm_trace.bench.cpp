@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/flavor/ecc_vm.hpp"
+#include "barretenberg/proof_system/circuit_builder/eccvm/eccvm_circuit_builder.hpp"
+
+using namespace benchmark;
+
+namespace {
+using Flavor = proof_system::honk::flavor::ECCVM;
+using Builder = proof_system::ECCVMCircuitBuilder<Flavor>;
+using G1 = Flavor::CycleGroup;
+using Fr = G1::Fr;
+
+auto& engine = numeric::random::get_debug_engine();
+
+/**
+ * @brief An op queue of the given number of scalar multiplications, batched into MSMs of 4 points, each followed by an
+ * addition as the Goblin ECC op queue produces
+ */
+Builder generate_ecc_ops(const size_t num_muls)
+{
+    static constexpr size_t MSM_SIZE = 4;
+    Builder builder;
+    const auto generators = G1::derive_generators("eccvm trace bench", MSM_SIZE + 1);
+    for (size_t i = 0; i < num_muls; ++i) {
+        builder.mul_accumulate(generators[i % MSM_SIZE], Fr::random_element(&engine));
+        if (i % MSM_SIZE == MSM_SIZE - 1) {
+            builder.add_accumulate(generators[MSM_SIZE]);
+        }
+    }
+    return builder;
+}
+} // namespace
+
+/**
+ * @brief Benchmark: Generation of the ECCVM trace polynomials from an op queue of 2**n scalar multiplications
+ */
+static void generate_eccvm_trace(State& state) noexcept
+{
+    auto builder = generate_ecc_ops(1UL << static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto polynomials = builder.compute_polynomials();
+        DoNotOptimize(polynomials);
+    }
+    state.counters["rows"] = static_cast<double>(builder.get_num_gates());
+}
+
+BENCHMARK(generate_eccvm_trace)->DenseRange(8, 12, 2)->Unit(kMillisecond);
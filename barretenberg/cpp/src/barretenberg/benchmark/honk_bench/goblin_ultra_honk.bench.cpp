@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/honk_bench/benchmark_utilities.hpp"
+#include "barretenberg/proof_system/circuit_builder/goblin_ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_composer.hpp"
+
+using namespace benchmark;
+using namespace proof_system;
+
+namespace {
+using PedersenHashPolicy = plonk::stdlib::merkle_tree::PedersenHashPolicy;
+using Poseidon2HashPolicy = plonk::stdlib::merkle_tree::Poseidon2HashPolicy;
+} // namespace
+
+/**
+ * @brief Benchmark: Construction of a GoblinUltra circuit determined by the provided circuit function. The number of
+ * gates of the circuit is reported as a counter.
+ */
+static void construct_circuit_goblin_ultra(State& state,
+                                           void (*test_circuit_function)(GoblinUltraCircuitBuilder&, size_t)) noexcept
+{
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    size_t num_gates = 0;
+    for (auto _ : state) {
+        GoblinUltraCircuitBuilder builder;
+        test_circuit_function(builder, num_iterations);
+        num_gates = builder.get_num_gates();
+    }
+    state.counters["gates"] = static_cast<double>(num_gates);
+}
+
+/**
+ * @brief Benchmark: Construction of a GoblinUltra Honk proof for a circuit determined by the provided circuit function
+ */
+static void construct_proof_goblin_ultrahonk(State& state,
+                                             void (*test_circuit_function)(GoblinUltraCircuitBuilder&, size_t)) noexcept
+{
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    bench_utils::construct_proof_with_specified_num_iterations<honk::GoblinUltraComposer>(
+        state, test_circuit_function, num_iterations);
+}
+
+// Merkle membership checks hashing with Pedersen, which costs a few hundred gates per hash, or with Poseidon2, whose
+// permutation is a handful of rows using the Poseidon2 round gates
+BENCHMARK_CAPTURE(construct_circuit_goblin_ultra,
+                  merkle_membership_pedersen,
+                  &bench_utils::generate_merkle_membership_test_circuit<GoblinUltraCircuitBuilder, PedersenHashPolicy>)
+    ->Arg(1)
+    ->Arg(10)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_circuit_goblin_ultra,
+                  merkle_membership_poseidon2,
+                  &bench_utils::generate_merkle_membership_test_circuit<GoblinUltraCircuitBuilder, Poseidon2HashPolicy>)
+    ->Arg(1)
+    ->Arg(10)
+    ->Unit(kMillisecond);
+
+BENCHMARK_CAPTURE(construct_proof_goblin_ultrahonk,
+                  merkle_membership_pedersen,
+                  &bench_utils::generate_merkle_membership_test_circuit<GoblinUltraCircuitBuilder, PedersenHashPolicy>)
+    ->Arg(10)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_goblin_ultrahonk,
+                  merkle_membership_poseidon2,
+                  &bench_utils::generate_merkle_membership_test_circuit<GoblinUltraCircuitBuilder, Poseidon2HashPolicy>)
+    ->Arg(10)
+    ->Unit(kMillisecond);
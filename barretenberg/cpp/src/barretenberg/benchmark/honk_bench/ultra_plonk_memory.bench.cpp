@@ -0,0 +1,84 @@
+#include <fstream>
+#include <malloc.h>
+#include <string>
+
+#include "barretenberg/benchmark/honk_bench/benchmark_utilities.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+
+using namespace benchmark;
+using namespace proof_system;
+
+namespace {
+
+/**
+ * @brief Resets the peak resident set size of the process (VmHWM) to its current resident set size (Linux only)
+ */
+void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+/**
+ * @brief The peak resident set size of the process in MiB since the last reset, or 0 if it can't be read
+ */
+double peak_rss_mib()
+{
+    std::ifstream status("/proc/self/status");
+    std::string field;
+    while (status >> field) {
+        if (field == "VmHWM:") {
+            size_t kib = 0;
+            status >> kib;
+            return static_cast<double>(kib) / 1024;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+/**
+ * @brief Benchmark: Construction of an Ultra Plonk proof with 2**n gates, with the proving key's polynomial store
+ * holding at most the given number of polynomials in memory (0 for no limit) and swapping the rest out to a file.
+ * Reports the peak resident memory while proving, and the peak allocated through aligned_alloc as recorded by the
+ * prover's memory report, alongside the proof time.
+ */
+static void construct_proof_ultraplonk_polynomial_cache(State& state) noexcept
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    // Fix glibc's mmap threshold, which otherwise grows to the size of the polynomials once some are freed, so that
+    // polynomials that are swapped out are given back to the system rather than kept on the heap
+    mallopt(M_MMAP_THRESHOLD, 1 << 20);
+    const auto max_cache_size = static_cast<size_t>(state.range(0));
+    const auto log2_of_gates = static_cast<size_t>(state.range(1));
+
+    double peak_rss = 0;
+    double peak_allocated = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        plonk::UltraComposer composer;
+        auto prover = bench_utils::get_prover(
+            composer, &bench_utils::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, log2_of_gates);
+        if (max_cache_size > 0) {
+            prover.key->polynomial_store.set_max_cache_size(max_cache_size);
+        }
+        reset_peak_rss();
+        state.ResumeTiming();
+
+        auto proof = prover.construct_proof();
+
+        state.PauseTiming();
+        peak_rss = std::max(peak_rss, peak_rss_mib());
+        peak_allocated =
+            std::max(peak_allocated, static_cast<double>(prover.memory_report.get_peak_bytes()) / (1024 * 1024));
+        state.ResumeTiming();
+    }
+    state.counters["peak_rss_mib"] = peak_rss;
+    state.counters["peak_allocated_mib"] = peak_allocated;
+}
+
+BENCHMARK(construct_proof_ultraplonk_polynomial_cache)
+    // No limit, then 64, 32 and 16 polynomials in memory, for 2**16 and 2**18 gates
+    ->ArgsProduct({ { 0, 64, 32, 16 }, { 16, 18 } })
+    ->Unit(kMillisecond);
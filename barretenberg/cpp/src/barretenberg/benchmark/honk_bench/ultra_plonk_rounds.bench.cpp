@@ -1,4 +1,5 @@
 #include <benchmark/benchmark.h>
+#include <chrono>
 
 #include "barretenberg/benchmark/honk_bench/benchmark_utilities.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
@@ -17,16 +18,27 @@ enum {
     SIXTH_BATCH_OPEN
 };
 
-BBERG_PROFILE static void plonk_round(
-    State& state, plonk::UltraProver& prover, size_t target_index, size_t index, auto&& func) noexcept
+/**
+ * @details Runs a round and then its queued work (FFTs and commitments). For the measured round, the time spent
+ * processing the work queue is added to `queue_time_ms`, so that it can be told apart from the round's own work.
+ */
+BBERG_PROFILE static void plonk_round(State& state,
+                                      plonk::UltraProver& prover,
+                                      size_t target_index,
+                                      size_t index,
+                                      double& queue_time_ms,
+                                      auto&& func) noexcept
 {
     if (index == target_index) {
         state.ResumeTiming();
     }
     func();
+    const auto queue_start = std::chrono::steady_clock::now();
     prover.queue.process_queue();
     if (index == target_index) {
         state.PauseTiming();
+        queue_time_ms +=
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - queue_start).count();
     }
 }
 /**
@@ -36,30 +48,39 @@ BBERG_PROFILE static void plonk_round(
  * @param state - The google benchmark state.
  * @param prover - The ultraplonk prover.
  * @param index - The pass to measure.
+ * @param queue_time_ms - Accumulates the time spent processing the work queue in the measured pass.
  **/
-BBERG_PROFILE static void test_round_inner(State& state, plonk::UltraProver& prover, size_t index) noexcept
+BBERG_PROFILE static void test_round_inner(State& state,
+                                           plonk::UltraProver& prover,
+                                           size_t index,
+                                           double& queue_time_ms) noexcept
 {
-    plonk_round(state, prover, PREAMBLE, index, [&] { prover.execute_preamble_round(); });
-    plonk_round(state, prover, FIRST_WIRE_COMMITMENTS, index, [&] { prover.execute_first_round(); });
-    plonk_round(state, prover, SECOND_FIAT_SHAMIR_ETA, index, [&] { prover.execute_second_round(); });
-    plonk_round(state, prover, THIRD_FIAT_SHAMIR_BETA_GAMMA, index, [&] { prover.execute_third_round(); });
-    plonk_round(state, prover, FOURTH_FIAT_SHAMIR_ALPHA_AND_COMMIT, index, [&] { prover.execute_fourth_round(); });
-    plonk_round(state, prover, FIFTH_COMPUTE_QUOTIENT_EVALUTION, index, [&] { prover.execute_fifth_round(); });
-    plonk_round(state, prover, SIXTH_BATCH_OPEN, index, [&] { prover.execute_sixth_round(); });
+    auto round = [&](size_t target_index, auto&& func) {
+        plonk_round(state, prover, target_index, index, queue_time_ms, func);
+    };
+    round(PREAMBLE, [&] { prover.execute_preamble_round(); });
+    round(FIRST_WIRE_COMMITMENTS, [&] { prover.execute_first_round(); });
+    round(SECOND_FIAT_SHAMIR_ETA, [&] { prover.execute_second_round(); });
+    round(THIRD_FIAT_SHAMIR_BETA_GAMMA, [&] { prover.execute_third_round(); });
+    round(FOURTH_FIAT_SHAMIR_ALPHA_AND_COMMIT, [&] { prover.execute_fourth_round(); });
+    round(FIFTH_COMPUTE_QUOTIENT_EVALUTION, [&] { prover.execute_fifth_round(); });
+    round(SIXTH_BATCH_OPEN, [&] { prover.execute_sixth_round(); });
 }
 BBERG_PROFILE static void test_round(State& state, size_t index) noexcept
 {
     barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    double queue_time_ms = 0;
     for (auto _ : state) {
         state.PauseTiming();
         plonk::UltraComposer composer;
         // TODO: https://github.com/AztecProtocol/barretenberg/issues/761 benchmark both sparse and dense circuits
         plonk::UltraProver prover = bench_utils::get_prover(
             composer, &bench_utils::generate_ecdsa_verification_test_circuit<UltraCircuitBuilder>, 10);
-        test_round_inner(state, prover, index);
+        test_round_inner(state, prover, index, queue_time_ms);
         // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
         state.ResumeTiming();
     }
+    state.counters["queue_time_ms"] = Counter(queue_time_ms, Counter::kAvgIterations);
 }
 #define ROUND_BENCHMARK(round)                                                                                         \
     static void ROUND_##round(State& state) noexcept                                                                   \
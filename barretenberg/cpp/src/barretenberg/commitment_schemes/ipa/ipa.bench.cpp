@@ -0,0 +1,178 @@
+#include "ipa.hpp"
+#include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/commitment_schemes/verification_key.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace proof_system::honk;
+using namespace proof_system::honk::pcs;
+
+namespace {
+using Curve = curve::Grumpkin;
+using Fr = Curve::ScalarField;
+using Polynomial = barretenberg::Polynomial<Fr>;
+
+constexpr size_t MIN_LOG_DEGREE = 10;
+constexpr size_t MAX_LOG_DEGREE = 16;
+
+// The keys are shared by all degrees, as the CRS factory only keeps the CRS of the last degree it was asked for
+std::shared_ptr<barretenberg::srs::factories::CrsFactory<Curve>> get_crs_factory()
+{
+    static std::shared_ptr<barretenberg::srs::factories::CrsFactory<Curve>> crs_factory(
+        new barretenberg::srs::factories::FileCrsFactory<Curve>("../srs_db/grumpkin", 1 << MAX_LOG_DEGREE));
+    return crs_factory;
+}
+
+std::shared_ptr<CommitmentKey<Curve>> get_ck()
+{
+    static auto ck = std::make_shared<CommitmentKey<Curve>>(1 << MAX_LOG_DEGREE, get_crs_factory());
+    return ck;
+}
+
+std::shared_ptr<VerifierCommitmentKey<Curve>> get_vk()
+{
+    static auto vk = std::make_shared<VerifierCommitmentKey<Curve>>(1 << MAX_LOG_DEGREE, get_crs_factory());
+    return vk;
+}
+
+/**
+ * @brief A random polynomial of degree `n - 1`, a random opening point and the polynomial's evaluation there
+ */
+std::pair<Polynomial, OpeningPair<Curve>> random_opening(const size_t n)
+{
+    Polynomial poly(n);
+    for (size_t i = 0; i < n; ++i) {
+        poly[i] = Fr::random_element();
+    }
+    const Fr challenge = Fr::random_element();
+    const OpeningPair<Curve> opening_pair{ challenge, poly.evaluate(challenge) };
+    return { std::move(poly), opening_pair };
+}
+
+/**
+ * @brief Baseline: the verifier before it built s_vec in O(n) and fused its MSMs. It builds s_vec with log(n)
+ * multiplications per entry, and computes the L/R terms and G_zero with separate MSMs.
+ */
+bool verify_baseline(const std::shared_ptr<VerifierCommitmentKey<Curve>>& vk,
+                     const OpeningClaim<Curve>& opening_claim,
+                     BaseTranscript<Fr>& transcript)
+{
+    using Commitment = Curve::AffineElement;
+    using GroupElement = Curve::Element;
+
+    auto poly_degree = static_cast<size_t>(transcript.receive_from_prover<uint64_t>("IPA:poly_degree"));
+    Fr generator_challenge = transcript.get_challenge("IPA:generator_challenge");
+    auto aux_generator = Commitment::one() * generator_challenge;
+
+    auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
+
+    // Compute C_prime
+    GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
+
+    // Compute C_zero = C_prime + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
+    auto pippenger_size = 2 * log_poly_degree;
+    std::vector<Fr> round_challenges(log_poly_degree);
+    std::vector<Fr> round_challenges_inv(log_poly_degree);
+    std::vector<Commitment> msm_elements(pippenger_size);
+    std::vector<Fr> msm_scalars(pippenger_size);
+    for (size_t i = 0; i < log_poly_degree; i++) {
+        std::string index = std::to_string(i);
+        auto element_L = transcript.receive_from_prover<Commitment>("IPA:L_" + index);
+        auto element_R = transcript.receive_from_prover<Commitment>("IPA:R_" + index);
+        round_challenges[i] = transcript.get_challenge("IPA:round_challenge_" + index);
+        round_challenges_inv[i] = round_challenges[i].invert();
+
+        msm_elements[2 * i] = element_L;
+        msm_elements[2 * i + 1] = element_R;
+        msm_scalars[2 * i] = round_challenges[i].sqr();
+        msm_scalars[2 * i + 1] = round_challenges_inv[i].sqr();
+    }
+    GroupElement LR_sums = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+        &msm_scalars[0], &msm_elements[0], pippenger_size, vk->pippenger_runtime_state);
+    GroupElement C_zero = C_prime + LR_sums;
+
+    /**
+     * Compute b_zero where b_zero can be computed using the polynomial:
+     *
+     * g(X) = ∏_{i ∈ [k]} (u_{k-i}^{-1} + u_{k-i}.X^{2^{i-1}}).
+     *
+     * b_zero = g(evaluation) = ∏_{i ∈ [k]} (u_{k-i}^{-1} + u_{k-i}. (evaluation)^{2^{i-1}})
+     */
+    Fr b_zero = Fr::one();
+    for (size_t i = 0; i < log_poly_degree; i++) {
+        auto exponent = static_cast<uint64_t>(Fr(2).pow(i));
+        b_zero *= round_challenges_inv[log_poly_degree - 1 - i] +
+                  (round_challenges[log_poly_degree - 1 - i] * opening_claim.opening_pair.challenge.pow(exponent));
+    }
+
+    // Compute G_zero
+    // First construct s_vec
+    std::vector<Fr> s_vec(poly_degree);
+    for (size_t i = 0; i < poly_degree; i++) {
+        Fr s_vec_scalar = Fr::one();
+        for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
+            auto bit = (i >> j) & 1;
+            bool b = static_cast<bool>(bit);
+            if (b) {
+                s_vec_scalar *= round_challenges[log_poly_degree - 1 - j];
+            } else {
+                s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
+            }
+        }
+        s_vec[i] = s_vec_scalar;
+    }
+    auto srs_elements = vk->srs->get_monomial_points();
+    // Copy the G_vector to local memory.
+    std::vector<Commitment> G_vec_local(poly_degree);
+    // The SRS stored in the commitment key is the result after applying the pippenger point table so the
+    // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
+    // G_vec_local should use only the original SRS thus we extract only the even indices.
+    for (size_t i = 0; i < poly_degree * 2; i += 2) {
+        G_vec_local[i >> 1] = srs_elements[i];
+    }
+    auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+        &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
+
+    auto a_zero = transcript.receive_from_prover<Fr>("IPA:a_0");
+
+    GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+
+    return (C_zero.normalize() == right_hand_side.normalize());
+}
+} // namespace
+
+void ipa_prove_bench(State& state) noexcept
+{
+    const auto [poly, opening_pair] = random_opening(static_cast<size_t>(1) << static_cast<size_t>(state.range(0)));
+    const auto ck = get_ck();
+    for (auto _ : state) {
+        BaseTranscript<Fr> transcript;
+        ipa::IPA<Curve>::compute_opening_proof(ck, opening_pair, poly, transcript);
+        DoNotOptimize(transcript.proof_data);
+    }
+}
+BENCHMARK(ipa_prove_bench)->DenseRange(MIN_LOG_DEGREE, MAX_LOG_DEGREE, 2)->Unit(kMillisecond);
+
+template <bool baseline> void ipa_verify_bench(State& state) noexcept
+{
+    const auto [poly, opening_pair] = random_opening(static_cast<size_t>(1) << static_cast<size_t>(state.range(0)));
+    const auto ck = get_ck();
+    const auto vk = get_vk();
+    const OpeningClaim<Curve> opening_claim{ opening_pair, ck->commit(poly) };
+    BaseTranscript<Fr> prover_transcript;
+    ipa::IPA<Curve>::compute_opening_proof(ck, opening_pair, poly, prover_transcript);
+    for (auto _ : state) {
+        BaseTranscript<Fr> transcript{ prover_transcript.proof_data };
+        const bool verified = baseline ? verify_baseline(vk, opening_claim, transcript)
+                                       : ipa::IPA<Curve>::verify(vk, opening_claim, transcript);
+        if (!verified) {
+            state.SkipWithError("IPA proof failed to verify");
+        }
+    }
+}
+BENCHMARK_TEMPLATE(ipa_verify_bench, true)->DenseRange(MIN_LOG_DEGREE, MAX_LOG_DEGREE, 2)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(ipa_verify_bench, false)->DenseRange(MIN_LOG_DEGREE, MAX_LOG_DEGREE, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
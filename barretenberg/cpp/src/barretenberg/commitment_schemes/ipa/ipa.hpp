@@ -2,10 +2,14 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <array>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -48,51 +52,58 @@ template <typename Curve> class IPA {
         ASSERT((poly_degree > 0) && (!(poly_degree & (poly_degree - 1))) &&
                "The poly_degree should be positive and a power of two");
 
+        // The vectors are folded in place. To fold the generators with one scalar multiplication each rather than two,
+        // G_vec_local holds the generators of the protocol divided by a common scale factor, which the prover corrects
+        // for by holding a_vec multiplied by that factor: every < a_vec, G_vec_local > is then unchanged, and the inner
+        // products with b_vec are multiplied by `a_vec_scale_inv`. With round challenge u, folding
+        //     G_vec_lo * u^{-1} + G_vec_hi * u = u^{-1} * (G_vec_lo + G_vec_hi * u^2)
+        // multiplies the scale factor by u^{-1}, and a_vec is folded as a_vec_lo + a_vec_hi * u^{-2} to match.
         auto a_vec = polynomial;
+        Fr a_vec_scale_inv = Fr::one();
         auto srs_elements = ck->srs->get_monomial_points();
         std::vector<Commitment> G_vec_local(poly_degree);
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
         // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
         // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
-        }
+        run_in_parallel(poly_degree, MIN_ITERATIONS_PER_THREAD, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                G_vec_local[i] = srs_elements[2 * i];
+            }
+        });
         std::vector<Fr> b_vec(poly_degree);
-        Fr b_power = 1;
-        for (size_t i = 0; i < poly_degree; i++) {
-            b_vec[i] = b_power;
-            b_power *= opening_pair.challenge;
-        }
+        run_in_parallel(poly_degree, MIN_ITERATIONS_PER_THREAD, [&](size_t start, size_t end) {
+            Fr b_power = opening_pair.challenge.pow(start);
+            for (size_t i = start; i < end; ++i) {
+                b_vec[i] = b_power;
+                b_power *= opening_pair.challenge;
+            }
+        });
+        // The pippenger point table of G_vec_local, rebuilt after every fold (which at least halves it). Before the
+        // first fold it is the SRS.
+        std::vector<Commitment> G_vec_table(poly_degree);
+        Commitment* G_table = srs_elements;
+
         // Iterate for log(poly_degree) rounds to compute the round commitments.
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
         std::vector<GroupElement> L_elements(log_poly_degree);
         std::vector<GroupElement> R_elements(log_poly_degree);
         std::size_t round_size = poly_degree;
 
-        // TODO(#479): restructure IPA so it can be integrated with the pthread alternative to work queue (or even the
-        // work queue itself). Investigate whether parallelising parts of each rounds of IPA rounds brings significant
-        // improvements and see if reducing the size of G_vec_local and b_vec by taking the first iteration out of the
-        // loop can also be integrated.
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
             // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
-            Fr inner_prod_L = Fr::zero();
-            Fr inner_prod_R = Fr::zero();
-            for (size_t j = 0; j < round_size; j++) {
-                inner_prod_L += a_vec[j] * b_vec[round_size + j];
-                inner_prod_R += a_vec[round_size + j] * b_vec[j];
-            }
+            auto [inner_prod_L, inner_prod_R] = compute_inner_products(a_vec, b_vec, round_size);
+            inner_prod_L *= a_vec_scale_inv;
+            inner_prod_R *= a_vec_scale_inv;
+
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] =
-                // TODO(#473)
-                barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                    &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
+            L_elements[i] = barretenberg::scalar_multiplication::pippenger<Curve>(
+                &a_vec[0], &G_table[2 * round_size], round_size, ck->pippenger_runtime_state, false);
             L_elements[i] += aux_generator * inner_prod_L;
 
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            // TODO(#473)
-            R_elements[i] = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
+            R_elements[i] = barretenberg::scalar_multiplication::pippenger<Curve>(
+                &a_vec[round_size], &G_table[0], round_size, ck->pippenger_runtime_state, false);
             R_elements[i] += aux_generator * inner_prod_R;
 
             std::string index = std::to_string(i);
@@ -103,28 +114,148 @@ template <typename Curve> class IPA {
             const Fr round_challenge = transcript.get_challenge("IPA:round_challenge_" + index);
             const Fr round_challenge_inv = round_challenge.invert();
 
-            std::vector<Commitment> G_lo(G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size));
-            std::vector<Commitment> G_hi(G_vec_local.begin() + static_cast<long>(round_size), G_vec_local.end());
-            G_lo = GroupElement::batch_mul_with_endomorphism(G_lo, round_challenge_inv);
-            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge);
-
-            // Update the vectors a_vec, b_vec and G_vec.
-            // a_vec_next = a_vec_lo * round_challenge + a_vec_hi * round_challenge_inv
+            // Update the vectors a_vec, b_vec and G_vec (see the comment on the scale factor above).
+            // a_vec_next = a_vec_lo + a_vec_hi * round_challenge_inv^2
             // b_vec_next = b_vec_lo * round_challenge_inv + b_vec_hi * round_challenge
-            // G_vec_next = G_vec_lo * round_challenge_inv + G_vec_hi * round_challenge
-            for (size_t j = 0; j < round_size; j++) {
-                a_vec[j] *= round_challenge;
-                a_vec[j] += round_challenge_inv * a_vec[round_size + j];
-                b_vec[j] *= round_challenge_inv;
-                b_vec[j] += round_challenge * b_vec[round_size + j];
-
-                G_vec_local[j] = G_lo[j] + G_hi[j];
+            // G_vec_next = G_vec_lo + G_vec_hi * round_challenge^2
+            const Fr round_challenge_inv_sqr = round_challenge_inv.sqr();
+            run_in_parallel(round_size, MIN_ITERATIONS_PER_THREAD, [&](size_t start, size_t end) {
+                for (size_t j = start; j < end; j++) {
+                    a_vec[j] += round_challenge_inv_sqr * a_vec[round_size + j];
+                    b_vec[j] *= round_challenge_inv;
+                    b_vec[j] += round_challenge * b_vec[round_size + j];
+                }
+            });
+            a_vec_scale_inv *= round_challenge;
+            if (round_size > 1) {
+                fold_generators(G_vec_local, round_size, round_challenge.sqr());
+                barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &G_vec_local[0], &G_vec_table[0], round_size);
+                G_table = &G_vec_table[0];
             }
         }
 
+        a_vec[0] *= a_vec_scale_inv;
         transcript.send_to_verifier("IPA:a_0", a_vec[0]);
     }
 
+  private:
+    // Below this many iterations per thread, a loop of field operations is not worth splitting across threads
+    static constexpr size_t MIN_ITERATIONS_PER_THREAD = 1 << 10;
+    // Folding a generator costs a scalar multiplication, so much shorter ranges of generators are worth a thread
+    static constexpr size_t MIN_GENERATORS_PER_THREAD = 1 << 6;
+
+    /**
+     * @brief Split [0, num_iterations) into contiguous ranges and call `func(start, end)` on each range in parallel
+     */
+    template <typename Func>
+    static void run_in_parallel(const size_t num_iterations, const size_t min_iterations_per_thread, Func&& func)
+    {
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads(num_iterations, min_iterations_per_thread);
+        const size_t iterations_per_thread = (num_iterations + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * iterations_per_thread, num_iterations);
+            const size_t end = std::min(start + iterations_per_thread, num_iterations);
+            func(start, end);
+        });
+    }
+
+    /**
+     * @brief Compute < a_vec_lo, b_vec_hi > and < a_vec_hi, b_vec_lo >, where lo and hi are the first and second
+     * `round_size` entries of each vector
+     */
+    static std::array<Fr, 2> compute_inner_products(const Polynomial& a_vec,
+                                                    const std::vector<Fr>& b_vec,
+                                                    const size_t round_size)
+    {
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads(round_size, MIN_ITERATIONS_PER_THREAD);
+        const size_t iterations_per_thread = (round_size + num_threads - 1) / num_threads;
+        std::vector<std::array<Fr, 2>> thread_inner_products(num_threads, { Fr::zero(), Fr::zero() });
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * iterations_per_thread, round_size);
+            const size_t end = std::min(start + iterations_per_thread, round_size);
+            auto& [inner_prod_L, inner_prod_R] = thread_inner_products[thread_idx];
+            for (size_t j = start; j < end; j++) {
+                inner_prod_L += a_vec[j] * b_vec[round_size + j];
+                inner_prod_R += a_vec[round_size + j] * b_vec[j];
+            }
+        });
+        std::array<Fr, 2> inner_products{ Fr::zero(), Fr::zero() };
+        for (const auto& [inner_prod_L, inner_prod_R] : thread_inner_products) {
+            inner_products[0] += inner_prod_L;
+            inner_products[1] += inner_prod_R;
+        }
+        return inner_products;
+    }
+
+    /**
+     * @brief Replace G_vec_lo with G_vec_lo + G_vec_hi * challenge in place, where lo and hi are the first and second
+     * `round_size` entries of G_vec
+     *
+     * @details Each thread multiplies its part of G_vec_hi with a batched-affine scalar multiplication, and adds the
+     * result to G_vec_lo with one batched normalization.
+     */
+    static void fold_generators(std::vector<Commitment>& G_vec, const size_t round_size, const Fr& challenge)
+    {
+        run_in_parallel(round_size, MIN_GENERATORS_PER_THREAD, [&](size_t start, size_t end) {
+            std::vector<Commitment> G_hi(G_vec.begin() + static_cast<std::ptrdiff_t>(round_size + start),
+                                         G_vec.begin() + static_cast<std::ptrdiff_t>(round_size + end));
+            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, challenge);
+            std::vector<GroupElement> G_folded(end - start);
+            for (size_t j = start; j < end; j++) {
+                G_folded[j - start] = GroupElement(G_vec[j]) + G_hi[j - start];
+            }
+            GroupElement::batch_normalize(&G_folded[0], G_folded.size());
+            for (size_t j = start; j < end; j++) {
+                const auto& folded = G_folded[j - start];
+                G_vec[j] = folded.is_point_at_infinity() ? Curve::Group::affine_point_at_infinity
+                                                          : Commitment(folded.x, folded.y);
+            }
+        });
+    }
+
+    /**
+     * @brief Compute s_vec[i] = scale * ∏_{j ∈ [k]} (u_j if bit k-1-j of i is set, else u_j^{-1}), where u_j are
+     * the round challenges
+     *
+     * @details s_vec[i + 2^j] = s_vec[i] * u_{k-1-j}^2 for i < 2^j, so s_vec is expanded from its first entry with one
+     * multiplication per entry. Each thread computes the first entry of its block of s_vec directly and expands it.
+     */
+    static void compute_s_vec(const std::vector<Fr>& round_challenges,
+                              const std::vector<Fr>& round_challenges_inv,
+                              const Fr& scale,
+                              std::span<Fr> s_vec)
+    {
+        const size_t log_poly_degree = round_challenges.size();
+        std::vector<Fr> round_challenges_sqr(log_poly_degree);
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            round_challenges_sqr[j] = round_challenges[j].sqr();
+        }
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(s_vec.size(), MIN_ITERATIONS_PER_THREAD);
+        const size_t block_size = s_vec.size() / num_threads;
+        const auto log_block_size = static_cast<size_t>(numeric::get_msb(block_size));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t block_start = thread_idx * block_size;
+            Fr s_vec_scalar = scale;
+            for (size_t j = 0; j < log_poly_degree; j++) {
+                const bool bit = j >= log_block_size && ((block_start >> j) & 1) == 1;
+                s_vec_scalar *= bit ? round_challenges[log_poly_degree - 1 - j]
+                                    : round_challenges_inv[log_poly_degree - 1 - j];
+            }
+            s_vec[block_start] = s_vec_scalar;
+            for (size_t j = 0; j < log_block_size; j++) {
+                const size_t half = static_cast<size_t>(1) << j;
+                for (size_t i = block_start; i < block_start + half; i++) {
+                    s_vec[i + half] = s_vec[i] * round_challenges_sqr[log_poly_degree - 1 - j];
+                }
+            }
+        });
+    }
+
+  public:
     /**
      * @brief Verify the correctness of a Proof
      *
@@ -138,35 +269,21 @@ template <typename Curve> class IPA {
     {
         auto poly_degree = static_cast<size_t>(transcript.template receive_from_prover<uint64_t>("IPA:poly_degree"));
         Fr generator_challenge = transcript.get_challenge("IPA:generator_challenge");
-        auto aux_generator = Commitment::one() * generator_challenge;
 
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
 
-        // Compute C_prime
-        GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
-
-        // Compute C_zero = C_prime + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
-        auto pippenger_size = 2 * log_poly_degree;
         std::vector<Fr> round_challenges(log_poly_degree);
         std::vector<Fr> round_challenges_inv(log_poly_degree);
-        std::vector<Commitment> msm_elements(pippenger_size);
-        std::vector<Fr> msm_scalars(pippenger_size);
+        std::vector<Commitment> LR_elements(2 * log_poly_degree);
         for (size_t i = 0; i < log_poly_degree; i++) {
             std::string index = std::to_string(i);
-            auto element_L = transcript.template receive_from_prover<Commitment>("IPA:L_" + index);
-            auto element_R = transcript.template receive_from_prover<Commitment>("IPA:R_" + index);
+            LR_elements[2 * i] = transcript.template receive_from_prover<Commitment>("IPA:L_" + index);
+            LR_elements[2 * i + 1] = transcript.template receive_from_prover<Commitment>("IPA:R_" + index);
             round_challenges[i] = transcript.get_challenge("IPA:round_challenge_" + index);
-            round_challenges_inv[i] = round_challenges[i].invert();
-
-            msm_elements[2 * i] = element_L;
-            msm_elements[2 * i + 1] = element_R;
-            msm_scalars[2 * i] = round_challenges[i].sqr();
-            msm_scalars[2 * i + 1] = round_challenges_inv[i].sqr();
         }
-        // TODO(#473)
-        GroupElement LR_sums = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &msm_scalars[0], &msm_elements[0], pippenger_size, vk->pippenger_runtime_state);
-        GroupElement C_zero = C_prime + LR_sums;
+        round_challenges_inv = round_challenges;
+        Fr::batch_invert(round_challenges_inv);
+        auto a_zero = transcript.template receive_from_prover<Fr>("IPA:a_0");
 
         /**
          * Compute b_zero where b_zero can be computed using the polynomial:
@@ -176,46 +293,48 @@ template <typename Curve> class IPA {
          * b_zero = g(evaluation) = ∏_{i ∈ [k]} (u_{k-i}^{-1} + u_{k-i}. (evaluation)^{2^{i-1}})
          */
         Fr b_zero = Fr::one();
+        Fr challenge_power = opening_claim.opening_pair.challenge;
         for (size_t i = 0; i < log_poly_degree; i++) {
-            auto exponent = static_cast<uint64_t>(Fr(2).pow(i));
             b_zero *= round_challenges_inv[log_poly_degree - 1 - i] +
-                      (round_challenges[log_poly_degree - 1 - i] * opening_claim.opening_pair.challenge.pow(exponent));
+                      (round_challenges[log_poly_degree - 1 - i] * challenge_power);
+            challenge_power.self_sqr();
         }
 
-        // Compute G_zero
-        // First construct s_vec
-        std::vector<Fr> s_vec(poly_degree);
-        for (size_t i = 0; i < poly_degree; i++) {
-            Fr s_vec_scalar = Fr::one();
-            for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                auto bit = (i >> j) & 1;
-                bool b = static_cast<bool>(bit);
-                if (b) {
-                    s_vec_scalar *= round_challenges[log_poly_degree - 1 - j];
-                } else {
-                    s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                }
-            }
-            s_vec[i] = s_vec_scalar;
-        }
-        auto srs_elements = vk->srs->get_monomial_points();
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
+        /**
+         * The proof is valid iff C_zero = G_zero * a_zero + aux_generator * a_zero * b_zero, where
+         *
+         *      C_zero = C + aux_generator * evaluation + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
+         *      G_zero = < s_vec, G_vec >
+         *
+         * i.e. iff C + < s_vec * (-a_zero), G_vec > + ∑_{j ∈ [k]} (u_j^2L_j + u_j^{-2}R_j)
+         *              + [1] * generator_challenge * (evaluation - a_zero * b_zero) is the point at infinity.
+         * Everything but C is computed with one MSM over G_vec, the L_j and R_j, and the generator [1]. (C is left out
+         * as it may be the point at infinity, which the MSM cannot take.)
+         */
+        const size_t msm_size = poly_degree + 2 * log_poly_degree + 1;
+        std::vector<Fr> msm_scalars(msm_size);
+        compute_s_vec(round_challenges, round_challenges_inv, -a_zero, std::span(msm_scalars).subspan(0, poly_degree));
+        for (size_t i = 0; i < log_poly_degree; i++) {
+            msm_scalars[poly_degree + 2 * i] = round_challenges[i].sqr();
+            msm_scalars[poly_degree + 2 * i + 1] = round_challenges_inv[i].sqr();
         }
-        // TODO(#473)
-        auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
-
-        auto a_zero = transcript.template receive_from_prover<Fr>("IPA:a_0");
+        msm_scalars[msm_size - 1] = generator_challenge * (opening_claim.opening_pair.evaluation - a_zero * b_zero);
 
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+        // The SRS stored in the verification key is already a pippenger point table. The table of the remaining points
+        // is appended to it. These come last so that, however large poly_degree is, they make up the remainder of the
+        // MSM that pippenger hands to straus, whose projective additions handle the edge cases (such as
+        // repeated points) a prover could otherwise use to break pippenger's batched affine additions.
+        std::vector<Commitment> msm_points(2 * msm_size);
+        const auto srs_elements = vk->srs->get_monomial_points();
+        std::copy(srs_elements, srs_elements + 2 * poly_degree, msm_points.begin());
+        LR_elements.emplace_back(Commitment::one());
+        barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+            &LR_elements[0], &msm_points[2 * poly_degree], LR_elements.size());
 
-        return (C_zero.normalize() == right_hand_side.normalize());
+        GroupElement result = barretenberg::scalar_multiplication::pippenger<Curve>(
+            &msm_scalars[0], &msm_points[0], msm_size, vk->pippenger_runtime_state, false);
+        result += opening_claim.commitment;
+        return result.is_point_at_infinity();
     }
 };
 
@@ -82,6 +82,28 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript.get_manifest(), verifier_transcript.get_manifest());
 }
 
+TEST_F(IPATest, OpenLargeDegree)
+{
+    using IPA = IPA<Curve>;
+    // Large enough that the first rounds use pippenger rather than straus and the folds are split across threads
+    const size_t n = 2048;
+    auto poly = this->random_polynomial(n);
+    auto [x, eval] = this->random_eval(poly);
+    auto commitment = this->commit(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+
+    BaseTranscript<Fr> prover_transcript;
+    IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+
+    BaseTranscript<Fr> verifier_transcript{ prover_transcript.proof_data };
+    EXPECT_TRUE(IPA::verify(this->vk(), { opening_pair, commitment }, verifier_transcript));
+
+    // The same proof must not open the commitment to a different evaluation
+    BaseTranscript<Fr> bad_verifier_transcript{ prover_transcript.proof_data };
+    const OpeningClaim<Curve> bad_claim{ { x, eval + Fr::one() }, commitment };
+    EXPECT_FALSE(IPA::verify(this->vk(), bad_claim, bad_verifier_transcript));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -116,25 +116,29 @@ template <typename Curve> class ShplonkProver_ {
 
         // G(X) = Q(X) - Q_z(X) = Q(X) - ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ),
         // s.t. G(r) = 0
-        Polynomial G(std::move(batched_quotient_Q)); // G(X) = Q(X)
+        std::vector<std::span<const Fr>> polynomials{ batched_quotient_Q };
+        std::vector<Fr> scalars{ Fr::one() };
+        polynomials.reserve(num_opening_pairs + 1);
+        scalars.reserve(num_opening_pairs + 1);
 
         // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
+        Fr G_0_correction = Fr::zero();
         Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
         for (size_t j = 0; j < num_opening_pairs; ++j) {
             // (Cⱼ, xⱼ, vⱼ)
             const auto& [challenge, evaluation] = opening_pairs[j];
 
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = witness_polynomials[j];
-            tmp[0] -= evaluation;
             Fr scaling_factor = current_nu * inverse_vanishing_evals[j]; // = ρʲ / ( r − xⱼ )
 
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
+            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ), where the constant terms ρʲ ⋅ vⱼ / ( r − xⱼ ) are added to G₀ below
+            polynomials.emplace_back(witness_polynomials[j]);
+            scalars.emplace_back(-scaling_factor);
+            G_0_correction += scaling_factor * evaluation;
 
             current_nu *= nu_challenge;
         }
+        Polynomial G = Polynomial::linear_combination(polynomials, scalars, batched_quotient_Q.size());
+        G[0] += G_0_correction;
 
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
         return { .opening_pair = { .challenge = z_challenge, .evaluation = Fr::zero() }, .witness = std::move(G) };
@@ -1,5 +1,8 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 namespace proof_system::honk::pcs::zeromorph {
 
@@ -56,7 +59,8 @@ template <typename Curve> class ZeroMorphProver_ {
      * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
      * @return std::vector<Polynomial> The quotients q_k
      */
-    static std::vector<Polynomial> compute_multilinear_quotients(Polynomial polynomial, std::span<FF> u_challenge)
+    static std::vector<Polynomial> compute_multilinear_quotients(const Polynomial& polynomial,
+                                                                std::span<FF> u_challenge)
     {
         size_t log_N = numeric::get_msb(polynomial.size());
         // The size of the multilinear challenge must equal the log of the polynomial size
@@ -64,41 +68,41 @@ template <typename Curve> class ZeroMorphProver_ {
 
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
         std::vector<Polynomial> quotients;
+        quotients.reserve(log_N);
         for (size_t k = 0; k < log_N; ++k) {
             size_t size = 1 << k;
-            quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
+            quotients.emplace_back(size, barretenberg::DontZeroMemory::FLAG); // degree 2^k - 1
         }
-
-        // Compute the coefficients of q_{n-1}
-        size_t size_q = 1 << (log_N - 1);
-        Polynomial q = Polynomial(size_q);
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
+        if (log_N == 0) {
+            return quotients;
         }
 
-        quotients[log_N - 1] = q;
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
-        for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
-            size_q = size_q / 2;
-            q = Polynomial(size_q);
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
-
-            quotients[log_N - k - 1] = q;
-            g = f_k;
+        // The updated f, which halves in size at every step, is kept in place in a single scratch buffer. At step k it
+        // is only read at indices that the step does not write to, so each step is split across threads.
+        Polynomial scratch(polynomial.size() / 2, barretenberg::DontZeroMemory::FLAG);
+        std::span<const FF> f = polynomial;
+
+        // Compute q_k in reverse order from k = n-1, i.e. q_{n-1}, ..., q_0
+        for (size_t k = log_N - 1; k < log_N; --k) {
+            const size_t size_q = 1 << k;
+            auto& q = quotients[k];
+            const FF u = u_challenge[k];
+            const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(size_q);
+            const size_t range_per_thread = size_q / num_threads;
+            const size_t leftovers = size_q - (range_per_thread * num_threads);
+            parallel_for(num_threads, [&](size_t j) {
+                const size_t offset = j * range_per_thread;
+                const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers
+                                                          : offset + range_per_thread;
+                for (size_t l = offset; l < end; ++l) {
+                    // q_k[l] = f[2^k + l] - f[l], then f[l] <- f[l] + u_k * q_k[l] (f is not needed after q_0)
+                    q[l] = f[size_q + l] - f[l];
+                    if (k > 0) {
+                        scratch[l] = f[l] + u * q[l];
+                    }
+                }
+            });
+            f = std::span<const FF>(scratch.data().get(), size_q);
         }
 
         return quotients;
@@ -162,7 +166,8 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t log_N = quotients.size();
 
         // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
+        std::vector<std::span<const FF>> polynomials{ batched_quotient };
+        std::vector<FF> scalars{ FF(1) };
 
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
@@ -170,12 +175,13 @@ template <typename Curve> class ZeroMorphProver_ {
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
 
-            result.add_scaled(quotients[k], -y_power * x_power);
+            polynomials.emplace_back(quotients[k]);
+            scalars.emplace_back(-y_power * x_power);
 
             y_power *= y_challenge; // update batching scalar y^k
         }
 
-        return result;
+        return Polynomial::linear_combination(polynomials, scalars, N);
     }
 
     /**
@@ -210,14 +216,12 @@ template <typename Curve> class ZeroMorphProver_ {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
-        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
-        result.add_scaled(f_batched, x_challenge);
+        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i. The terms of Z_x are gathered first and
+        // summed in a single pass
+        std::vector<std::span<const FF>> polynomials{ g_batched, f_batched };
+        std::vector<FF> scalars{ FF(1), x_challenge };
 
-        // Compute Z_x -= v * x * \Phi_n(x)
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
-        auto phi_n_x = phi_numerator / (x_challenge - 1);
-        result[0] -= v_evaluation * x_challenge * phi_n_x;
 
         // Add contribution from q_k polynomials
         auto x_power = x_challenge; // x^{2^k}
@@ -236,7 +240,8 @@ template <typename Curve> class ZeroMorphProver_ {
             scalar *= x_challenge;
             scalar *= FF(-1);
 
-            result.add_scaled(quotients[k], scalar);
+            polynomials.emplace_back(quotients[k]);
+            scalars.emplace_back(scalar);
         }
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
@@ -249,10 +254,16 @@ template <typename Curve> class ZeroMorphProver_ {
                 x_challenge.pow(MINICIRCUIT_N); // power of x used to shift polynomials to the right
             auto running_shift = x_challenge;
             for (size_t i = 0; i < concatenation_groups_batched.size(); i++) {
-                result.add_scaled(concatenation_groups_batched[i], running_shift);
+                polynomials.emplace_back(concatenation_groups_batched[i]);
+                scalars.emplace_back(running_shift);
                 running_shift *= x_to_minicircuit_N;
             }
         }
+        auto result = Polynomial::linear_combination(polynomials, scalars, N);
+
+        // Compute Z_x -= v * x * \Phi_n(x)
+        auto phi_n_x = phi_numerator / (x_challenge - 1);
+        result[0] -= v_evaluation * x_challenge * phi_n_x;
 
         return result;
     }
@@ -301,6 +312,37 @@ template <typename Curve> class ZeroMorphProver_ {
         return batched_shifted_quotient;
     }
 
+    /**
+     * @brief Compute the commitments [q_k], k = 0, ..., d-1
+     * @details deg(q_k) = 2^k - 1, so all but the last few quotients are small enough for straus. These are committed
+     * concurrently, each on its own thread, and the rest one at a time with the commitment key's pippenger, which is
+     * itself multi-threaded.
+     */
+    static std::vector<Commitment> commit_quotients(auto& commitment_key, const std::vector<Polynomial>& quotients)
+    {
+        std::vector<Commitment> commitments(quotients.size());
+        size_t num_small_quotients = 0;
+        while (num_small_quotients < quotients.size() &&
+               quotients[num_small_quotients].size() <= barretenberg::scalar_multiplication::STRAUS_MAX_POINTS) {
+            ++num_small_quotients;
+        }
+        // The SRS is stored as a pippenger point table, holding each point followed by its endomorphism image
+        const auto* srs_points = commitment_key->srs->get_monomial_points();
+        parallel_for(num_small_quotients, [&](size_t k) {
+            const auto& quotient = quotients[k];
+            std::vector<Commitment> points(quotient.size());
+            for (size_t i = 0; i < quotient.size(); ++i) {
+                points[i] = srs_points[2 * i];
+            }
+            commitments[k] =
+                barretenberg::scalar_multiplication::straus<Curve>(quotient.data().get(), points.data(), points.size());
+        });
+        for (size_t k = num_small_quotients; k < quotients.size(); ++k) {
+            commitments[k] = commitment_key->commit(quotients[k]);
+        }
+        return commitments;
+    }
+
     /**
      * @brief Prove a set of multilinear evaluation claims for unshifted polynomials f_i and to-be-shifted polynomials
      * g_i
@@ -338,42 +380,52 @@ template <typename Curve> class ZeroMorphProver_ {
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
         auto batched_evaluation = FF(0);
-        Polynomial f_batched(N); // batched unshifted polynomials
         FF batching_scalar = FF(1);
+        std::vector<std::span<const FF>> f_batch_polynomials;
+        std::vector<FF> f_batching_scalars;
         for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
+            f_batch_polynomials.emplace_back(f_poly);
+            f_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * f_eval;
             batching_scalar *= rho;
         }
-
-        Polynomial g_batched(N); // batched to-be-shifted polynomials
+        std::vector<std::span<const FF>> g_batch_polynomials;
+        std::vector<FF> g_batching_scalars;
         for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
+            g_batch_polynomials.emplace_back(g_poly);
+            g_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * g_shift_eval;
             batching_scalar *= rho;
         };
+        // batched unshifted polynomials
+        auto f_batched = Polynomial::linear_combination(f_batch_polynomials, f_batching_scalars, N);
+        // batched to-be-shifted polynomials
+        auto g_batched = Polynomial::linear_combination(g_batch_polynomials, g_batching_scalars, N);
 
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
         // Concatenated polynomials
-        // std::vector<Polynomial> concatenated_polynomials;
-        Polynomial concatenated_batched(N);
-
-        // construct concatention_groups_batched
-        std::vector<Polynomial> concatenation_groups_batched;
-        for (size_t i = 0; i < num_chunks_per_group; ++i) {
-            concatenation_groups_batched.push_back(Polynomial(N));
-        }
-        // for each group
+        std::vector<std::span<const FF>> concatenated_batch_polynomials;
+        std::vector<FF> concatenated_batching_scalars;
         for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
-            // for each element in a group
-            for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
-            }
+            concatenated_batch_polynomials.emplace_back(concatenated_polynomials[i]);
+            concatenated_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * concatenated_evaluations[i];
             batching_scalar *= rho;
         }
+        auto concatenated_batched =
+            Polynomial::linear_combination(concatenated_batch_polynomials, concatenated_batching_scalars, N);
+
+        // construct concatention_groups_batched: chunk j of every group, batched with the scalar of its group
+        std::vector<Polynomial> concatenation_groups_batched;
+        for (size_t j = 0; j < num_chunks_per_group; ++j) {
+            std::vector<std::span<const FF>> chunks;
+            for (size_t i = 0; i < num_groups; ++i) {
+                chunks.emplace_back(concatenation_groups[i][j]);
+            }
+            concatenation_groups_batched.push_back(
+                Polynomial::linear_combination(chunks, concatenated_batching_scalars, N));
+        }
 
         // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
         // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
@@ -385,10 +437,8 @@ template <typename Curve> class ZeroMorphProver_ {
         auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
+        auto q_k_commitments = commit_quotients(commitment_key, quotients);
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
             transcript.send_to_verifier(label, q_k_commitments[idx]);
         }
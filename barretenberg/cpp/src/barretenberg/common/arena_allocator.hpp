@@ -0,0 +1,211 @@
+#pragma once
+#include "./mem.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * @brief A bump allocator that serves memory out of a few large chunks and releases all of them at once on destruction.
+ *
+ * @details Intended for the wire and selector columns of a circuit builder: they only ever grow and they die together
+ * with the builder, so there is no need to return memory to the system piecemeal. Chunks grow geometrically, so a
+ * column grown one gate at a time costs a logarithmic number of system allocations. Blocks released when a column
+ * reallocates are coalesced on a free list and handed to the next column that grows into them, and a block at the top of
+ * the current chunk is simply rolled back when released.
+ *
+ * An arena holds no global state, so independent builders can be constructed concurrently, but a single arena is not
+ * thread safe.
+ */
+class MemoryArena {
+  public:
+    static constexpr size_t ALIGNMENT = 32;
+    static constexpr size_t MIN_CHUNK_SIZE = 1UL << 16;
+
+    MemoryArena() = default;
+    MemoryArena(const MemoryArena& other) = delete;
+    MemoryArena(MemoryArena&& other) = delete;
+    MemoryArena& operator=(const MemoryArena& other) = delete;
+    MemoryArena& operator=(MemoryArena&& other) = delete;
+    ~MemoryArena()
+    {
+        for (auto& chunk : chunks) {
+            aligned_free(chunk.data);
+        }
+    }
+
+    void* allocate(size_t size)
+    {
+        size = round_up(size);
+        // Reuse a released block, provided we don't waste more than half of it
+        for (size_t i = 0; i < free_blocks.size(); ++i) {
+            if (free_blocks[i].size >= size && free_blocks[i].size < 2 * size) {
+                uint8_t* ptr = free_blocks[i].data;
+                // Keep the remainder around if it is large enough to be useful
+                if (free_blocks[i].size - size >= ALIGNMENT) {
+                    free_blocks[i] = { ptr + size, free_blocks[i].size - size };
+                } else {
+                    free_blocks[i] = free_blocks.back();
+                    free_blocks.pop_back();
+                }
+                return ptr;
+            }
+        }
+        if (remaining() < size) {
+            add_chunk(size);
+        }
+        auto& chunk = chunks.back();
+        void* ptr = chunk.data + chunk.used;
+        chunk.used += size;
+        return ptr;
+    }
+
+    void deallocate(void* ptr, size_t size)
+    {
+        Block block{ static_cast<uint8_t*>(ptr), round_up(size) };
+        // Coalesce with released neighbours, so that columns growing in lockstep can reuse each other's old storage
+        for (size_t i = 0; i < free_blocks.size();) {
+            if (free_blocks[i].data + free_blocks[i].size == block.data) {
+                block = { free_blocks[i].data, free_blocks[i].size + block.size };
+            } else if (block.data + block.size == free_blocks[i].data) {
+                block.size += free_blocks[i].size;
+            } else {
+                ++i;
+                continue;
+            }
+            free_blocks[i] = free_blocks.back();
+            free_blocks.pop_back();
+        }
+        // A block at the top of the current chunk is simply rolled back
+        if (!chunks.empty()) {
+            auto& chunk = chunks.back();
+            if (block.data + block.size == chunk.data + chunk.used) {
+                chunk.used -= block.size;
+                return;
+            }
+        }
+        free_blocks.push_back(block);
+    }
+
+    /**
+     * @brief Make sure that the next `size` bytes of allocations are served from the current chunk
+     */
+    void reserve(size_t size)
+    {
+        size = round_up(size);
+        if (remaining() < size) {
+            add_chunk(size);
+        }
+    }
+
+    /**
+     * @brief Total number of bytes obtained from the system
+     */
+    size_t capacity() const { return total_size; }
+
+    size_t num_chunks() const { return chunks.size(); }
+
+  private:
+    struct Chunk {
+        uint8_t* data;
+        size_t size;
+        size_t used;
+    };
+    struct Block {
+        uint8_t* data;
+        size_t size;
+    };
+
+    static size_t round_up(size_t size) { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+    size_t remaining() const { return chunks.empty() ? 0 : chunks.back().size - chunks.back().used; }
+
+    void add_chunk(size_t min_size)
+    {
+        // The tail of the current chunk stays usable through the free list
+        if (remaining() >= ALIGNMENT) {
+            auto& chunk = chunks.back();
+            free_blocks.push_back({ chunk.data + chunk.used, chunk.size - chunk.used });
+            chunk.used = chunk.size;
+        }
+        const size_t size = std::max({ min_size, MIN_CHUNK_SIZE, total_size });
+        chunks.push_back({ static_cast<uint8_t*>(aligned_alloc(ALIGNMENT, size)), size, 0 });
+        total_size += size;
+    }
+
+    std::vector<Chunk> chunks;
+    std::vector<Block> free_blocks;
+    size_t total_size = 0;
+};
+
+/**
+ * @brief Allocator for containers such as std::vector that serves memory from a shared MemoryArena. A default
+ * constructed allocator has no arena and falls back to 32 byte aligned heap allocations.
+ *
+ * @details A copy of a container does not inherit the arena, so that it may outlive the arena's owner or be handed to
+ * another thread. Moving or swapping containers carries the arena along with the memory.
+ */
+template <typename T> class ContainerArenaAllocator {
+  public:
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U> struct rebind {
+        using other = ContainerArenaAllocator<U>;
+    };
+
+    ContainerArenaAllocator() = default;
+    explicit ContainerArenaAllocator(std::shared_ptr<MemoryArena> arena)
+        : arena(std::move(arena))
+    {}
+    template <typename U>
+    ContainerArenaAllocator(const ContainerArenaAllocator<U>& other) // NOLINT(google-explicit-constructor)
+        : arena(other.get_arena())
+    {}
+
+    ContainerArenaAllocator select_on_container_copy_construction() const { return ContainerArenaAllocator(); }
+
+    pointer allocate(size_type n)
+    {
+        const size_t size = n * sizeof(T);
+        if (arena) {
+            return static_cast<pointer>(arena->allocate(size));
+        }
+        return static_cast<pointer>(aligned_alloc(MemoryArena::ALIGNMENT, size));
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        if (arena) {
+            arena->deallocate(p, n * sizeof(T));
+        } else {
+            aligned_free(p);
+        }
+    }
+
+    const std::shared_ptr<MemoryArena>& get_arena() const { return arena; }
+
+    friend bool operator==(const ContainerArenaAllocator& lhs, const ContainerArenaAllocator& rhs)
+    {
+        return lhs.arena == rhs.arena;
+    }
+
+    friend bool operator!=(const ContainerArenaAllocator& lhs, const ContainerArenaAllocator& rhs)
+    {
+        return lhs.arena != rhs.arena;
+    }
+
+  private:
+    std::shared_ptr<MemoryArena> arena;
+};
+
+} // namespace barretenberg
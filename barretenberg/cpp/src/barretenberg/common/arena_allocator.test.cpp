@@ -0,0 +1,80 @@
+#include "arena_allocator.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace barretenberg;
+
+TEST(arena_allocator, reserve_serves_from_single_chunk)
+{
+    auto arena = std::make_shared<MemoryArena>();
+    arena->reserve(1UL << 20);
+    EXPECT_EQ(arena->num_chunks(), 1UL);
+
+    std::vector<std::vector<uint64_t, ContainerArenaAllocator<uint64_t>>> columns;
+    for (size_t i = 0; i < 8; ++i) {
+        columns.emplace_back(ContainerArenaAllocator<uint64_t>(arena));
+        columns.back().reserve(1UL << 14);
+    }
+    for (auto& column : columns) {
+        for (uint64_t j = 0; j < (1UL << 14); ++j) {
+            column.push_back(j);
+        }
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(column.data()) % MemoryArena::ALIGNMENT, 0UL);
+    }
+    EXPECT_EQ(arena->num_chunks(), 1UL);
+    for (const auto& column : columns) {
+        EXPECT_EQ(column[12345], 12345UL);
+    }
+}
+
+TEST(arena_allocator, growth_reuses_released_blocks)
+{
+    auto arena = std::make_shared<MemoryArena>();
+    std::vector<std::vector<uint32_t, ContainerArenaAllocator<uint32_t>>> columns;
+    for (size_t i = 0; i < 4; ++i) {
+        columns.emplace_back(ContainerArenaAllocator<uint32_t>(arena));
+    }
+    // Grow the columns in lockstep, as a circuit builder does
+    const size_t num_rows = 1UL << 18;
+    for (uint32_t j = 0; j < num_rows; ++j) {
+        for (auto& column : columns) {
+            column.push_back(j);
+        }
+    }
+    for (const auto& column : columns) {
+        for (uint32_t j = 0; j < num_rows; j += 1000) {
+            EXPECT_EQ(column[j], j);
+        }
+    }
+    // Released blocks are recycled and chunks grow geometrically, so the arena stays within a small factor of the
+    // memory that is actually in use
+    const size_t in_use = columns.size() * columns[0].capacity() * sizeof(uint32_t);
+    EXPECT_LT(arena->capacity(), 4 * in_use);
+    EXPECT_LT(arena->num_chunks(), 16UL);
+}
+
+TEST(arena_allocator, copies_and_moves)
+{
+    std::vector<uint32_t, ContainerArenaAllocator<uint32_t>> copy;
+    std::vector<uint32_t, ContainerArenaAllocator<uint32_t>> moved;
+    {
+        auto arena = std::make_shared<MemoryArena>();
+        std::vector<uint32_t, ContainerArenaAllocator<uint32_t>> column{ ContainerArenaAllocator<uint32_t>(arena) };
+        for (uint32_t j = 0; j < 1000; ++j) {
+            column.push_back(j);
+        }
+        // A copy is detached from the arena, a moved-to container keeps it alive
+        copy = column;
+        EXPECT_EQ(copy.get_allocator().get_arena(), nullptr);
+        std::vector<uint32_t, ContainerArenaAllocator<uint32_t>> copy_constructed(column);
+        EXPECT_EQ(copy_constructed.get_allocator().get_arena(), nullptr);
+        moved = std::move(column);
+        EXPECT_EQ(moved.get_allocator().get_arena(), arena);
+    }
+    for (uint32_t j = 0; j < 1000; ++j) {
+        EXPECT_EQ(copy[j], j);
+        EXPECT_EQ(moved[j], j);
+    }
+    moved.push_back(1000);
+    EXPECT_EQ(moved.back(), 1000U);
+}
@@ -0,0 +1,329 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * @brief Default hash functor for FlatHashMap.
+ *
+ * @details FlatHashMap uses power-of-two capacities and takes the top bits of the hash as the slot index, so the hash
+ * has to spread entropy into the high bits. Specializations are provided for the key types that dominate circuit
+ * construction: small integers (witness indices, tags, ranges) and field elements.
+ */
+template <typename Key> struct FlatHash;
+
+/**
+ * @brief Integer keys are spread with a Fibonacci (multiplicative) hash
+ */
+template <std::integral Key> struct FlatHash<Key> {
+    size_t operator()(const Key key) const noexcept
+    {
+        return static_cast<size_t>(static_cast<uint64_t>(key) * 0x9e3779b97f4a7c15ULL);
+    }
+};
+
+/**
+ * @brief Field elements are hashed from their reduced Montgomery limbs, which are already close to uniformly
+ * distributed. The element has to be reduced first, as equal field elements may have different internal
+ * representations.
+ */
+template <typename Key>
+    requires requires(const Key& key) {
+        {
+            key.reduce_once().data[0]
+        } -> std::convertible_to<uint64_t>;
+    }
+struct FlatHash<Key> {
+    size_t operator()(const Key& key) const noexcept
+    {
+        const auto reduced = key.reduce_once();
+        return static_cast<size_t>((reduced.data[0] ^ (reduced.data[1] >> 32) ^ (reduced.data[2] << 17)) *
+                                   0x9e3779b97f4a7c15ULL);
+    }
+};
+
+/**
+ * @brief An open-addressing hash map with linear probing, storing its entries in one contiguous array.
+ *
+ * @details Intended for the bookkeeping maps of the circuit builders, which are queried on every gate. Compared to
+ * std::map / std::unordered_map there is no per-entry allocation and a lookup touches one or two cache lines.
+ * Erasure uses backward-shift deletion, so there are no tombstones and probe sequences stay short.
+ *
+ * Differences to the standard containers:
+ *  - iteration order is unspecified (but deterministic for a given sequence of operations). Code that needs a stable
+ *    order, e.g. to produce identical circuits, has to sort the keys itself;
+ *  - any insertion or erasure invalidates all iterators and references;
+ *  - Key and Value must be default constructible, and keys must not be modified through iterators.
+ */
+template <typename Key, typename Value, typename Hash = FlatHash<Key>> class FlatHashMap {
+  public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+
+    template <bool IsConst> class Iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using map_pointer = std::conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        Iterator() = default;
+        Iterator(map_pointer map, size_t index)
+            : map(map)
+            , index(index)
+        {
+            skip_empty_slots();
+        }
+        // Allow conversion from iterator to const_iterator
+        template <bool OtherIsConst>
+            requires(IsConst && !OtherIsConst)
+        Iterator(const Iterator<OtherIsConst>& other)
+            : map(other.map)
+            , index(other.index)
+        {}
+
+        reference operator*() const { return map->slots[index]; }
+        pointer operator->() const { return &map->slots[index]; }
+        Iterator& operator++()
+        {
+            ++index;
+            skip_empty_slots();
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator result = *this;
+            ++(*this);
+            return result;
+        }
+        bool operator==(const Iterator& other) const { return index == other.index; }
+
+      private:
+        friend class FlatHashMap;
+        friend class Iterator<!IsConst>;
+        void skip_empty_slots()
+        {
+            while (index < map->occupied.size() && !map->occupied[index]) {
+                ++index;
+            }
+        }
+        map_pointer map = nullptr;
+        size_t index = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+    FlatHashMap(std::initializer_list<value_type> entries)
+    {
+        reserve(entries.size());
+        for (const auto& entry : entries) {
+            insert(entry);
+        }
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, slots.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, slots.size()); }
+
+    size_t size() const { return num_entries; }
+    bool empty() const { return num_entries == 0; }
+    size_t capacity() const { return slots.size(); }
+
+    void clear()
+    {
+        slots.clear();
+        occupied.clear();
+        num_entries = 0;
+        shift = WORD_BITS;
+    }
+
+    /**
+     * @brief Ensure that `num_elements` entries fit without rehashing
+     */
+    void reserve(const size_t num_elements)
+    {
+        size_t required_capacity = MIN_CAPACITY;
+        while (required_capacity * MAX_LOAD_NUMERATOR < num_elements * MAX_LOAD_DENOMINATOR) {
+            required_capacity <<= 1;
+        }
+        if (required_capacity > slots.size()) {
+            rehash(required_capacity);
+        }
+    }
+
+    iterator find(const Key& key)
+    {
+        const size_t index = find_index(key);
+        return index == NOT_FOUND ? end() : iterator(this, index);
+    }
+    const_iterator find(const Key& key) const
+    {
+        const size_t index = find_index(key);
+        return index == NOT_FOUND ? end() : const_iterator(this, index);
+    }
+    bool contains(const Key& key) const { return find_index(key) != NOT_FOUND; }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    Value& at(const Key& key)
+    {
+        const size_t index = find_index(key);
+        if (index == NOT_FOUND) {
+            throw_or_abort("FlatHashMap::at: key not found");
+        }
+        return slots[index].second;
+    }
+    const Value& at(const Key& key) const
+    {
+        const size_t index = find_index(key);
+        if (index == NOT_FOUND) {
+            throw_or_abort("FlatHashMap::at: key not found");
+        }
+        return slots[index].second;
+    }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    /**
+     * @brief Insert `key` with a value constructed from `args` if the key is not present yet
+     *
+     * @return The iterator to the entry with the given key and whether an insertion took place
+     */
+    template <typename... Args> std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        const size_t existing = find_index(key);
+        if (existing != NOT_FOUND) {
+            return { iterator(this, existing), false };
+        }
+        reserve(num_entries + 1);
+        size_t index = home_slot(key);
+        while (occupied[index]) {
+            index = (index + 1) & (slots.size() - 1);
+        }
+        slots[index] = value_type(key, Value(std::forward<Args>(args)...));
+        occupied[index] = 1;
+        ++num_entries;
+        return { iterator(this, index), true };
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) { return try_emplace(entry.first, entry.second); }
+    std::pair<iterator, bool> insert(value_type&& entry)
+    {
+        return try_emplace(entry.first, std::move(entry.second));
+    }
+
+    /**
+     * @brief Remove the entry with the given key, if present
+     *
+     * @details Backward-shift deletion: the entries following the erased slot in its probe run are moved back so that
+     * every remaining entry is still reachable from its home slot.
+     *
+     * @return The number of erased entries (0 or 1)
+     */
+    size_t erase(const Key& key)
+    {
+        size_t hole = find_index(key);
+        if (hole == NOT_FOUND) {
+            return 0;
+        }
+        const size_t mask = slots.size() - 1;
+        size_t index = (hole + 1) & mask;
+        while (occupied[index]) {
+            const size_t home = home_slot(slots[index].first);
+            // Move the entry into the hole unless its home slot lies cyclically in (hole, index]
+            const bool reachable_from_hole = ((index - home) & mask) >= ((index - hole) & mask);
+            if (reachable_from_hole) {
+                slots[hole] = std::move(slots[index]);
+                hole = index;
+            }
+            index = (index + 1) & mask;
+        }
+        slots[hole] = value_type();
+        occupied[hole] = 0;
+        --num_entries;
+        return 1;
+    }
+
+    bool operator==(const FlatHashMap& other) const
+    {
+        if (num_entries != other.num_entries) {
+            return false;
+        }
+        for (const auto& [key, value] : *this) {
+            const size_t index = other.find_index(key);
+            if (index == NOT_FOUND || !(other.slots[index].second == value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr size_t WORD_BITS = 64;
+    // Grow once the table is 3/4 full; linear probing degrades quickly beyond that
+    static constexpr size_t MAX_LOAD_NUMERATOR = 3;
+    static constexpr size_t MAX_LOAD_DENOMINATOR = 4;
+
+    size_t home_slot(const Key& key) const { return static_cast<size_t>(static_cast<uint64_t>(Hash{}(key)) >> shift); }
+
+    size_t find_index(const Key& key) const
+    {
+        if (num_entries == 0) {
+            return NOT_FOUND;
+        }
+        const size_t mask = slots.size() - 1;
+        size_t index = home_slot(key);
+        while (occupied[index]) {
+            if (slots[index].first == key) {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        return NOT_FOUND;
+    }
+
+    void rehash(const size_t new_capacity)
+    {
+        ASSERT((new_capacity & (new_capacity - 1)) == 0);
+        std::vector<value_type> old_slots(new_capacity);
+        std::vector<uint8_t> old_occupied(new_capacity, 0);
+        std::swap(old_slots, slots);
+        std::swap(old_occupied, occupied);
+        shift = WORD_BITS - static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(new_capacity)));
+
+        const size_t mask = new_capacity - 1;
+        for (size_t i = 0; i < old_slots.size(); ++i) {
+            if (!old_occupied[i]) {
+                continue;
+            }
+            size_t index = home_slot(old_slots[i].first);
+            while (occupied[index]) {
+                index = (index + 1) & mask;
+            }
+            slots[index] = std::move(old_slots[i]);
+            occupied[index] = 1;
+        }
+    }
+
+    std::vector<value_type> slots;
+    std::vector<uint8_t> occupied;
+    size_t num_entries = 0;
+    // The slot index is given by the top log2(capacity) bits of the hash
+    size_t shift = WORD_BITS;
+};
+
+} // namespace barretenberg
@@ -0,0 +1,108 @@
+#include "flat_hash_map.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+
+using namespace barretenberg;
+
+TEST(flat_hash_map, insert_find_erase)
+{
+    FlatHashMap<uint32_t, uint32_t> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(0));
+
+    const size_t num_entries = 1000;
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        EXPECT_TRUE(map.insert({ i, 2 * i }).second);
+    }
+    // Inserting an existing key does not overwrite the value
+    EXPECT_FALSE(map.insert({ 0, 1 }).second);
+    EXPECT_EQ(map.size(), num_entries);
+
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        EXPECT_EQ(map.at(i), 2 * i);
+    }
+    EXPECT_EQ(map.find(static_cast<uint32_t>(num_entries)), map.end());
+
+    for (uint32_t i = 0; i < num_entries; i += 2) {
+        EXPECT_EQ(map.erase(i), 1UL);
+    }
+    EXPECT_EQ(map.erase(0), 0UL);
+    EXPECT_EQ(map.size(), num_entries / 2);
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        EXPECT_EQ(map.contains(i), (i & 1) == 1);
+    }
+
+    map[0] = 7;
+    EXPECT_EQ(map.at(0), 7U);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(1));
+}
+
+/**
+ * @brief Compare against std::map under a random sequence of insertions and erasures on a small key space, so that long
+ * probe runs (and their backward-shift deletion) are exercised
+ */
+TEST(flat_hash_map, matches_std_map)
+{
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::map<uint64_t, uint64_t> expected;
+    std::mt19937_64 rng(0);
+
+    for (size_t i = 0; i < 100000; ++i) {
+        const uint64_t key = rng() % 512;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        } else {
+            map[key] += i;
+            expected[key] += i;
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    size_t num_iterated = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(expected.at(key), value);
+        ++num_iterated;
+    }
+    EXPECT_EQ(num_iterated, expected.size());
+}
+
+TEST(flat_hash_map, field_keys)
+{
+    FlatHashMap<fr, uint32_t> map;
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.insert({ fr(i) * fr(i), i });
+    }
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.at(fr(i) * fr(i)), i);
+    }
+    // Unreduced representations of an element must find the same entry
+    const fr reduced = fr(5).reduce_once();
+    const uint256_t shifted =
+        uint256_t(reduced.data[0], reduced.data[1], reduced.data[2], reduced.data[3]) + fr::modulus;
+    fr unreduced;
+    for (size_t i = 0; i < 4; ++i) {
+        unreduced.data[i] = shifted.data[i];
+    }
+    EXPECT_EQ(unreduced, fr(5));
+    EXPECT_FALSE(map.contains(fr(5)));
+    map[fr(5)] = 42;
+    EXPECT_EQ(map.at(unreduced), 42U);
+}
+
+TEST(flat_hash_map, equality_ignores_layout)
+{
+    FlatHashMap<uint32_t, uint32_t> a;
+    FlatHashMap<uint32_t, uint32_t> b;
+    b.reserve(1024);
+    for (uint32_t i = 0; i < 100; ++i) {
+        a[i] = i;
+        b[99 - i] = 99 - i;
+    }
+    EXPECT_TRUE(a == b);
+    b[0] = 1;
+    EXPECT_FALSE(a == b);
+}
@@ -2,12 +2,85 @@
 #include "log.hpp"
 #include "memory.h"
 #include "wasm_export.hpp"
+#include <atomic>
 #include <cstdlib>
 #include <memory>
-// #include <malloc.h>
+#if defined(__linux__) && !defined(__wasm__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
 
 #define pad(size, alignment) (size - (size % alignment) + ((size % alignment) == 0 ? 0 : alignment))
 
+namespace barretenberg {
+
+/**
+ * Accounting of the memory allocated through aligned_alloc, which backs polynomials (via the slab allocator),
+ * Pippenger runtime states and the other large buffers of the provers. Sizes are the usable sizes reported by the
+ * system allocator, so an allocation and its free always cancel out. On platforms without such a query (wasm,
+ * Windows) nothing is counted.
+ */
+namespace memory_accounting {
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+inline std::atomic<size_t> live_bytes = 0;
+inline std::atomic<size_t> peak_bytes = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+inline size_t usable_size([[maybe_unused]] void* mem)
+{
+#if defined(__linux__) && !defined(__wasm__)
+    return malloc_usable_size(mem);
+#elif defined(__APPLE__)
+    return malloc_size(mem);
+#else
+    return 0;
+#endif
+}
+
+inline void record_allocation(void* mem)
+{
+    const size_t size = usable_size(mem);
+    const size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+inline void record_free(void* mem)
+{
+    if (mem != nullptr) {
+        live_bytes.fetch_sub(usable_size(mem), std::memory_order_relaxed);
+    }
+}
+} // namespace memory_accounting
+
+/**
+ * @brief The number of bytes currently allocated through aligned_alloc
+ */
+inline size_t get_allocated_bytes()
+{
+    return memory_accounting::live_bytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief The most bytes allocated through aligned_alloc at any one time since the last reset (process wide)
+ */
+inline size_t get_peak_allocated_bytes()
+{
+    return memory_accounting::peak_bytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Resets the peak to the number of bytes allocated now, to measure the peak of a phase of a computation
+ */
+inline void reset_peak_allocated_bytes()
+{
+    memory_accounting::peak_bytes.store(get_allocated_bytes(), std::memory_order_relaxed);
+}
+
+} // namespace barretenberg
+
 #ifdef __APPLE__
 inline void* aligned_alloc(size_t alignment, size_t size)
 {
@@ -17,11 +90,13 @@ inline void* aligned_alloc(size_t alignment, size_t size)
         info("bad alloc of size: ", size);
         std::abort();
     }
+    barretenberg::memory_accounting::record_allocation(t);
     return t;
 }
 
 inline void aligned_free(void* mem)
 {
+    barretenberg::memory_accounting::record_free(mem);
     free(mem);
 }
 #endif
@@ -37,6 +112,7 @@ inline void* protected_aligned_alloc(size_t alignment, size_t size)
         info("bad alloc of size: ", size);
         std::abort();
     }
+    barretenberg::memory_accounting::record_allocation(t);
     return t;
 }
 
@@ -44,6 +120,7 @@ inline void* protected_aligned_alloc(size_t alignment, size_t size)
 
 inline void aligned_free(void* mem)
 {
+    barretenberg::memory_accounting::record_free(mem);
     // NOLINTNEXTLINE(cppcoreguidelines-owning-memory, cppcoreguidelines-no-malloc)
     free(mem);
 }
@@ -0,0 +1,66 @@
+#pragma once
+#include "log.hpp"
+#include "mem.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * @brief The memory allocated through aligned_alloc during one phase of a computation (e.g. a prover round)
+ */
+struct PhaseMemoryUsage {
+    std::string phase;
+    // The most bytes allocated at once during the phase
+    size_t peak_bytes = 0;
+    // The bytes still allocated at the end of the phase
+    size_t live_bytes = 0;
+};
+
+/**
+ * @brief Records the peak and live memory of the phases of a computation, in order.
+ *
+ * @details A phase is bracketed by start_phase and end_phase. The counters in mem.hpp are process wide, so a phase's
+ * peak includes whatever other threads (or concurrently running provers) allocate meanwhile.
+ */
+class MemoryReport {
+  public:
+    std::vector<PhaseMemoryUsage> phases;
+
+    void start_phase() { reset_peak_allocated_bytes(); }
+
+    void end_phase(std::string phase)
+    {
+        phases.push_back({ std::move(phase), get_peak_allocated_bytes(), get_allocated_bytes() });
+    }
+
+    void clear() { phases.clear(); }
+
+    /**
+     * @brief The largest peak over all phases
+     */
+    size_t get_peak_bytes() const
+    {
+        size_t peak = 0;
+        for (auto const& usage : phases) {
+            peak = std::max(peak, usage.peak_bytes);
+        }
+        return peak;
+    }
+
+    void print() const
+    {
+        constexpr double MIB = 1024.0 * 1024.0;
+        for (auto const& usage : phases) {
+            info(usage.phase,
+                 ": peak ",
+                 static_cast<double>(usage.peak_bytes) / MIB,
+                 " MiB, live ",
+                 static_cast<double>(usage.live_bytes) / MIB,
+                 " MiB");
+        }
+    }
+};
+
+} // namespace barretenberg
@@ -0,0 +1,28 @@
+#include "memory_report.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+TEST(memory_report, counts_aligned_allocations)
+{
+    constexpr size_t SIZE = 1UL << 20;
+    const size_t allocated = get_allocated_bytes();
+
+    void* outer = aligned_alloc(64, SIZE);
+    EXPECT_GE(get_allocated_bytes(), allocated + SIZE);
+
+    MemoryReport report;
+    report.start_phase();
+    void* inner = aligned_alloc(64, SIZE);
+    aligned_free(inner);
+    report.end_phase("phase");
+
+    ASSERT_EQ(report.phases.size(), 1UL);
+    EXPECT_EQ(report.phases[0].phase, "phase");
+    EXPECT_EQ(report.phases[0].live_bytes, get_allocated_bytes());
+    EXPECT_GE(report.phases[0].peak_bytes, report.phases[0].live_bytes + SIZE);
+    EXPECT_EQ(report.get_peak_bytes(), report.phases[0].peak_bytes);
+
+    aligned_free(outer);
+    EXPECT_EQ(get_allocated_bytes(), allocated);
+}
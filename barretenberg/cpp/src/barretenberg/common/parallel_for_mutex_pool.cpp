@@ -1,20 +1,52 @@
 #include "log.hpp"
 #include "thread.hpp"
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "barretenberg/common/compiler_hints.hpp"
 
 namespace {
 
+// Set while a thread runs an iteration of a pool task, so that a nested parallel_for can run inline
+thread_local bool in_pool_task = false;
+
+/**
+ * Sets a (thread-local) variable for the lifetime of the guard, and restores its previous value on the way out, even
+ * if a task throws
+ */
+template <typename T> class ScopedValue {
+  public:
+    ScopedValue(T& variable, T value)
+        : variable_(variable)
+        , previous_(std::exchange(variable, value))
+    {}
+    ScopedValue(const ScopedValue& other) = delete;
+    ScopedValue(ScopedValue&& other) = delete;
+    ~ScopedValue() { variable_ = previous_; }
+
+    ScopedValue& operator=(const ScopedValue& other) = delete;
+    ScopedValue& operator=(ScopedValue&& other) = delete;
+
+  private:
+    T& variable_;
+    T previous_;
+};
+
 class ThreadPool {
   public:
-    ThreadPool(size_t num_threads);
+    /**
+     * The workers of a thread group's pool report the size of the group from get_num_cpus(), like the thread that runs
+     * the group's task
+     */
+    ThreadPool(size_t num_threads, size_t group_num_threads = 0);
     ThreadPool(const ThreadPool& other) = delete;
     ThreadPool(ThreadPool&& other) = delete;
     ~ThreadPool();
@@ -22,6 +54,38 @@ class ThreadPool {
     ThreadPool& operator=(const ThreadPool& other) = delete;
     ThreadPool& operator=(ThreadPool&& other) = delete;
 
+    /**
+     * Runs the task on the pool, unless another thread is already running one, in which case it returns false
+     */
+    bool try_start_tasks(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        if (busy.exchange(true)) {
+            return false;
+        }
+        // The pool is released even if the task throws
+        struct ReleaseBusy {
+            std::atomic<bool>& busy;
+            ~ReleaseBusy() { busy = false; }
+        } release_busy{ busy };
+        start_tasks(num_iterations, func);
+        return true;
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::mutex tasks_mutex;
+    std::function<void(size_t)> task_;
+    size_t num_iterations_ = 0;
+    size_t iteration_ = 0;
+    size_t complete_ = 0;
+    std::exception_ptr exception_;
+    std::condition_variable condition;
+    std::condition_variable complete_condition_;
+    bool stop = false;
+    std::atomic<bool> busy = false;
+
+    BBERG_NO_PROFILE void worker_loop(size_t group_num_threads);
+
     void start_tasks(size_t num_iterations, const std::function<void(size_t)>& func)
     {
         {
@@ -30,30 +94,27 @@ class ThreadPool {
             num_iterations_ = num_iterations;
             iteration_ = 0;
             complete_ = 0;
+            exception_ = nullptr;
         }
         condition.notify_all();
 
         do_iterations();
 
+        std::exception_ptr exception;
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
             complete_condition_.wait(lock, [this] { return complete_ == num_iterations_; });
+            exception = std::exchange(exception_, nullptr);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
         }
     }
 
-  private:
-    std::vector<std::thread> workers;
-    std::mutex tasks_mutex;
-    std::function<void(size_t)> task_;
-    size_t num_iterations_ = 0;
-    size_t iteration_ = 0;
-    size_t complete_ = 0;
-    std::condition_variable condition;
-    std::condition_variable complete_condition_;
-    bool stop = false;
-
-    BBERG_NO_PROFILE void worker_loop(size_t thread_index);
-
+    /**
+     * An iteration that throws still counts as complete, so that the thread that started the task stops waiting for
+     * it, and the first exception is rethrown by that thread
+     */
     void do_iterations()
     {
         while (true) {
@@ -65,9 +126,18 @@ class ThreadPool {
                 }
                 iteration = iteration_++;
             }
-            task_(iteration);
+            std::exception_ptr exception;
+            try {
+                ScopedValue<bool> scoped_in_pool_task(in_pool_task, true);
+                task_(iteration);
+            } catch (...) {
+                exception = std::current_exception();
+            }
             {
                 std::unique_lock<std::mutex> lock(tasks_mutex);
+                if (exception && !exception_) {
+                    exception_ = exception;
+                }
                 if (++complete_ == num_iterations_) {
                     complete_condition_.notify_one();
                     return;
@@ -77,11 +147,11 @@ class ThreadPool {
     }
 };
 
-ThreadPool::ThreadPool(size_t num_threads)
+ThreadPool::ThreadPool(size_t num_threads, size_t group_num_threads)
 {
     workers.reserve(num_threads);
     for (size_t i = 0; i < num_threads; ++i) {
-        workers.emplace_back(&ThreadPool::worker_loop, this, i);
+        workers.emplace_back(&ThreadPool::worker_loop, this, group_num_threads);
     }
 }
 
@@ -97,9 +167,10 @@ ThreadPool::~ThreadPool()
     }
 }
 
-void ThreadPool::worker_loop(size_t /*unused*/)
+void ThreadPool::worker_loop(size_t group_num_threads)
 {
     // info("created worker ", worker_num);
+    thread_group_num_threads = group_num_threads;
     while (true) {
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
@@ -113,17 +184,90 @@ void ThreadPool::worker_loop(size_t /*unused*/)
     }
     // info("worker exit ", worker_num);
 }
+
+// The pool of the thread group the calling thread runs a task for, if any
+thread_local ThreadPool* thread_group_pool = nullptr;
+
+ThreadPool& get_pool()
+{
+    if (thread_group_pool != nullptr) {
+        return *thread_group_pool;
+    }
+    // Sized for the whole machine, even if it is first used from within a thread group
+    static ThreadPool pool(env_hardware_concurrency() - 1);
+    return pool;
+}
+
+/**
+ * Runs a task on the calling thread as the first thread of a group of num_threads threads, whose other threads are
+ * those of a pool of its own
+ */
+void run_in_thread_group(size_t num_threads, const std::function<void()>& task)
+{
+    ThreadPool pool(num_threads - 1, num_threads);
+    ScopedValue<ThreadPool*> scoped_pool(thread_group_pool, &pool);
+    ScopedValue<size_t> scoped_num_threads(thread_group_num_threads, num_threads);
+    task();
+}
 } // namespace
 
 /**
  * A thread pooled strategy that uses std::mutex for protection. Each worker increments the "iteration" and processes.
  * The main thread acts as a worker also, and when it completes, it spins until thread workers are done.
+ *
+ * A pool runs one task at a time. A parallel_for nested in a pool task runs inline, as the pool's threads are busy
+ * with the enclosing loop, and so does one called from another thread while the pool is busy. Work that is meant to
+ * run alongside other work gets a pool of its own with parallel_invoke_in_thread_groups.
  */
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
-    static ThreadPool pool(get_num_cpus() - 1);
-
+    if (num_iterations == 0) {
+        return;
+    }
     // info("starting job with iterations: ", num_iterations);
-    pool.start_tasks(num_iterations, func);
+    if (in_pool_task || !get_pool().try_start_tasks(num_iterations, func)) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+    }
     // info("done");
 }
+
+/**
+ * The second group's task runs on a new thread. The thread groups' pools are started for the call and stopped at the
+ * end of it, which costs a thread start per thread, so this is meant for coarse tasks such as the rounds of a prover.
+ */
+void parallel_invoke_in_thread_groups_mutex_pool(size_t first_num_threads,
+                                                 const std::function<void()>& first,
+                                                 const std::function<void()>& second)
+{
+    const size_t num_threads = get_num_cpus();
+    if (num_threads < 2 || in_pool_task) {
+        first();
+        second();
+        return;
+    }
+    first_num_threads = std::clamp<size_t>(first_num_threads, 1, num_threads - 1);
+
+    std::exception_ptr second_exception;
+    std::thread second_thread([&]() {
+        try {
+            run_in_thread_group(num_threads - first_num_threads, second);
+        } catch (...) {
+            second_exception = std::current_exception();
+        }
+    });
+    std::exception_ptr first_exception;
+    try {
+        run_in_thread_group(first_num_threads, first);
+    } catch (...) {
+        first_exception = std::current_exception();
+    }
+    second_thread.join();
+
+    for (const auto& exception : { first_exception, second_exception }) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
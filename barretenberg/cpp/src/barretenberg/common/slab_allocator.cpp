@@ -22,6 +22,10 @@ bool allocator_destroyed = false;
 // Slabs that are being manually managed by the user.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::unordered_map<void*, std::shared_ptr<void>> manual_slabs;
+#ifndef NO_MULTITHREADING
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex manual_slabs_mutex;
+#endif
 
 template <typename... Args> inline void dbg_info(Args... args)
 {
@@ -219,6 +223,9 @@ std::shared_ptr<void> get_mem_slab(size_t size)
 void* get_mem_slab_raw(size_t size)
 {
     auto slab = get_mem_slab(size);
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(manual_slabs_mutex);
+#endif
     manual_slabs[slab.get()] = slab;
     return slab.get();
 }
@@ -229,6 +236,18 @@ void free_mem_slab_raw(void* p)
         aligned_free(p);
         return;
     }
-    manual_slabs.erase(p);
+    // Release the slab outside of the lock, as returning it to the allocator takes the allocator's own lock
+    std::shared_ptr<void> slab;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(manual_slabs_mutex);
+#endif
+        auto it = manual_slabs.find(p);
+        if (it == manual_slabs.end()) {
+            return;
+        }
+        slab = std::move(it->second);
+        manual_slabs.erase(it);
+    }
 }
 } // namespace barretenberg
@@ -68,6 +68,12 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_invoke_in_thread_groups_mutex_pool(size_t first_num_threads,
+                                                 const std::function<void()>& first,
+                                                 const std::function<void()>& second);
+
+thread_local size_t thread_group_num_threads = 0;
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -85,4 +91,17 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
-}
\ No newline at end of file
+}
+
+void parallel_invoke_in_thread_groups(size_t first_num_threads,
+                                      const std::function<void()>& first,
+                                      const std::function<void()>& second)
+{
+#if defined(NO_MULTITHREADING) || !defined(NO_OMP_MULTITHREADING)
+    (void)first_num_threads;
+    first();
+    second();
+#else
+    parallel_invoke_in_thread_groups_mutex_pool(first_num_threads, first, second);
+#endif
+}
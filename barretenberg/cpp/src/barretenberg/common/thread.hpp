@@ -7,12 +7,16 @@
 #include <thread>
 #include <vector>
 
+// The number of threads of the thread group the calling thread works for (see parallel_invoke_in_thread_groups), or 0
+// outside of thread groups
+extern thread_local size_t thread_group_num_threads;
+
 inline size_t get_num_cpus()
 {
 #ifdef NO_MULTITHREADING
     return 1;
 #else
-    return env_hardware_concurrency();
+    return thread_group_num_threads != 0 ? thread_group_num_threads : env_hardware_concurrency();
 #endif
 }
 
@@ -23,3 +27,14 @@ inline size_t get_num_cpus_pow2()
 }
 
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * Runs `first` and `second` concurrently on two separate groups of threads, the first of first_num_threads threads and
+ * the second of the rest of get_num_cpus(). While each runs, get_num_cpus() returns the size of its group and
+ * parallel_for runs on the group's threads only, so that work sized by get_num_cpus() (e.g. FFTs and Pippenger) does
+ * not oversubscribe the cores. With fewer than two threads, or OpenMP (which sizes its own teams), they run one after
+ * the other. An exception thrown by either is rethrown once both are done.
+ */
+void parallel_invoke_in_thread_groups(size_t first_num_threads,
+                                      const std::function<void()>& first,
+                                      const std::function<void()>& second);
@@ -0,0 +1,91 @@
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+namespace {
+// Runs a parallel_for with enough work per iteration to spread over the pool, and returns the threads it ran on
+std::set<std::thread::id> get_parallel_for_threads()
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    parallel_for(64, [&](size_t /*unused*/) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+    return threads;
+}
+} // namespace
+
+// Ensure that the two tasks run at the same time, each with its own group of threads
+TEST(thread, parallel_invoke_in_thread_groups)
+{
+    const size_t num_threads = get_num_cpus();
+    if (num_threads < 2) {
+        GTEST_SKIP() << "needs at least two threads (e.g. HARDWARE_CONCURRENCY=4)";
+    }
+    std::atomic<size_t> num_started = 0;
+    // Each task waits (for a while) for the other to have started
+    const auto wait_for_both = [&]() {
+        ++num_started;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (num_started < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        return num_started == 2;
+    };
+    bool first_overlapped = false;
+    bool second_overlapped = false;
+    size_t first_num_cpus = 0;
+    size_t second_num_cpus = 0;
+    std::set<std::thread::id> first_threads;
+    std::set<std::thread::id> second_threads;
+    parallel_invoke_in_thread_groups(
+        1,
+        [&]() {
+            first_overlapped = wait_for_both();
+            first_num_cpus = get_num_cpus();
+            first_threads = get_parallel_for_threads();
+        },
+        [&]() {
+            second_overlapped = wait_for_both();
+            second_num_cpus = get_num_cpus();
+            second_threads = get_parallel_for_threads();
+        });
+
+    EXPECT_TRUE(first_overlapped);
+    EXPECT_TRUE(second_overlapped);
+    EXPECT_EQ(first_num_cpus, 1UL);
+    EXPECT_EQ(second_num_cpus, num_threads - 1);
+    EXPECT_EQ(first_threads.size(), 1UL);
+    EXPECT_LE(second_threads.size(), num_threads - 1);
+    for (const auto& thread : first_threads) {
+        EXPECT_FALSE(second_threads.contains(thread));
+    }
+    EXPECT_EQ(get_num_cpus(), num_threads);
+}
+
+#ifdef NO_OMP_MULTITHREADING
+// Ensure that an exception thrown by an iteration reaches the caller, and leaves the pool usable by later loops
+TEST(thread, parallel_for_rethrows)
+{
+    EXPECT_THROW(parallel_for(16,
+                              [](size_t i) {
+                                  if (i == 7) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                              }),
+                 std::runtime_error);
+    EXPECT_THROW(parallel_invoke_in_thread_groups(
+                     1, []() {}, []() { throw std::runtime_error("group failed"); }),
+                 std::runtime_error);
+
+    const size_t expected_num_threads = std::min(get_num_cpus(), size_t(2));
+    EXPECT_GE(get_parallel_for_threads().size(), expected_num_threads);
+}
+#endif
@@ -1,3 +1,5 @@
+#pragma once
+
 #include "thread.hpp"
 
 namespace barretenberg::thread_utils {
@@ -20,6 +20,8 @@
 #include "blake2-impl.hpp"
 #include "blake2s.hpp"
 
+#include "barretenberg/common/assert.hpp"
+
 namespace blake2 {
 
 static const uint32_t blake2s_IV[8] = { 0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
@@ -233,4 +235,173 @@ std::array<uint8_t, BLAKE2S_OUTBYTES> blake2s(std::vector<uint8_t> const& input)
     return output;
 }
 
+namespace {
+using crypto::multi_buffer::Backend;
+using crypto::multi_buffer::BLOCK_SIZE;
+using crypto::multi_buffer::BlockView;
+using Output = std::array<uint8_t, BLAKE2S_OUTBYTES>;
+
+uint32_t load_le32(const uint8_t* src)
+{
+    return load32(src);
+}
+
+void store_le32(uint8_t* dst, const uint32_t word)
+{
+    store32(dst, word);
+}
+
+// blake2s_update keeps the last block, even when it is full, for blake2s_final, so there is always at least one block
+size_t num_blocks(const size_t length)
+{
+    return length == 0 ? 1 : (length + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+BlockView message_blocks(const std::vector<uint8_t>& input)
+{
+    BlockView view;
+    view.data = input.data();
+    view.num_full_blocks = num_blocks(input.size()) - 1;
+    const size_t offset = view.num_full_blocks * BLOCK_SIZE;
+    std::copy_n(input.data() + offset, input.size() - offset, view.tail.begin());
+    return view;
+}
+
+/**
+ * @brief Unkeyed 32-byte Blake2s of LANES messages that have the same number of blocks, one message per lane of Vec.
+ * Follows blake2s_init / blake2s_update / blake2s_final: the counter of a block is the number of message bytes up to
+ * the end of it, and the final block sets f[0].
+ */
+template <typename Vec, size_t LANES>
+BBERG_INLINE void blake2s_lanes(const std::array<BlockView, LANES>& messages,
+                                const std::array<size_t, LANES>& lengths,
+                                const size_t num_message_blocks,
+                                const std::array<uint8_t*, LANES>& outputs)
+{
+    // parameter block of blake2s_init: digest length 32, no key, fanout 1, depth 1
+    std::array<Vec, 8> h;
+    for (size_t i = 0; i < 8; ++i) {
+        h[i] = Vec{} + blake2s_IV[i];
+    }
+    h[0] ^= 0x01010000U | BLAKE2S_OUTBYTES;
+
+    std::array<Vec, 16> m{};
+    std::array<Vec, 16> v{};
+    std::array<const uint8_t*, LANES> blocks;
+    for (size_t block = 0; block < num_message_blocks; ++block) {
+        const bool is_last = block + 1 == num_message_blocks;
+        std::array<uint32_t, LANES> counter_lo;
+        std::array<uint32_t, LANES> counter_hi;
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            blocks[lane] = messages[lane].block(block);
+            const uint64_t counter = is_last ? lengths[lane] : (block + 1) * BLOCK_SIZE;
+            counter_lo[lane] = static_cast<uint32_t>(counter);
+            counter_hi[lane] = static_cast<uint32_t>(counter >> 32);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            crypto::multi_buffer::gather_word(m[i], blocks, i, load_le32);
+        }
+
+        for (size_t i = 0; i < 8; ++i) {
+            v[i] = h[i];
+            v[i + 8] = Vec{} + blake2s_IV[i];
+        }
+        Vec t0;
+        Vec t1;
+        std::copy_n(reinterpret_cast<const uint8_t*>(counter_lo.data()), sizeof(Vec), reinterpret_cast<uint8_t*>(&t0));
+        std::copy_n(reinterpret_cast<const uint8_t*>(counter_hi.data()), sizeof(Vec), reinterpret_cast<uint8_t*>(&t1));
+        v[12] ^= t0;
+        v[13] ^= t1;
+        if (is_last) {
+            v[14] = ~v[14];
+        }
+
+        for (size_t round = 0; round < 10; ++round) {
+            const uint8_t* sigma = blake2s_sigma[round];
+            using crypto::multi_buffer::blake_g;
+            blake_g(v, 0, 4, 8, 12, m[sigma[0]], m[sigma[1]]);
+            blake_g(v, 1, 5, 9, 13, m[sigma[2]], m[sigma[3]]);
+            blake_g(v, 2, 6, 10, 14, m[sigma[4]], m[sigma[5]]);
+            blake_g(v, 3, 7, 11, 15, m[sigma[6]], m[sigma[7]]);
+            blake_g(v, 0, 5, 10, 15, m[sigma[8]], m[sigma[9]]);
+            blake_g(v, 1, 6, 11, 12, m[sigma[10]], m[sigma[11]]);
+            blake_g(v, 2, 7, 8, 13, m[sigma[12]], m[sigma[13]]);
+            blake_g(v, 3, 4, 9, 14, m[sigma[14]], m[sigma[15]]);
+        }
+
+        for (size_t i = 0; i < 8; ++i) {
+            h[i] ^= v[i] ^ v[i + 8];
+        }
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        crypto::multi_buffer::scatter_word(h[i], outputs, i, store_le32);
+    }
+}
+
+#ifdef BBERG_MULTI_BUFFER_X86
+__attribute__((target("avx2"))) void blake2s_x8(const std::array<BlockView, 8>& messages,
+                                                const std::array<size_t, 8>& lengths,
+                                                size_t num_message_blocks,
+                                                const std::array<uint8_t*, 8>& outputs)
+{
+    blake2s_lanes<crypto::multi_buffer::u32x8, 8>(messages, lengths, num_message_blocks, outputs);
+}
+
+__attribute__((target("avx512f"))) void blake2s_x16(const std::array<BlockView, 16>& messages,
+                                                    const std::array<size_t, 16>& lengths,
+                                                    size_t num_message_blocks,
+                                                    const std::array<uint8_t*, 16>& outputs)
+{
+    blake2s_lanes<crypto::multi_buffer::u32x16, 16>(messages, lengths, num_message_blocks, outputs);
+}
+#endif
+
+template <size_t LANES, typename HashLanes>
+void blake2s_many_lanes(const std::vector<std::vector<uint8_t>>& inputs,
+                        std::vector<Output>& outputs,
+                        HashLanes hash_lanes)
+{
+    crypto::multi_buffer::for_each_group<LANES>(
+        inputs, num_blocks, [&](const std::array<size_t, LANES>& indices, size_t num_message_blocks) {
+            std::array<BlockView, LANES> messages;
+            std::array<size_t, LANES> lengths;
+            std::array<uint8_t*, LANES> lane_outputs;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                messages[lane] = message_blocks(inputs[indices[lane]]);
+                lengths[lane] = inputs[indices[lane]].size();
+                lane_outputs[lane] = outputs[indices[lane]].data();
+            }
+            hash_lanes(messages, lengths, num_message_blocks, lane_outputs);
+        });
+}
+} // namespace
+
+std::vector<Output> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    static const Backend backend =
+        crypto::multi_buffer::select_backend(std::array<Backend, 2>{ Backend::AVX512, Backend::AVX2 });
+    return blake2s_many(inputs, backend);
+}
+
+std::vector<Output> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs, const Backend backend)
+{
+    ASSERT(crypto::multi_buffer::is_supported(backend));
+    std::vector<Output> outputs(inputs.size());
+    switch (backend) {
+#ifdef BBERG_MULTI_BUFFER_X86
+    case Backend::AVX2:
+        blake2s_many_lanes<8>(inputs, outputs, blake2s_x8);
+        break;
+    case Backend::AVX512:
+        blake2s_many_lanes<16>(inputs, outputs, blake2s_x16);
+        break;
+#endif
+    default:
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = blake2s(inputs[i]);
+        }
+    }
+    return outputs;
+}
+
 } // namespace blake2
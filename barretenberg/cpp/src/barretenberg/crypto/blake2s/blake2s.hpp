@@ -19,6 +19,8 @@
 #include <cstdint>
 #include <vector>
 
+#include "barretenberg/crypto/multi_buffer/multi_buffer.hpp"
+
 namespace blake2 {
 
 #if defined(_MSC_VER)
@@ -73,4 +75,12 @@ int blake2s_final(blake2s_state* S, void* out, size_t outlen);
 
 std::array<uint8_t, BLAKE2S_OUTBYTES> blake2s(std::vector<uint8_t> const& input);
 
+/**
+ * @brief Hash many independent messages, with the same result as calling blake2s on each of them. Uses the fastest
+ * implementation supported by the CPU unless a backend is given.
+ */
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs);
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs,
+                                                                crypto::multi_buffer::Backend backend);
+
 } // namespace blake2
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "blake2s.hpp"
+#include "barretenberg/crypto/multi_buffer/multi_buffer.test.hpp"
 #include <gtest/gtest.h>
 
 #include <iostream>
@@ -384,4 +385,13 @@ TEST(misc_blake2s, test_vectors)
         std::vector<uint8_t> input(v.input.begin(), v.input.end());
         EXPECT_EQ(blake2::blake2s(input), v.output);
     }
-}
\ No newline at end of file
+}
+
+TEST(misc_blake2s, test_blake2s_many)
+{
+    using crypto::multi_buffer::Backend;
+    crypto::multi_buffer::test::check_hash_many(
+        { Backend::SCALAR, Backend::AVX2, Backend::AVX512 },
+        [](const auto&... args) { return blake2::blake2s_many(args...); },
+        [](const auto& input) { return blake2::blake2s(input); });
+}
@@ -0,0 +1,172 @@
+#include "blake3s.hpp"
+#include "barretenberg/common/assert.hpp"
+
+namespace blake3 {
+
+namespace {
+using crypto::multi_buffer::Backend;
+using crypto::multi_buffer::BLOCK_SIZE;
+using crypto::multi_buffer::BlockView;
+
+uint32_t load_le32(const uint8_t* src)
+{
+    return load32(src);
+}
+
+void store_le32(uint8_t* dst, const uint32_t word)
+{
+    store32(dst, word);
+}
+
+// blake3_hasher_update keeps the last block, even when it is full, for blake3_hasher_finalize
+size_t num_blocks(const size_t length)
+{
+    return length == 0 ? 1 : (length + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+BlockView message_blocks(const std::vector<uint8_t>& input)
+{
+    BlockView view;
+    view.data = input.data();
+    view.num_full_blocks = num_blocks(input.size()) - 1;
+    const size_t offset = view.num_full_blocks * BLOCK_SIZE;
+    std::copy_n(input.data() + offset, input.size() - offset, view.tail.begin());
+    return view;
+}
+
+/**
+ * @brief blake3s of LANES messages that have the same number of blocks, one message per lane of Vec. Follows
+ * blake3_hasher_update / blake3_hasher_finalize: every block is compressed into the chaining value with a zero counter,
+ * the first block is flagged CHUNK_START and the last one CHUNK_END | ROOT, with the number of bytes it holds as its
+ * block length.
+ */
+template <typename Vec, size_t LANES>
+BBERG_INLINE void blake3s_lanes(const std::array<BlockView, LANES>& messages,
+                                const std::array<size_t, LANES>& lengths,
+                                const size_t num_message_blocks,
+                                const std::array<uint8_t*, LANES>& outputs)
+{
+    std::array<Vec, 8> cv;
+    for (size_t i = 0; i < 8; ++i) {
+        cv[i] = Vec{} + IV[i];
+    }
+
+    std::array<Vec, 16> m{};
+    std::array<Vec, 16> v{};
+    std::array<const uint8_t*, LANES> blocks;
+    for (size_t block = 0; block < num_message_blocks; ++block) {
+        const bool is_last = block + 1 == num_message_blocks;
+        std::array<uint32_t, LANES> block_lengths;
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            blocks[lane] = messages[lane].block(block);
+            block_lengths[lane] = static_cast<uint32_t>(is_last ? lengths[lane] - block * BLOCK_SIZE : BLOCK_SIZE);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            crypto::multi_buffer::gather_word(m[i], blocks, i, load_le32);
+        }
+        uint32_t flags = block == 0 ? static_cast<uint32_t>(CHUNK_START) : 0U;
+        if (is_last) {
+            flags |= static_cast<uint32_t>(CHUNK_END | ROOT);
+        }
+
+        for (size_t i = 0; i < 8; ++i) {
+            v[i] = cv[i];
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            v[i + 8] = Vec{} + IV[i];
+        }
+        v[12] = Vec{};
+        v[13] = Vec{};
+        std::copy_n(reinterpret_cast<const uint8_t*>(block_lengths.data()),
+                    sizeof(Vec),
+                    reinterpret_cast<uint8_t*>(&v[14]));
+        v[15] = Vec{} + flags;
+
+        for (const auto& schedule : MSG_SCHEDULE) {
+            using crypto::multi_buffer::blake_g;
+            blake_g(v, 0, 4, 8, 12, m[schedule[0]], m[schedule[1]]);
+            blake_g(v, 1, 5, 9, 13, m[schedule[2]], m[schedule[3]]);
+            blake_g(v, 2, 6, 10, 14, m[schedule[4]], m[schedule[5]]);
+            blake_g(v, 3, 7, 11, 15, m[schedule[6]], m[schedule[7]]);
+            blake_g(v, 0, 5, 10, 15, m[schedule[8]], m[schedule[9]]);
+            blake_g(v, 1, 6, 11, 12, m[schedule[10]], m[schedule[11]]);
+            blake_g(v, 2, 7, 8, 13, m[schedule[12]], m[schedule[13]]);
+            blake_g(v, 3, 4, 9, 14, m[schedule[14]], m[schedule[15]]);
+        }
+
+        for (size_t i = 0; i < 8; ++i) {
+            cv[i] = v[i] ^ v[i + 8];
+        }
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        crypto::multi_buffer::scatter_word(cv[i], outputs, i, store_le32);
+    }
+}
+
+#ifdef BBERG_MULTI_BUFFER_X86
+__attribute__((target("avx2"))) void blake3s_x8(const std::array<BlockView, 8>& messages,
+                                                const std::array<size_t, 8>& lengths,
+                                                size_t num_message_blocks,
+                                                const std::array<uint8_t*, 8>& outputs)
+{
+    blake3s_lanes<crypto::multi_buffer::u32x8, 8>(messages, lengths, num_message_blocks, outputs);
+}
+
+__attribute__((target("avx512f"))) void blake3s_x16(const std::array<BlockView, 16>& messages,
+                                                    const std::array<size_t, 16>& lengths,
+                                                    size_t num_message_blocks,
+                                                    const std::array<uint8_t*, 16>& outputs)
+{
+    blake3s_lanes<crypto::multi_buffer::u32x16, 16>(messages, lengths, num_message_blocks, outputs);
+}
+#endif
+
+template <size_t LANES, typename HashLanes>
+void blake3s_many_lanes(const std::vector<std::vector<uint8_t>>& inputs,
+                        std::vector<out_array>& outputs,
+                        HashLanes hash_lanes)
+{
+    crypto::multi_buffer::for_each_group<LANES>(
+        inputs, num_blocks, [&](const std::array<size_t, LANES>& indices, size_t num_message_blocks) {
+            std::array<BlockView, LANES> messages;
+            std::array<size_t, LANES> lengths;
+            std::array<uint8_t*, LANES> lane_outputs;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                messages[lane] = message_blocks(inputs[indices[lane]]);
+                lengths[lane] = inputs[indices[lane]].size();
+                lane_outputs[lane] = outputs[indices[lane]].data();
+            }
+            hash_lanes(messages, lengths, num_message_blocks, lane_outputs);
+        });
+}
+} // namespace
+
+std::vector<out_array> blake3s_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    static const Backend backend =
+        crypto::multi_buffer::select_backend(std::array<Backend, 2>{ Backend::AVX512, Backend::AVX2 });
+    return blake3s_many(inputs, backend);
+}
+
+std::vector<out_array> blake3s_many(const std::vector<std::vector<uint8_t>>& inputs, const Backend backend)
+{
+    ASSERT(crypto::multi_buffer::is_supported(backend));
+    std::vector<out_array> outputs(inputs.size());
+    switch (backend) {
+#ifdef BBERG_MULTI_BUFFER_X86
+    case Backend::AVX2:
+        blake3s_many_lanes<8>(inputs, outputs, blake3s_x8);
+        break;
+    case Backend::AVX512:
+        blake3s_many_lanes<16>(inputs, outputs, blake3s_x16);
+        break;
+#endif
+    default:
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = blake3s_constexpr(inputs[i].data(), inputs[i].size());
+        }
+    }
+    return outputs;
+}
+
+} // namespace blake3
@@ -34,6 +34,8 @@
 #include <string>
 #include <vector>
 
+#include "barretenberg/crypto/multi_buffer/multi_buffer.hpp"
+
 namespace blake3 {
 
 // internal flags
@@ -108,6 +110,14 @@ constexpr void blake3_compress_xof(
 constexpr std::array<uint8_t, BLAKE3_OUT_LEN> blake3s_constexpr(const uint8_t* input, size_t input_size);
 inline std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input);
 
+/**
+ * @brief Hash many independent messages, with the same result as calling blake3s on each of them. Uses the fastest
+ * implementation supported by the CPU unless a backend is given.
+ */
+std::vector<out_array> blake3s_many(const std::vector<std::vector<uint8_t>>& inputs);
+std::vector<out_array> blake3s_many(const std::vector<std::vector<uint8_t>>& inputs,
+                                    crypto::multi_buffer::Backend backend);
+
 } // namespace blake3
 
 #include "blake3-impl.hpp"
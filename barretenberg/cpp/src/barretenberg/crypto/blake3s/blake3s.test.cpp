@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/crypto/multi_buffer/multi_buffer.test.hpp"
 #include <array>
 #include <iostream>
 #include <memory>
@@ -412,3 +413,12 @@ TEST(MiscBlake3s, TestVectors)
         static_assert(result_constexpr == v.output);
     });
 }
+
+TEST(MiscBlake3s, Blake3sMany)
+{
+    using crypto::multi_buffer::Backend;
+    crypto::multi_buffer::test::check_hash_many(
+        { Backend::SCALAR, Backend::AVX2, Backend::AVX512 },
+        [](const auto&... args) { return blake3::blake3s_many(args...); },
+        [](const auto& input) { return blake3::blake3s(input); });
+}
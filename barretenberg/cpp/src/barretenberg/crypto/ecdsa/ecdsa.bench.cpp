@@ -0,0 +1,67 @@
+#include "ecdsa.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+using Fq = secp256k1::fq;
+using Fr = secp256k1::fr;
+using G1 = secp256k1::g1;
+
+struct SignedMessages {
+    std::vector<std::string> messages;
+    std::vector<G1::affine_element> public_keys;
+    std::vector<crypto::ecdsa::signature> signatures;
+
+    explicit SignedMessages(const size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            crypto::ecdsa::key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.push_back("transaction " + std::to_string(i));
+            public_keys.push_back(account.public_key);
+            signatures.push_back(crypto::ecdsa::construct_signature<Sha256Hasher, Fq, Fr, G1>(messages[i], account));
+        }
+    }
+};
+
+void set_signature_rate(State& state)
+{
+    state.counters["signatures"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(state.range(0)), Counter::kIsRate);
+}
+} // namespace
+
+/**
+ * @brief Baseline: verify secp256k1 signatures one at a time
+ */
+void ecdsa_verify_bench(State& state) noexcept
+{
+    const SignedMessages batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch.signatures.size(); ++i) {
+            DoNotOptimize(crypto::ecdsa::verify_signature<Sha256Hasher, Fq, Fr, G1>(
+                batch.messages[i], batch.public_keys[i], batch.signatures[i]));
+        }
+    }
+    set_signature_rate(state);
+}
+BENCHMARK(ecdsa_verify_bench)->Arg(1024)->Unit(kMillisecond);
+
+/**
+ * @brief Verify the same signatures with batch_verify_signatures
+ */
+void ecdsa_batch_verify_bench(State& state) noexcept
+{
+    const SignedMessages batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::ecdsa::batch_verify_signatures<Sha256Hasher, Fq, Fr, G1>(
+            batch.messages, batch.public_keys, batch.signatures));
+    }
+    set_signature_rate(state);
+}
+BENCHMARK(ecdsa_batch_verify_bench)->Arg(1024)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include <array>
 #include <string>
+#include <vector>
 
 namespace crypto {
 namespace ecdsa {
@@ -36,6 +37,11 @@ bool verify_signature(const std::string& message,
                       const typename G1::affine_element& public_key,
                       const signature& signature);
 
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> batch_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<signature>& signatures);
+
 inline bool operator==(signature const& lhs, signature const& rhs)
 {
     return lhs.r == rhs.r && lhs.s == rhs.s && lhs.v == rhs.v;
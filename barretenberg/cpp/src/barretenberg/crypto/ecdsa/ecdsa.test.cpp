@@ -91,6 +91,59 @@ TEST(ecdsa, recover_public_key_secp256r1_sha256)
     EXPECT_EQ(recovered_public_key, account.public_key);
 }
 
+template <typename Curve> void test_batch_verify_signatures()
+{
+    using Fq = typename Curve::BaseField;
+    using Fr = typename Curve::ScalarField;
+    using G1 = typename Curve::Group;
+    constexpr size_t num_signatures = 20;
+
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<crypto::ecdsa::signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        crypto::ecdsa::key_pair<Fr, G1> account;
+        account.private_key = Fr::random_element();
+        account.public_key = G1::one * account.private_key;
+        messages.push_back("message " + std::to_string(i));
+        public_keys.push_back(account.public_key);
+        signatures.push_back(crypto::ecdsa::construct_signature<Sha256Hasher, Fq, Fr, G1>(messages[i], account));
+    }
+
+    // wrong message, wrong key, tampered r, zero s and a public key that is not on the curve
+    messages[2] = "another message";
+    public_keys[5] = G1::one * Fr::random_element();
+    signatures[8].r[31] ^= 1;
+    signatures[13].s.fill(0);
+    public_keys[19].x += 1;
+
+    const auto results =
+        crypto::ecdsa::batch_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures);
+    ASSERT_EQ(results.size(), num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const bool expected =
+            crypto::ecdsa::verify_signature<Sha256Hasher, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]);
+        EXPECT_EQ(results[i], expected) << "signature " << i;
+        EXPECT_EQ(results[i], i != 2 && i != 5 && i != 8 && i != 13 && i != 19);
+    }
+
+    // a signature whose s value is not low is reported as invalid
+    Fr s = Fr::serialize_from_buffer(&signatures[0].s[0]);
+    Fr::serialize_to_buffer(-s, &signatures[0].s[0]);
+    EXPECT_FALSE(
+        (crypto::ecdsa::batch_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures)[0]));
+}
+
+TEST(ecdsa, batch_verify_signatures_secp256k1_sha256)
+{
+    test_batch_verify_signatures<curve::SECP256K1>();
+}
+
+TEST(ecdsa, batch_verify_signatures_secp256r1_sha256)
+{
+    test_batch_verify_signatures<curve::SECP256R1>();
+}
+
 std::vector<uint8_t> HexToBytes(const std::string& hex)
 {
     std::vector<uint8_t> bytes;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "../generators/double_base_mul.hpp"
 #include "../hmac/hmac.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace crypto {
@@ -169,5 +171,79 @@ bool verify_signature(const std::string& message, const typename G1::affine_elem
     Fr result(Rx);
     return result == r;
 }
+
+/**
+ * @brief Verify many ECDSA signatures, with the same result for each one as verify_signature, except that a signature
+ * whose s value is not low is reported as invalid rather than throwing
+ *
+ * @details Every signature needs its own double scalar multiplication u1 • G + u2 • pk. The multiplications share a
+ * precomputed table of G and a batched inversion (see batch_double_base_mul), the inversions of s are batched into
+ * one, and the message hashes and multiplications are spread across threads.
+ *
+ * @return whether each signature is valid for the message and public key at the same index
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> batch_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<signature>& signatures)
+{
+    using serialize::read;
+    ASSERT(messages.size() == public_keys.size() && messages.size() == signatures.size());
+    const size_t num_signatures = signatures.size();
+    const uint256_t mod = uint256_t(Fr::modulus);
+
+    // Signatures that fail the checks verify_signature makes before its scalar multiplication are marked invalid, and
+    // their multiplication is replaced by a trivial one
+    std::vector<uint8_t> is_valid(num_signatures);
+    std::vector<Fr> r(num_signatures);
+    std::vector<Fr> s(num_signatures);
+    std::vector<Fr> z(num_signatures);
+    const size_t num_threads = std::max(std::min(get_num_cpus(), num_signatures), size_t(1));
+    const size_t signatures_per_thread = (num_signatures + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * signatures_per_thread, num_signatures);
+        const size_t end = std::min(start + signatures_per_thread, num_signatures);
+        for (size_t i = start; i < end; ++i) {
+            uint256_t r_uint;
+            uint256_t s_uint;
+            const auto* r_buf = &signatures[i].r[0];
+            const auto* s_buf = &signatures[i].s[0];
+            read(r_buf, r_uint);
+            read(s_buf, s_uint);
+            // s_uint * 2 can overflow 256 bits for the secp256k1 and secp256r1 orders, so compare against mod / 2
+            is_valid[i] = public_keys[i].on_curve() && r_uint < mod && s_uint < mod && r_uint != 0 && s_uint != 0 &&
+                          s_uint <= (mod >> 1);
+            if (!is_valid[i]) {
+                s[i] = 1;
+                continue;
+            }
+            r[i] = Fr(r_uint);
+            s[i] = Fr(s_uint);
+            std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+            auto ev = Hash::hash(message_buffer);
+            z[i] = Fr::serialize_from_buffer(&ev[0]);
+        }
+    });
+
+    Fr::batch_invert(s);
+    std::vector<Fr> u1(num_signatures);
+    std::vector<Fr> u2(num_signatures);
+    std::vector<typename G1::affine_element> keys(num_signatures, G1::affine_one);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (is_valid[i]) {
+            u1[i] = z[i] * s[i];
+            u2[i] = r[i] * s[i];
+            keys[i] = public_keys[i];
+        }
+    }
+
+    const auto R = batch_double_base_mul<G1>(u1, keys, u2);
+
+    std::vector<bool> results(num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        results[i] = is_valid[i] && !R[i].is_point_at_infinity() && Fr(uint256_t(R[i].x)) == r[i];
+    }
+    return results;
+}
 } // namespace ecdsa
 } // namespace crypto
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "./fixed_base_table.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <span>
+#include <vector>
+
+namespace crypto {
+
+/**
+ * @brief The curve interface fixed_base_table expects, for code that is templated on the group
+ */
+template <typename G1> struct GroupCurve {
+    using Group = G1;
+    using Element = typename G1::element;
+    using AffineElement = typename G1::affine_element;
+};
+
+/**
+ * @brief Compute a_i * G + b_i * P_i for many triples (a_i, b_i, P_i), where G is the generator of G1. This is the
+ * double scalar multiplication at the heart of Schnorr and ECDSA verification.
+ *
+ * @details G is fixed, so a_i * G is read from a fixed_base_table of G that is built on first use and shared by every
+ * call. The multiples b_i * P_i are computed with the group's own scalar multiplication (which uses the endomorphism
+ * where the curve has one). The triples are split across threads, and each thread brings its results to affine form
+ * with a single batched inversion.
+ */
+template <typename G1>
+std::vector<typename G1::affine_element> batch_double_base_mul(std::span<const typename G1::Fr> generator_scalars,
+                                                               std::span<const typename G1::affine_element> points,
+                                                               std::span<const typename G1::Fr> point_scalars)
+{
+    using Element = typename G1::element;
+    using AffineElement = typename G1::affine_element;
+    static const fixed_base_table<GroupCurve<G1>> generator_table(G1::affine_one);
+
+    ASSERT(points.size() == generator_scalars.size() && points.size() == point_scalars.size());
+    const size_t num_points = points.size();
+    std::vector<Element> results(num_points);
+    std::vector<AffineElement> affine_results(num_points);
+    const size_t num_threads = std::max(std::min(get_num_cpus(), num_points), size_t(1));
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * points_per_thread, num_points);
+        const size_t end = std::min(start + points_per_thread, num_points);
+        for (size_t i = start; i < end; ++i) {
+            results[i] = Element(points[i]) * point_scalars[i];
+            generator_table.accumulate(results[i], uint256_t(generator_scalars[i]));
+        }
+        Element::batch_normalize(&results[start], end - start);
+        for (size_t i = start; i < end; ++i) {
+            affine_results[i] = results[i].is_point_at_infinity() ? G1::affine_point_at_infinity
+                                                                   : AffineElement(results[i].x, results[i].y);
+        }
+    });
+    return affine_results;
+}
+
+} // namespace crypto
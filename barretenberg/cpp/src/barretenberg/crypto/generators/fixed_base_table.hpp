@@ -0,0 +1,269 @@
+#pragma once
+
+#include "./generator_data.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace crypto {
+
+/**
+ * @brief Precomputed multiples of a fixed generator, so that multiplying the generator by a scalar only costs point
+ * additions
+ *
+ * @details The scalar is split into 4-bit windows. For the window starting at bit 4j the table holds the multiples
+ * d * 2^{4j} * G for d = 1, ..., 15, so a scalar multiplication is at most one mixed addition per window and no
+ * doublings. A table takes 960 affine points.
+ */
+template <typename Curve> class fixed_base_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    static constexpr size_t POINTS_PER_WINDOW = (1UL << WINDOW_BITS) - 1;
+
+    explicit fixed_base_table(const AffineElement& generator)
+    {
+        std::vector<Element> multiples(NUM_WINDOWS * POINTS_PER_WINDOW);
+        Element window_base(generator);
+        for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+            Element* window = &multiples[j * POINTS_PER_WINDOW];
+            window[0] = window_base;
+            for (size_t d = 1; d < POINTS_PER_WINDOW; ++d) {
+                window[d] = window[d - 1] + window_base;
+            }
+            // 16 * window_base
+            window_base = window[POINTS_PER_WINDOW - 1] + window_base;
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+        points.reserve(multiples.size());
+        for (const auto& multiple : multiples) {
+            points.emplace_back(multiple.x, multiple.y);
+        }
+    }
+
+    /**
+     * @brief Add `scalar * G` to `accumulator`
+     */
+    void accumulate(Element& accumulator, const uint256_t& scalar) const
+    {
+        constexpr size_t WINDOWS_PER_LIMB = 64 / WINDOW_BITS;
+        for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+            const auto digit = static_cast<size_t>((scalar.data[j / WINDOWS_PER_LIMB] >>
+                                                    ((j % WINDOWS_PER_LIMB) * WINDOW_BITS)) &
+                                                   POINTS_PER_WINDOW);
+            if (digit != 0) {
+                accumulator += points[j * POINTS_PER_WINDOW + digit - 1];
+            }
+        }
+    }
+
+    Element mul(const uint256_t& scalar) const
+    {
+        Element result = Curve::Group::point_at_infinity;
+        accumulate(result, scalar);
+        return result;
+    }
+
+    /**
+     * @brief The tables of consecutive generators, as returned by `get_tables`. A generator that did not fit into the
+     * cache has no table, and is multiplied directly.
+     */
+    class Tables {
+      public:
+        /**
+         * @brief Add `scalar * G_i` to `accumulator`, where G_i is the i-th generator of the list
+         */
+        void accumulate(const size_t i, Element& accumulator, const uint256_t& scalar) const
+        {
+            if (tables[i] != nullptr) {
+                tables[i]->accumulate(accumulator, scalar);
+            } else {
+                accumulator += Element(generators[i]) * scalar;
+            }
+        }
+
+      private:
+        friend class fixed_base_table;
+        std::vector<const fixed_base_table*> tables;
+        // Only looked up if a table is missing
+        typename generator_data<Curve>::GeneratorView generators;
+    };
+
+    /**
+     * @brief Get the tables of the generators `context` refers to, building and caching them on first use
+     *
+     * @details Generators are fully determined by their domain separator and index, so the tables are cached per domain
+     * separator for the lifetime of the process, up to MAX_CACHED_TABLES tables in total. The tables of the generators
+     * that `generator_data` precomputes for the default domain are held separately.
+     *
+     * Cached tables are published the way `generator_data` publishes generators: the tables of a domain are listed in
+     * a segment whose size is read atomically, and the domains in a list that is only ever prepended to. Looking up
+     * tables that have been built does not take a lock. Missing tables are built without a lock, which is only taken to
+     * insert them.
+     */
+    static Tables get_tables(const size_t num_generators, const GeneratorContext<Curve>& context)
+    {
+        using Generators = generator_data<Curve>;
+        Tables result;
+        result.tables.resize(num_generators);
+        if (context.domain_separator == Generators::DEFAULT_DOMAIN_SEPARATOR &&
+            num_generators + context.offset <= Generators::DEFAULT_NUM_GENERATORS) {
+            static const auto default_tables = []() {
+                std::vector<fixed_base_table> tables;
+                tables.reserve(Generators::DEFAULT_NUM_GENERATORS);
+                for (const auto& generator : Generators::precomputed_generators) {
+                    tables.emplace_back(generator);
+                }
+                return tables;
+            }();
+            for (size_t i = 0; i < num_generators; ++i) {
+                result.tables[i] = &default_tables[context.offset + i];
+            }
+            return result;
+        }
+
+        DomainTables& domain = get_domain(context.domain_separator);
+        const size_t num_required = context.offset + num_generators;
+        const TableSegment* segment = domain.latest.load(std::memory_order_acquire);
+        size_t num_cached = segment == nullptr ? 0 : segment->size.load(std::memory_order_acquire);
+        if (num_cached < num_required) {
+            segment = insert(domain, context, num_required);
+            num_cached = segment == nullptr ? 0 : segment->size.load(std::memory_order_acquire);
+        }
+        for (size_t i = 0; i < num_generators && context.offset + i < num_cached; ++i) {
+            result.tables[i] = segment->tables[context.offset + i];
+        }
+        if (num_cached < num_required) {
+            result.generators = context.generators->get(num_generators, context.offset, context.domain_separator);
+        }
+        return result;
+    }
+
+    // Each table takes 960 affine points, so the cache holds at most 60 MiB of tables
+    static constexpr size_t MAX_CACHED_TABLES = 1024;
+
+  private:
+    /**
+     * @brief The first `size` tables of a domain, out of room for `capacity`. Tables are appended in place, and a
+     * segment that runs out of room is superseded by a larger copy, which like in `generator_data` keeps the old
+     * segment alive for the threads still reading it.
+     */
+    struct TableSegment {
+        std::unique_ptr<const fixed_base_table*[]> tables;
+        size_t capacity = 0;
+        std::atomic<size_t> size = 0;
+        std::unique_ptr<TableSegment> previous;
+    };
+
+    struct DomainTables {
+        std::string domain_separator;
+        // The segment that lookups are served from. Read without locking
+        std::atomic<TableSegment*> latest = nullptr;
+        std::unique_ptr<TableSegment> segments;
+        std::vector<std::unique_ptr<const fixed_base_table>> tables;
+        // The domain inserted before this one. Set before the domain is published, and never changed
+        DomainTables* next = nullptr;
+    };
+
+    static DomainTables& get_domain(const std::string_view domain_separator)
+    {
+        for (DomainTables* domain = domains.load(std::memory_order_acquire); domain != nullptr; domain = domain->next) {
+            if (domain->domain_separator == domain_separator) {
+                return *domain;
+            }
+        }
+        std::lock_guard<std::mutex> lock(insertion_mutex);
+        DomainTables* const head = domains.load(std::memory_order_relaxed);
+        for (DomainTables* domain = head; domain != nullptr; domain = domain->next) {
+            if (domain->domain_separator == domain_separator) {
+                return *domain;
+            }
+        }
+        auto& domain = owned_domains.emplace_back(std::make_unique<DomainTables>());
+        domain->domain_separator = domain_separator;
+        domain->next = head;
+        domains.store(domain.get(), std::memory_order_release);
+        return *domain;
+    }
+
+    /**
+     * @brief Make sure that the tables of the first `num_required` generators of `domain` are cached, as far as they
+     * fit into the cache, and return the domain's latest segment
+     *
+     * @details The tables are built before taking the lock. If another thread inserted some of them in the meantime,
+     * only the rest are inserted and the others are dropped.
+     */
+    static const TableSegment* insert(DomainTables& domain,
+                                      const GeneratorContext<Curve>& context,
+                                      const size_t num_required)
+    {
+        const TableSegment* segment = domain.latest.load(std::memory_order_acquire);
+        const size_t num_cached = segment == nullptr ? 0 : segment->size.load(std::memory_order_acquire);
+        const size_t num_affordable =
+            MAX_CACHED_TABLES - std::min(num_cached_tables.load(std::memory_order_relaxed), MAX_CACHED_TABLES);
+        const size_t num_built = std::min(num_required - num_cached, num_affordable);
+        if (num_built == 0) {
+            return segment;
+        }
+        std::vector<std::unique_ptr<const fixed_base_table>> built;
+        built.reserve(num_built);
+        for (const auto& generator : context.generators->get(num_built, num_cached, context.domain_separator)) {
+            built.emplace_back(std::make_unique<const fixed_base_table>(generator));
+        }
+
+        std::lock_guard<std::mutex> lock(insertion_mutex);
+        TableSegment* latest = domain.latest.load(std::memory_order_relaxed);
+        const size_t num_present = latest == nullptr ? 0 : latest->size.load(std::memory_order_relaxed);
+        const size_t first_new = num_present - num_cached;
+        if (first_new >= num_built) {
+            return latest;
+        }
+        const size_t num_inserted = std::min(num_built - first_new, MAX_CACHED_TABLES - num_cached_tables);
+        if (num_inserted == 0) {
+            return latest;
+        }
+
+        if (latest == nullptr || latest->capacity < num_present + num_inserted) {
+            auto extended = std::make_unique<TableSegment>();
+            extended->capacity = std::max({ num_present + num_inserted, 2 * num_present, MIN_SEGMENT_CAPACITY });
+            extended->tables = std::make_unique<const fixed_base_table*[]>(extended->capacity);
+            if (latest != nullptr) {
+                std::copy(latest->tables.get(), latest->tables.get() + num_present, extended->tables.get());
+            }
+            extended->size.store(num_present, std::memory_order_relaxed);
+            extended->previous = std::move(domain.segments);
+            domain.segments = std::move(extended);
+            latest = domain.segments.get();
+        }
+        for (size_t i = 0; i < num_inserted; ++i) {
+            latest->tables[num_present + i] = built[first_new + i].get();
+            domain.tables.emplace_back(std::move(built[first_new + i]));
+        }
+        num_cached_tables.fetch_add(num_inserted, std::memory_order_relaxed);
+        // Publish the new tables only once they have been written
+        latest->size.store(num_present + num_inserted, std::memory_order_release);
+        domain.latest.store(latest, std::memory_order_release);
+        return latest;
+    }
+
+    static constexpr size_t MIN_SEGMENT_CAPACITY = 32;
+
+    // The most recently inserted domain. Read without locking
+    static inline std::atomic<DomainTables*> domains = nullptr;
+    // Serialises insertions of domains and tables, which are short as tables are built before taking it
+    static inline std::mutex insertion_mutex;
+    static inline std::vector<std::unique_ptr<DomainTables>> owned_domains;
+    static inline std::atomic<size_t> num_cached_tables = 0;
+
+    std::vector<AffineElement> points;
+};
+
+} // namespace crypto
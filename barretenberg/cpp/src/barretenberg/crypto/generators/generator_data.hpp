@@ -3,8 +3,12 @@
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 namespace crypto {
@@ -29,11 +33,9 @@ namespace crypto {
  *          All Pedersen methods that require a `*generator_data` parameter (from now on referred to as "generator
  *          context") should default to using `default_data`.
  *
- *          Q: Why make the generator context an input parameter when it defaults to `default_data`?
- *          A: This is not thread-safe. Each process that uses a `generator_data` object may extend `generator_data` if
- *             more generators are required.
- *             i.e. either each process must use an independent `generator_data` object or the author must KNOW that
- *             `generator_data` will not be extended by any process
+ *          `get` is thread-safe. Generators of a domain are stored in contiguous segments that are appended to in
+ *          place and never move, so the views returned by `get` remain valid while other threads extend the domain.
+ *          Reading generators that have already been derived does not take a lock.
  *
  * @tparam Curve
  */
@@ -67,67 +69,131 @@ template <typename Curve> class generator_data {
                                            const std::string_view domain_separator = DEFAULT_DOMAIN_SEPARATOR) const
     {
         const bool is_default_domain = domain_separator == DEFAULT_DOMAIN_SEPARATOR;
-        if (is_default_domain && (num_generators + generator_offset) < DEFAULT_NUM_GENERATORS) {
+        if (is_default_domain && (num_generators + generator_offset) <= DEFAULT_NUM_GENERATORS) {
             return GeneratorView{ precomputed_generators.data() + generator_offset, num_generators };
         }
 
+        DomainGenerators& domain = is_default_domain ? default_domain : get_domain(domain_separator);
+        const size_t num_required = num_generators + generator_offset;
+        const GeneratorSegment* segment = domain.latest.load(std::memory_order_acquire);
+        if (segment == nullptr || segment->size.load(std::memory_order_acquire) < num_required) {
+            segment = extend(domain, domain_separator, num_required);
+        }
+        return GeneratorView{ segment->data.get() + generator_offset, num_generators };
+    }
+
+    // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
+    // Don't call `delete` on this pointer.
+    static inline generator_data* get_default_generators() { return &default_data; }
+
+  private:
+    /**
+     * @brief Contiguous storage for the first `capacity` generators of a domain, of which the first `size` have been
+     * derived. Generators are appended in place and never move, so views into a segment stay valid for the lifetime of
+     * the `generator_data` object.
+     */
+    struct GeneratorSegment {
+        std::unique_ptr<AffineElement[]> data;
+        size_t capacity = 0;
+        std::atomic<size_t> size = 0;
+        // A segment that runs out of capacity is superseded by a larger copy, but is kept alive for existing views
+        std::unique_ptr<GeneratorSegment> previous;
+    };
+
+    struct DomainGenerators {
+        // The segment that new requests are served from. Read without locking
+        std::atomic<GeneratorSegment*> latest = nullptr;
+        // Serialises extensions of this domain, so that deriving generators of one domain does not block others
+        std::mutex extension_mutex;
+        std::unique_ptr<GeneratorSegment> segments;
+    };
+
+    DomainGenerators& get_domain(const std::string_view domain_separator) const
+    {
+        std::lock_guard<std::mutex> lock(domain_map_mutex);
         if (!generator_map.has_value()) {
-            generator_map = std::map<std::string, GeneratorList>();
+            generator_map = std::map<std::string, std::unique_ptr<DomainGenerators>, std::less<>>();
         }
-        std::map<std::string, GeneratorList>& map = generator_map.value();
-
-        // Case 2: we want default generators, but more than we precomputed at compile time. If we have not yet copied
-        // the default generators into the map, do so.
-        if (is_default_domain && !initialized_precomputed_generators) {
-            map.insert({ std::string(DEFAULT_DOMAIN_SEPARATOR),
-                         GeneratorList(precomputed_generators.begin(), precomputed_generators.end()) });
-            initialized_precomputed_generators = true;
+        auto& map = generator_map.value();
+        auto it = map.find(domain_separator);
+        if (it == map.end()) {
+            it = map.emplace(std::string(domain_separator), std::make_unique<DomainGenerators>()).first;
         }
+        return *it->second;
+    }
 
-        // if the generator map does not contain our desired generators, add entry into map
-        if (!map.contains(std::string(domain_separator))) {
-            map.insert({
-                std::string(domain_separator),
-                Group::derive_generators(domain_separator, num_generators + generator_offset, 0),
-            });
+    /**
+     * @brief Make sure that at least `num_required` generators of `domain` have been derived
+     *
+     * @details A request that fits into the capacity of the latest segment appends to it. Otherwise the derived
+     * generators are copied into a new segment of at least twice the capacity, so that a domain is relocated a
+     * logarithmic number of times.
+     */
+    static const GeneratorSegment* extend(DomainGenerators& domain,
+                                          const std::string_view domain_separator,
+                                          const size_t num_required)
+    {
+        std::lock_guard<std::mutex> lock(domain.extension_mutex);
+        GeneratorSegment* segment = domain.latest.load(std::memory_order_relaxed);
+        const size_t num_derived = segment == nullptr ? 0 : segment->size.load(std::memory_order_relaxed);
+        if (num_derived >= num_required) {
+            return segment;
         }
 
-        GeneratorList& generators = map.at(std::string(domain_separator));
-
-        // If the current GeneratorList does not contain enough generators, extend it
-        if (num_generators + generator_offset > generators.size()) {
-            const size_t num_extra_generators = num_generators + generator_offset - generators.size();
-            GeneratorList extended_generators =
-                Group::derive_generators(domain_separator, num_extra_generators, generators.size());
-            generators.reserve(num_generators + generator_offset);
-            std::copy(extended_generators.begin(), extended_generators.end(), std::back_inserter(generators));
+        if (segment == nullptr || segment->capacity < num_required) {
+            auto extended = std::make_unique<GeneratorSegment>();
+            extended->capacity = std::max({ num_required, 2 * num_derived, MIN_SEGMENT_CAPACITY });
+            extended->data = std::make_unique<AffineElement[]>(extended->capacity);
+            if (segment != nullptr) {
+                std::copy(segment->data.get(), segment->data.get() + num_derived, extended->data.get());
+            }
+            extended->size.store(num_derived, std::memory_order_relaxed);
+            extended->previous = std::move(domain.segments);
+            domain.segments = std::move(extended);
+            segment = domain.segments.get();
         }
 
-        return GeneratorView{ generators.data() + generator_offset, num_generators };
+        size_t num_present = num_derived;
+        // The default generators are known at compile time
+        if (domain_separator == DEFAULT_DOMAIN_SEPARATOR && num_present < DEFAULT_NUM_GENERATORS) {
+            std::copy(precomputed_generators.begin() + static_cast<std::ptrdiff_t>(num_present),
+                      precomputed_generators.end(),
+                      segment->data.get() + num_present);
+            num_present = DEFAULT_NUM_GENERATORS;
+        }
+        if (num_present < num_required) {
+            const GeneratorList extra_generators =
+                Group::derive_generators(domain_separator, num_required - num_present, num_present);
+            std::copy(extra_generators.begin(), extra_generators.end(), segment->data.get() + num_present);
+            num_present = num_required;
+        }
+        // Publish the new generators only once they have been written
+        segment->size.store(num_present, std::memory_order_release);
+        domain.latest.store(segment, std::memory_order_release);
+        return segment;
     }
 
-    // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
-    // Don't call `delete` on this pointer.
-    static inline generator_data* get_default_generators() { return &default_data; }
+    static constexpr size_t MIN_SEGMENT_CAPACITY = 32;
 
-  private:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     static inline constinit generator_data default_data = generator_data();
 
-    // We mark the following two params as `mutable` so that our `get` method can be marked `const`.
+    // We mark the following members as `mutable` so that our `get` method can be marked `const`.
     // A non-const getter creates downstream issues as all const methods that use a non-const `get`
     // would need to be marked const.
     // Rationale is that it's ok for `get` to be `const` because all changes are internal to the class and don't change
     // the external functionality of `generator_data`.
     // i.e. `generator_data.get` will return the same output regardless of the internal state of `generator_data`.
 
-    // bool that describes whether we've copied the precomputed enerators into `generator_map`. This cannot be done at
-    // compile-time because std::map is a dynamically sized object.
-    mutable bool initialized_precomputed_generators = false;
+    // The default domain is by far the most common one, so we skip the domain lookup for it
+    mutable DomainGenerators default_domain;
+
+    // Guards lookups and insertions of domains, which are short. Generators are derived under the domain's own mutex
+    mutable std::mutex domain_map_mutex;
 
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
     // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
-    mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+    mutable std::optional<std::map<std::string, std::unique_ptr<DomainGenerators>, std::less<>>> generator_map = {};
 };
 
 template <typename Curve> struct GeneratorContext {
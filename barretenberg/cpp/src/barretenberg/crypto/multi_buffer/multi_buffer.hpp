@@ -0,0 +1,183 @@
+#pragma once
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#define BBERG_MULTI_BUFFER_X86
+#endif
+
+/**
+ * Shared plumbing for hashing many independent messages at once ("multi-buffer" hashing).
+ *
+ * SHA-256, Blake2s and Blake3s all operate on 32-bit words, so a vector register of N 32-bit lanes can run the same
+ * compression function on N messages at once. The lane kernels are written once against GCC/Clang vector extensions
+ * and compiled for AVX2 (8 lanes) and AVX-512 (16 lanes) through function-level target attributes, so a generic build
+ * still runs on any x86-64 CPU: the implementation is picked at runtime with `is_supported`.
+ */
+namespace crypto::multi_buffer {
+
+/**
+ * @brief How a batch of messages is hashed
+ *
+ * SCALAR: one message at a time with the portable implementation
+ * SHA_NI: one message at a time with the x86 SHA extensions (SHA-256 only)
+ * AVX2: 8 messages at a time, one per 32-bit lane
+ * AVX512: 16 messages at a time, one per 32-bit lane
+ */
+enum class Backend { SCALAR, SHA_NI, AVX2, AVX512 };
+
+inline bool is_supported(const Backend backend)
+{
+#ifdef BBERG_MULTI_BUFFER_X86
+    switch (backend) {
+    case Backend::SCALAR:
+        return true;
+    case Backend::SHA_NI: {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0 && (ebx & bit_SHA) != 0;
+    }
+    case Backend::AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+    case Backend::AVX512:
+        return __builtin_cpu_supports("avx512f") != 0;
+    }
+    return false;
+#else
+    return backend == Backend::SCALAR;
+#endif
+}
+
+/**
+ * @brief The fastest supported backend out of `preferred`, which is ordered from fastest to slowest
+ */
+template <size_t N> Backend select_backend(const std::array<Backend, N>& preferred)
+{
+    for (const auto backend : preferred) {
+        if (is_supported(backend)) {
+            return backend;
+        }
+    }
+    return Backend::SCALAR;
+}
+
+constexpr size_t BLOCK_SIZE = 64;
+
+/**
+ * @brief A message viewed as a sequence of 64-byte blocks. The first `num_full_blocks` blocks are read in place, the
+ * remaining ones from `tail`, which the hash function fills with the rest of the message and its padding.
+ */
+struct BlockView {
+    const uint8_t* data = nullptr;
+    size_t num_full_blocks = 0;
+    std::array<uint8_t, 2 * BLOCK_SIZE> tail{};
+
+    const uint8_t* block(const size_t i) const
+    {
+        return i < num_full_blocks ? data + i * BLOCK_SIZE : tail.data() + (i - num_full_blocks) * BLOCK_SIZE;
+    }
+};
+
+/**
+ * @brief Split `inputs` into groups of LANES messages that take the same number of blocks, so that each group can be
+ * hashed in lockstep, and call `hash_group(indices, num_blocks)` on each group.
+ *
+ * @details A group with fewer than LANES messages (the last one for each block count) repeats its last index in the
+ * unused lanes, so those lanes recompute, and rewrite, an output that is already in the group.
+ */
+template <size_t LANES, typename NumBlocks, typename HashGroup>
+void for_each_group(const std::vector<std::vector<uint8_t>>& inputs, NumBlocks&& num_blocks_of, HashGroup&& hash_group)
+{
+    std::vector<size_t> num_blocks(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        num_blocks[i] = num_blocks_of(inputs[i].size());
+    }
+    std::vector<size_t> order(inputs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return num_blocks[lhs] < num_blocks[rhs]; });
+
+    size_t next = 0;
+    while (next < order.size()) {
+        const size_t group_num_blocks = num_blocks[order[next]];
+        std::array<size_t, LANES> indices;
+        size_t count = 0;
+        while (count < LANES && next < order.size() && num_blocks[order[next]] == group_num_blocks) {
+            indices[count++] = order[next++];
+        }
+        for (size_t lane = count; lane < LANES; ++lane) {
+            indices[lane] = indices[count - 1];
+        }
+        hash_group(indices, group_num_blocks);
+    }
+}
+
+// Rotation that works on scalars and on vector-extension types alike
+#define BBERG_MULTI_BUFFER_ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/**
+ * @brief Gather word `word_idx` of the current block of each lane into a vector
+ */
+template <typename Vec, size_t LANES, typename LoadWord>
+BBERG_INLINE void gather_word(Vec& out,
+                              const std::array<const uint8_t*, LANES>& blocks,
+                              const size_t word_idx,
+                              LoadWord load)
+{
+    std::array<uint32_t, LANES> words;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        words[lane] = load(blocks[lane] + 4 * word_idx);
+    }
+    static_assert(sizeof(Vec) == sizeof(words));
+    std::copy_n(reinterpret_cast<const uint8_t*>(words.data()), sizeof(Vec), reinterpret_cast<uint8_t*>(&out));
+}
+
+/**
+ * @brief Scatter the lanes of a vector of output words into word `word_idx` of each lane's output
+ */
+template <typename Vec, size_t LANES, typename StoreWord>
+BBERG_INLINE void scatter_word(const Vec& in,
+                               const std::array<uint8_t*, LANES>& outputs,
+                               const size_t word_idx,
+                               StoreWord store)
+{
+    std::array<uint32_t, LANES> words;
+    static_assert(sizeof(Vec) == sizeof(words));
+    std::copy_n(reinterpret_cast<const uint8_t*>(&in), sizeof(Vec), reinterpret_cast<uint8_t*>(words.data()));
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        store(outputs[lane] + 4 * word_idx, words[lane]);
+    }
+}
+
+/**
+ * @brief The G mixing function of Blake2s and Blake3s, applied to each lane of the state
+ */
+template <typename Vec>
+BBERG_INLINE void blake_g(std::array<Vec, 16>& v, size_t a, size_t b, size_t c, size_t d, const Vec& x, const Vec& y)
+{
+    v[a] = v[a] + v[b] + x;
+    v[d] = BBERG_MULTI_BUFFER_ROTR32(v[d] ^ v[a], 16);
+    v[c] = v[c] + v[d];
+    v[b] = BBERG_MULTI_BUFFER_ROTR32(v[b] ^ v[c], 12);
+    v[a] = v[a] + v[b] + y;
+    v[d] = BBERG_MULTI_BUFFER_ROTR32(v[d] ^ v[a], 8);
+    v[c] = v[c] + v[d];
+    v[b] = BBERG_MULTI_BUFFER_ROTR32(v[b] ^ v[c], 7);
+}
+
+#ifdef BBERG_MULTI_BUFFER_X86
+using u32x8 = uint32_t __attribute__((vector_size(32)));
+using u32x16 = uint32_t __attribute__((vector_size(64)));
+#endif
+
+} // namespace crypto::multi_buffer
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "multi_buffer.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace crypto::multi_buffer::test {
+
+/**
+ * @brief Messages with lengths around the one and two block boundaries, in an order that mixes block counts within
+ * each group of lanes. Some lengths are shared by more messages than there are lanes and some by fewer, and the last
+ * message is empty.
+ */
+inline std::vector<std::vector<uint8_t>> make_messages()
+{
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 100; ++i) {
+        const size_t length = i < 40 ? (i % 2 == 0 ? 32 : BLOCK_SIZE) : (i * 37) % 200;
+        std::vector<uint8_t> message(length);
+        for (size_t j = 0; j < length; ++j) {
+            message[j] = static_cast<uint8_t>(i * 31 + j);
+        }
+        messages.push_back(message);
+    }
+    messages.emplace_back();
+    return messages;
+}
+
+/**
+ * @brief Checks that a multi-buffer hash function matches hashing the messages one at a time, with every backend out
+ * of `backends` that the CPU supports, and that the backend it picks by default gives the same hashes as the scalar one
+ *
+ * @param hash_many Called as `hash_many(messages)` and `hash_many(messages, backend)`
+ * @param hash Hashes a single message
+ */
+template <typename HashMany, typename Hash>
+void check_hash_many(const std::initializer_list<Backend> backends, const HashMany& hash_many, const Hash& hash)
+{
+    const auto messages = make_messages();
+    for (const auto backend : backends) {
+        if (!is_supported(backend)) {
+            continue;
+        }
+        const auto results = hash_many(messages, backend);
+        ASSERT_EQ(results.size(), messages.size());
+        for (size_t i = 0; i < messages.size(); ++i) {
+            const auto expected = hash(messages[i]);
+            EXPECT_EQ(std::vector<uint8_t>(results[i].begin(), results[i].end()),
+                      std::vector<uint8_t>(expected.begin(), expected.end()))
+                << "backend " << static_cast<int>(backend) << ", message " << i;
+        }
+    }
+    EXPECT_EQ(hash_many(messages), hash_many(messages, Backend::SCALAR));
+}
+
+} // namespace crypto::multi_buffer::test
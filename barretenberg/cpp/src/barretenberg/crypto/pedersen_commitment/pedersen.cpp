@@ -1,4 +1,5 @@
 #include "./pedersen.hpp"
+#include "../generators/fixed_base_table.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
@@ -13,6 +14,8 @@ namespace crypto {
  *
  * @details This method uses `Curve::BaseField` members as inputs. This aligns with what we expect when creating
  * grumpkin commitments to field elements inside a BN254 SNARK circuit.
+ * The generators are fixed, so each scalar multiplication is a sequence of additions of precomputed multiples of the
+ * generator (see `fixed_base_table`).
  * @param inputs
  * @param context
  * @return Curve::AffineElement
@@ -21,11 +24,11 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    const auto tables = fixed_base_table<Curve>::get_tables(inputs.size(), context);
     Element result = Group::point_at_infinity;
 
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        tables.accumulate(i, result, static_cast<uint256_t>(inputs[i]));
     }
     return result.normalize();
 }
@@ -1,12 +1,37 @@
 #include "pedersen.hpp"
 #include "barretenberg/common/timer.hpp"
+#include "barretenberg/crypto/generators/fixed_base_table.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace crypto {
 
 using barretenberg::fr;
 
+namespace {
+pedersen_commitment::AffineElement naive_commit(const std::vector<fr>& inputs,
+                                                const pedersen_commitment::GeneratorContext& context)
+{
+    using Element = pedersen_commitment::Element;
+    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    Element result = pedersen_commitment::Group::point_at_infinity;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+    }
+    return result.normalize();
+}
+
+std::vector<fr> random_inputs(const size_t num_inputs)
+{
+    std::vector<fr> inputs;
+    for (size_t i = 0; i < num_inputs; ++i) {
+        inputs.emplace_back(fr::random_element());
+    }
+    return inputs;
+}
+} // namespace
+
 TEST(Pedersen, Commitment)
 {
     auto x = pedersen_commitment::Fq::one();
@@ -28,6 +53,107 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, CommitmentMatchesScalarMultiplication)
+{
+    std::vector<fr> inputs = random_inputs(12);
+    // Scalars with long runs of zero and all-ones windows
+    inputs.emplace_back(fr(uint256_t(0xf000000000000000ULL, 0, 0, 0xffffULL)));
+    inputs.emplace_back(-fr::one());
+
+    for (const auto& context : { pedersen_commitment::GeneratorContext(),
+                                 pedersen_commitment::GeneratorContext(3),
+                                 pedersen_commitment::GeneratorContext(5, "pedersen_commitment_test") }) {
+        // Commitments within the precomputed default generators and beyond them
+        const std::vector<fr> few_inputs(inputs.begin(), inputs.begin() + 2);
+        EXPECT_EQ(pedersen_commitment::commit_native(few_inputs, context), naive_commit(few_inputs, context));
+        EXPECT_EQ(pedersen_commitment::commit_native(inputs, context), naive_commit(inputs, context));
+    }
+}
+
+// Threads that build and look up the tables of the same domains at the same time all get the right commitments
+TEST(Pedersen, ConcurrentCommitmentTables)
+{
+    const std::vector<std::string> domains = { "concurrent_tables_a", "concurrent_tables_b" };
+    const size_t num_threads = 8;
+    std::vector<std::vector<pedersen_commitment::GeneratorContext>> contexts(num_threads);
+    std::vector<std::vector<std::vector<fr>>> inputs(num_threads);
+    std::vector<std::vector<pedersen_commitment::AffineElement>> commitments(num_threads);
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        for (size_t i = 0; i < 6; ++i) {
+            contexts[thread_idx].emplace_back(thread_idx, domains[(thread_idx + i) % domains.size()]);
+            inputs[thread_idx].emplace_back(random_inputs((1UL << i) + thread_idx));
+        }
+    }
+    std::vector<std::thread> threads;
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        threads.emplace_back([&, thread_idx]() {
+            for (size_t i = 0; i < 6; ++i) {
+                commitments[thread_idx].emplace_back(
+                    pedersen_commitment::commit_native(inputs[thread_idx][i], contexts[thread_idx][i]));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        for (size_t i = 0; i < 6; ++i) {
+            EXPECT_EQ(commitments[thread_idx][i], naive_commit(inputs[thread_idx][i], contexts[thread_idx][i]));
+        }
+    }
+}
+
+// Generators whose tables do not fit into the cache are multiplied directly
+TEST(Pedersen, CommitmentBeyondTableCache)
+{
+    constexpr size_t max_cached_tables = fixed_base_table<curve::Grumpkin>::MAX_CACHED_TABLES;
+    const pedersen_commitment::GeneratorContext context(max_cached_tables - 1, "beyond_table_cache");
+    const auto inputs = random_inputs(3);
+    EXPECT_EQ(pedersen_commitment::commit_native(inputs, context), naive_commit(inputs, context));
+}
+
+TEST(Pedersen, ConcurrentGeneratorAccess)
+{
+    using Generators = generator_data<curve::Grumpkin>;
+    Generators generators;
+    const std::vector<std::string> domains = {
+        std::string(Generators::DEFAULT_DOMAIN_SEPARATOR), "domain_a", "domain_b"
+    };
+
+    // Views stay valid while the domain is extended
+    const auto first_view = generators.get(4, 0, "domain_a");
+    const std::vector<grumpkin::g1::affine_element> first_generators(first_view.begin(), first_view.end());
+
+    const size_t num_threads = 8;
+    std::vector<std::vector<Generators::GeneratorView>> views(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        threads.emplace_back([&, thread_idx]() {
+            for (size_t i = 0; i < 6; ++i) {
+                const size_t num_generators = (1UL << i) + thread_idx;
+                const auto& domain = domains[(thread_idx + i) % domains.size()];
+                views[thread_idx].emplace_back(generators.get(num_generators, thread_idx, domain));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < first_generators.size(); ++i) {
+        EXPECT_EQ(first_view[i], first_generators[i]);
+    }
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        for (size_t i = 0; i < 6; ++i) {
+            const auto& view = views[thread_idx][i];
+            const auto& domain = domains[(thread_idx + i) % domains.size()];
+            const auto expected = grumpkin::g1::derive_generators(domain, view.size(), thread_idx);
+            EXPECT_EQ(std::vector<grumpkin::g1::affine_element>(view.begin(), view.end()), expected);
+        }
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
@@ -0,0 +1,87 @@
+#include "./pedersen.hpp"
+#include "../pedersen_commitment/pedersen.hpp"
+#include "./pedersen_reference.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+std::vector<grumpkin::fq> random_inputs(const size_t count)
+{
+    std::vector<grumpkin::fq> inputs(count);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    return inputs;
+}
+} // namespace
+
+/**
+ * @brief Baseline: commit by a variable-base scalar multiplication per generator
+ */
+void pedersen_commit_scalar_mul_bench(State& state) noexcept
+{
+    using Element = crypto::pedersen_commitment::Element;
+    const auto inputs = random_inputs(static_cast<size_t>(state.range(0)));
+    crypto::pedersen_commitment::GeneratorContext context;
+    const auto generators = context.generators->get(inputs.size());
+    for (auto _ : state) {
+        Element result = grumpkin::g1::point_at_infinity;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        }
+        DoNotOptimize(result.normalize());
+    }
+}
+BENCHMARK(pedersen_commit_scalar_mul_bench)->Arg(2)->Arg(16);
+
+/**
+ * @brief Commit using the precomputed fixed-base tables of the generators
+ */
+void pedersen_commit_native_bench(State& state) noexcept
+{
+    const auto inputs = random_inputs(static_cast<size_t>(state.range(0)));
+    // Build the tables outside of the timed loop
+    DoNotOptimize(crypto::pedersen_commitment::commit_native(inputs));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_commitment::commit_native(inputs));
+    }
+}
+BENCHMARK(pedersen_commit_native_bench)->Arg(2)->Arg(16);
+
+void pedersen_hash_bench(State& state) noexcept
+{
+    const auto inputs = random_inputs(2);
+    DoNotOptimize(crypto::pedersen_hash::hash(inputs));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash(inputs));
+    }
+}
+BENCHMARK(pedersen_hash_bench);
+
+/**
+ * @brief Baseline: hash a buffer by converting all of it to field elements first, one byte shift at a time
+ */
+void pedersen_hash_buffer_materialized_bench(State& state) noexcept
+{
+    const std::vector<uint8_t> input(static_cast<size_t>(state.range(0)), 0xab);
+    for (auto _ : state) {
+        DoNotOptimize(crypto::reference_hash_buffer(input));
+    }
+}
+BENCHMARK(pedersen_hash_buffer_materialized_bench)->Arg(1 << 10)->Arg(1 << 14);
+
+/**
+ * @brief Hash a buffer with the streaming hasher (which hash_buffer uses)
+ */
+void pedersen_hash_buffer_bench(State& state) noexcept
+{
+    const std::vector<uint8_t> input(static_cast<size_t>(state.range(0)), 0xab);
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_buffer(input));
+    }
+}
+BENCHMARK(pedersen_hash_buffer_bench)->Arg(1 << 10)->Arg(1 << 14);
+
+BENCHMARK_MAIN();
@@ -1,46 +1,39 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/assert.hpp"
+
+#include <algorithm>
 
 namespace crypto {
 
+template <typename Curve> const fixed_base_table<Curve>& pedersen_hash_base<Curve>::length_table()
+{
+    static const fixed_base_table<Curve> table(length_generator);
+    return table;
+}
+
 /**
- * @brief Converts input uint8_t buffers into vector of field elements. Used to hash the Transcript in a
- * SNARK-friendly manner for recursive circuits.
+ * @brief Converts a chunk of at most 31 bytes of a `hash_buffer` input into a field element, reading the bytes as a
+ * big-endian integer.
  *
- * `buffer` is an unstructured byte array we want to convert these into field elements
- * prior to hashing. We do this by splitting buffer into 31-byte chunks.
- *
- * @param buffer
- * @return std::vector<Fq>
+ * @details The chunk is assembled one 64-bit limb at a time (limb k holds the bytes that end 8k bytes before the end of
+ * the chunk), rather than by shifting a uint256_t once per byte.
  */
 template <typename Curve>
-std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer(const std::vector<uint8_t>& input)
+typename Curve::BaseField pedersen_hash_base<Curve>::convert_chunk(const uint8_t* chunk, const size_t num_bytes)
 {
-    const size_t num_bytes = input.size();
-    const size_t bytes_per_element = 31;
-    size_t num_elements = static_cast<size_t>(num_bytes % bytes_per_element != 0) + (num_bytes / bytes_per_element);
-
-    const auto slice = [](const std::vector<uint8_t>& data, const size_t start, const size_t slice_size) {
-        uint256_t result(0);
-        for (size_t i = 0; i < slice_size; ++i) {
-            result = (result << uint256_t(8));
-            result += uint256_t(data[i + start]);
-        }
-        return Fq(result);
-    };
-
-    std::vector<Fq> elements;
-    for (size_t i = 0; i < num_elements; ++i) {
-        size_t bytes_to_slice = 0;
-        if (i == num_elements - 1) {
-            bytes_to_slice = num_bytes - (i * bytes_per_element);
-        } else {
-            bytes_to_slice = bytes_per_element;
+    ASSERT(num_bytes <= 31);
+    std::array<uint64_t, 4> limbs{};
+    for (size_t k = 0; k < limbs.size() && 8 * k < num_bytes; ++k) {
+        const size_t end = num_bytes - 8 * k;
+        const size_t start = end > 8 ? end - 8 : 0;
+        uint64_t limb = 0;
+        for (size_t i = start; i < end; ++i) {
+            limb = (limb << 8) | chunk[i];
         }
-        Fq element = slice(input, i * bytes_per_element, bytes_to_slice);
-        elements.emplace_back(element);
+        limbs[k] = limb;
     }
-    return elements;
+    return Fq(uint256_t(limbs[0], limbs[1], limbs[2], limbs[3]));
 }
 
 /**
@@ -58,28 +51,97 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
+    Element result = length_table().mul(inputs.size());
     return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
 }
 
 /**
  * @brief Given an arbitrary length of bytes, convert them to fields and hash the result using the default generators.
+ *
+ * @details The bytes are split into 31-byte big-endian chunks (the last one possibly shorter). Fewer than two chunks
+ * are hashed directly; otherwise the first two chunks are hashed together and every further chunk is hashed with the
+ * running result. This is computed with `buffer_hasher`.
  */
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash_buffer(const std::vector<uint8_t>& input,
                                                                  const GeneratorContext context)
 {
-    std::vector<Fq> converted = convert_buffer(input);
+    buffer_hasher hasher(context);
+    hasher.update(input);
+    return hasher.finalize();
+}
+
+template <typename Curve>
+pedersen_hash_base<Curve>::buffer_hasher::buffer_hasher(const GeneratorContext context)
+    : context(context)
+    , tables(fixed_base_table<Curve>::get_tables(2, context))
+{}
+
+template <typename Curve> void pedersen_hash_base<Curve>::buffer_hasher::update(std::span<const uint8_t> input)
+{
+    if (num_pending > 0) {
+        const size_t num_copied = std::min(pending.size() - num_pending, input.size());
+        std::copy_n(input.begin(), num_copied, pending.begin() + static_cast<std::ptrdiff_t>(num_pending));
+        num_pending += num_copied;
+        input = input.subspan(num_copied);
+        if (num_pending < pending.size()) {
+            return;
+        }
+        absorb(convert_chunk(pending.data(), pending.size()));
+        num_pending = 0;
+    }
+    // A full chunk converts to the same element whether or not it ends the input, so it is absorbed straight away
+    while (input.size() >= pending.size()) {
+        absorb(convert_chunk(input.data(), pending.size()));
+        input = input.subspan(pending.size());
+    }
+    std::copy(input.begin(), input.end(), pending.begin());
+    num_pending = input.size();
+}
 
-    if (converted.size() < 2) {
-        return hash(converted, context);
+template <typename Curve> typename Curve::BaseField pedersen_hash_base<Curve>::buffer_hasher::finalize() const
+{
+    Fq result = accumulator;
+    size_t num_hashed = num_elements;
+    if (num_pending > 0) {
+        const Fq last = convert_chunk(pending.data(), num_pending);
+        if (num_hashed == 0) {
+            return hash({ last }, context);
+        }
+        result = hash_pair(result, last);
+        ++num_hashed;
     }
-    auto result = hash({ converted[0], converted[1] }, context);
-    for (size_t i = 2; i < converted.size(); ++i) {
-        result = hash({ result, converted[i] }, context);
+    if (num_hashed == 0) {
+        return hash({}, context);
+    }
+    if (num_hashed == 1) {
+        return hash({ result }, context);
     }
     return result;
 }
 
+/**
+ * @brief Absorbs the next element of the input. The first element is held until the second arrives, and from then on
+ * `accumulator` is the hash of all the elements absorbed so far.
+ */
+template <typename Curve> void pedersen_hash_base<Curve>::buffer_hasher::absorb(const Fq& element)
+{
+    accumulator = (num_elements == 0) ? element : hash_pair(accumulator, element);
+    ++num_elements;
+}
+
+/**
+ * @brief Computes `hash({ lhs, rhs }, context)` with the tables looked up at construction
+ */
+template <typename Curve>
+typename Curve::BaseField pedersen_hash_base<Curve>::buffer_hasher::hash_pair(const Fq& lhs, const Fq& rhs) const
+{
+    static const Element length_term = length_table().mul(2);
+    Element result = length_term;
+    tables.accumulate(0, result, static_cast<uint256_t>(lhs));
+    tables.accumulate(1, result, static_cast<uint256_t>(rhs));
+    return result.normalize().x;
+}
+
 template class pedersen_hash_base<curve::Grumpkin>;
 } // namespace crypto
\ No newline at end of file
@@ -1,8 +1,14 @@
 #pragma once
 
+#include "../generators/fixed_base_table.hpp"
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <array>
+#include <span>
+
 namespace crypto {
+
 /**
  * @brief Performs pedersen hashes!
  *
@@ -32,8 +38,34 @@ template <typename Curve> class pedersen_hash_base {
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
+    /**
+     * @brief Computes `hash_buffer` over input that arrives in pieces, without holding the whole input or its field
+     * element encoding in memory.
+     *
+     * @details Constructing the hasher initializes it; `update` absorbs the next piece of input and `finalize` returns
+     * the hash of everything absorbed so far. At most one partial 31-byte chunk is buffered between calls to `update`.
+     */
+    class buffer_hasher {
+      public:
+        explicit buffer_hasher(GeneratorContext context = {});
+        void update(std::span<const uint8_t> input);
+        Fq finalize() const;
+
+      private:
+        void absorb(const Fq& element);
+        Fq hash_pair(const Fq& lhs, const Fq& rhs) const;
+
+        GeneratorContext context;
+        typename fixed_base_table<Curve>::Tables tables;
+        std::array<uint8_t, 31> pending{};
+        size_t num_pending = 0;
+        size_t num_elements = 0;
+        Fq accumulator = Fq::zero();
+    };
+
   private:
-    static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
+    static const fixed_base_table<Curve>& length_table();
+    static Fq convert_chunk(const uint8_t* chunk, size_t num_bytes);
 };
 
 extern template class pedersen_hash_base<curve::Grumpkin>;
@@ -1,6 +1,7 @@
 #include "pedersen.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
+#include "pedersen_reference.hpp"
 #include <gtest/gtest.h>
 
 namespace crypto {
@@ -21,4 +22,30 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashBufferStreaming)
+{
+    for (const size_t num_bytes : std::vector<size_t>{ 0, 1, 30, 31, 32, 62, 63, 100, 200 }) {
+        std::vector<uint8_t> input(num_bytes);
+        for (size_t i = 0; i < num_bytes; ++i) {
+            input[i] = static_cast<uint8_t>(255 - 7 * i);
+        }
+        const pedersen_hash::GeneratorContext context(3);
+        const auto expected = reference_hash_buffer(input, context);
+        EXPECT_EQ(pedersen_hash::hash_buffer(input, context), expected);
+
+        // Split the input in two at every position, and also feed it one byte at a time
+        for (size_t split = 0; split <= num_bytes; ++split) {
+            pedersen_hash::buffer_hasher hasher(context);
+            hasher.update(std::span(input).subspan(0, split));
+            hasher.update(std::span(input).subspan(split));
+            EXPECT_EQ(hasher.finalize(), expected);
+        }
+        pedersen_hash::buffer_hasher hasher(context);
+        for (const auto byte : input) {
+            hasher.update(std::span(&byte, 1));
+        }
+        EXPECT_EQ(hasher.finalize(), expected);
+    }
+}
+
 } // namespace crypto
\ No newline at end of file
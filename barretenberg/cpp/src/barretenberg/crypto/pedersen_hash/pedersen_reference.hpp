@@ -0,0 +1,36 @@
+#pragma once
+
+#include "./pedersen.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace crypto {
+
+/**
+ * @brief hash_buffer, computed the way it was before it was streamed: the whole buffer is converted to field elements
+ * first, shifting one byte at a time into a uint256_t. Shared by the tests and benchmarks of the streaming hasher.
+ */
+inline pedersen_hash::Fq reference_hash_buffer(const std::vector<uint8_t>& input,
+                                               const pedersen_hash::GeneratorContext context = {})
+{
+    std::vector<pedersen_hash::Fq> elements;
+    for (size_t start = 0; start < input.size(); start += 31) {
+        uint256_t element = 0;
+        for (size_t i = start; i < std::min(start + 31, input.size()); ++i) {
+            element = (element << 8) + uint256_t(input[i]);
+        }
+        elements.emplace_back(element);
+    }
+    if (elements.size() < 2) {
+        return pedersen_hash::hash(elements, context);
+    }
+    auto result = pedersen_hash::hash({ elements[0], elements[1] }, context);
+    for (size_t i = 2; i < elements.size(); ++i) {
+        result = pedersen_hash::hash({ result, elements[i] }, context);
+    }
+    return result;
+}
+
+} // namespace crypto
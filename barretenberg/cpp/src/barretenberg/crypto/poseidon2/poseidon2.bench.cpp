@@ -1,4 +1,5 @@
 #include "./poseidon2.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <benchmark/benchmark.h>
 
@@ -25,5 +26,65 @@ void native_poseidon2_commitment_bench(State& state) noexcept
 }
 BENCHMARK(native_poseidon2_commitment_bench)->Arg(10)->Arg(1000)->Arg(10000);
 
+using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+/**
+ * @brief Single-threaded permutation throughput, permuting one state at a time or NUM_STATES interleaved states
+ */
+template <size_t NUM_STATES> void native_poseidon2_permutation_bench(State& state) noexcept
+{
+    std::array<Permutation::State, NUM_STATES> states;
+    for (auto& permutation_state : states) {
+        for (auto& element : permutation_state) {
+            element = grumpkin::fq::random_element();
+        }
+    }
+    for (auto _ : state) {
+        if constexpr (NUM_STATES == 1) {
+            states[0] = Permutation::permutation(states[0]);
+        } else {
+            Permutation::permutation_batch(states);
+        }
+        DoNotOptimize(states);
+    }
+    const auto num_permuted = static_cast<double>(state.iterations()) * static_cast<double>(NUM_STATES);
+    state.counters["permutations/s"] = Counter(num_permuted, Counter::kIsRate);
+}
+BENCHMARK(native_poseidon2_permutation_bench<1>);
+BENCHMARK(native_poseidon2_permutation_bench<2>);
+BENCHMARK(native_poseidon2_permutation_bench<4>);
+BENCHMARK(native_poseidon2_permutation_bench<8>);
+
+/**
+ * @brief Throughput of hash_many on pairs of field elements (as when hashing a layer of a merkle tree), compared to
+ * hashing each pair in turn. Rates are also reported per core.
+ */
+void native_poseidon2_hash_pairs_bench(State& state, bool use_hash_many) noexcept
+{
+    const auto num_hashes = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<grumpkin::fq>> inputs(num_hashes);
+    for (auto& input : inputs) {
+        input = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    const size_t num_cores = use_hash_many ? get_num_cpus() : 1;
+    for (auto _ : state) {
+        if (use_hash_many) {
+            DoNotOptimize(Poseidon2::hash_many(inputs));
+        } else {
+            std::vector<grumpkin::fq> outputs(num_hashes);
+            for (size_t i = 0; i < num_hashes; ++i) {
+                outputs[i] = Poseidon2::hash(inputs[i]);
+            }
+            DoNotOptimize(outputs);
+        }
+    }
+    const auto num_hashed = static_cast<double>(state.iterations()) * static_cast<double>(num_hashes);
+    state.counters["hashes/s"] = Counter(num_hashed, Counter::kIsRate);
+    state.counters["hashes/s/core"] = Counter(num_hashed / static_cast<double>(num_cores), Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(native_poseidon2_hash_pairs_bench, sequential, false)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_CAPTURE(native_poseidon2_hash_pairs_bench, hash_many, true)->Arg(1 << 10)->Arg(1 << 14);
+
 BENCHMARK_MAIN();
 // } // namespace crypto
\ No newline at end of file
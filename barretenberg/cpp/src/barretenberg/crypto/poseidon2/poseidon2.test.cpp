@@ -42,8 +42,82 @@ TEST(Poseidon2, ConsistencyCheck)
     std::array<barretenberg::fr, 4> input{ a, b, c, d };
     auto result = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(input);
 
-    barretenberg::fr expected(std::string("0x150c19ae11b3290c137c7a4d760d9482a6581d731535f560c3601d6a766b0937"));
+    barretenberg::fr expected(std::string("0x2f43a0f83b51a6f5fc839dea0ecec74947637802a579fa9841930a25a0bcec11"));
 
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2, HashBuffer)
+{
+    std::vector<uint8_t> buffer(40);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = engine.get_random_uint8();
+    }
+
+    // 31 bytes per element, big-endian
+    uint256_t first = 0;
+    for (size_t i = 0; i < 31; ++i) {
+        first = (first << 8) + uint256_t(buffer[i]);
+    }
+    uint256_t second = 0;
+    for (size_t i = 31; i < buffer.size(); ++i) {
+        second = (second << 8) + uint256_t(buffer[i]);
+    }
+    // followed by the number of bytes
+    const std::vector<barretenberg::fr> elements{ first, second, buffer.size() };
+
+    EXPECT_EQ(crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_buffer(buffer),
+              crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(elements));
+
+    // Buffers that only differ by leading zero bytes in their last element, or by a trailing zero element, hash
+    // differently
+    EXPECT_NE(crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_buffer({ 1 }),
+              crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_buffer({ 0, 1 }));
+    std::vector<uint8_t> extended(buffer.begin(), buffer.begin() + 31);
+    const auto short_hash = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_buffer(extended);
+    extended.push_back(0);
+    EXPECT_NE(crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_buffer(extended), short_hash);
+}
+TEST(Poseidon2, HashMany)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // batches of equal-length inputs are hashed in lockstep, the trailing and mixed-length batches one at a time
+    const size_t num_inputs = 4 * Poseidon2::HASH_BATCH_SIZE + 3;
+    std::vector<std::vector<barretenberg::fr>> inputs(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        const size_t length = i < 2 * Poseidon2::HASH_BATCH_SIZE ? 2 : i % 7;
+        for (size_t j = 0; j < length; ++j) {
+            inputs[i].emplace_back(barretenberg::fr::random_element(&engine));
+        }
+    }
+
+    const auto outputs = Poseidon2::hash_many(inputs);
+    ASSERT_EQ(outputs.size(), num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        EXPECT_EQ(outputs[i], Poseidon2::hash(inputs[i]));
+    }
+}
+
+TEST(Poseidon2, HashFixedLengthBatch)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t NUM_HASHES = 3;
+
+    // cover the empty input, a partial chunk and several chunks
+    for (size_t length : std::array<size_t, 5>{ 0, 1, 3, 4, 10 }) {
+        std::array<std::vector<barretenberg::fr>, NUM_HASHES> inputs;
+        std::array<std::span<const barretenberg::fr>, NUM_HASHES> spans;
+        for (size_t i = 0; i < NUM_HASHES; ++i) {
+            for (size_t j = 0; j < length; ++j) {
+                inputs[i].emplace_back(barretenberg::fr::random_element(&engine));
+            }
+            spans[i] = inputs[i];
+        }
+        const auto outputs = Poseidon2::Sponge::hash_fixed_length_batch<NUM_HASHES>(spans);
+        for (size_t i = 0; i < NUM_HASHES; ++i) {
+            EXPECT_EQ(outputs[i], Poseidon2::hash(inputs[i]));
+        }
+    }
+}
 } // namespace poseidon2_tests
\ No newline at end of file
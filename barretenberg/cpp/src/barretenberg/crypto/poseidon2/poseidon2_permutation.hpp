@@ -123,6 +123,47 @@ template <typename Params> class Poseidon2Permutation {
         }
     }
 
+    /**
+     * @brief Apply the s-box to every element of NUM_STATES states. Each step of x^5 = x * (x^2)^2 is applied to all of
+     * the elements before the next one, so the multiplications in flight at any time are independent of each other.
+     */
+    template <size_t NUM_STATES> static constexpr void apply_sbox_batch(std::array<State, NUM_STATES>& states)
+    {
+        std::array<State, NUM_STATES> powers;
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            for (size_t i = 0; i < t; ++i) {
+                powers[s][i] = states[s][i].sqr();
+            }
+        }
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            for (size_t i = 0; i < t; ++i) {
+                powers[s][i].self_sqr();
+            }
+        }
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            for (size_t i = 0; i < t; ++i) {
+                states[s][i] *= powers[s][i];
+            }
+        }
+    }
+
+    /**
+     * @brief Apply the s-box to the first element of NUM_STATES states, see apply_sbox_batch
+     */
+    template <size_t NUM_STATES> static constexpr void apply_single_sbox_batch(std::array<State, NUM_STATES>& states)
+    {
+        std::array<FF, NUM_STATES> powers;
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            powers[s] = states[s][0].sqr();
+        }
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            powers[s].self_sqr();
+        }
+        for (size_t s = 0; s < NUM_STATES; ++s) {
+            states[s][0] *= powers[s];
+        }
+    }
+
     static constexpr State permutation(const State& input)
     {
         // deep copy
@@ -152,5 +193,52 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Apply the permutation to NUM_STATES independent states in place, with the same result as calling
+     * permutation() on each of them.
+     *
+     * @details The rounds are interleaved across the states. The s-box of a single state is a chain of dependent
+     * multiplications (and a partial round has only one s-box), so permuting one state at a time leaves the multiplier
+     * waiting on its own results. Interleaving gives the CPU NUM_STATES independent chains to pipeline.
+     */
+    template <size_t NUM_STATES> static constexpr void permutation_batch(std::array<State, NUM_STATES>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+            }
+            apply_sbox_batch(states);
+            for (auto& state : states) {
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+            }
+            apply_single_sbox_batch(states);
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+            }
+            apply_sbox_batch(states);
+            for (auto& state : states) {
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace crypto
\ No newline at end of file
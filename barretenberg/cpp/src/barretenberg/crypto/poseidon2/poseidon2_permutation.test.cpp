@@ -62,4 +62,24 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2Permutation, BatchMatchesSingle)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t NUM_STATES = 5;
+
+    std::array<Permutation::State, NUM_STATES> states;
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = barretenberg::fr::random_element(&engine);
+        }
+    }
+    std::array<Permutation::State, NUM_STATES> expected;
+    for (size_t i = 0; i < NUM_STATES; ++i) {
+        expected[i] = Permutation::permutation(states[i]);
+    }
+
+    Permutation::permutation_batch(states);
+    EXPECT_EQ(states, expected);
+}
+
 } // namespace poseidon2_tests
\ No newline at end of file
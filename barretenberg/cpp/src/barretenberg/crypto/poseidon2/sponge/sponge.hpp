@@ -1,10 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace crypto {
@@ -133,7 +135,8 @@ template <typename FF, size_t rate, size_t capacity, size_t t, typename Permutat
     {
         size_t in_len = input.size();
         const uint256_t iv = (static_cast<uint256_t>(in_len) << 64) + out_len - 1;
-        FieldSponge sponge(iv);
+        // N.B. FieldSponge sponge(iv) would pick uint256_t's uint64_t conversion and drop the input length from the IV
+        FieldSponge sponge{ FF(iv) };
 
         for (size_t i = 0; i < in_len; ++i) {
             sponge.absorb(input[i]);
@@ -164,5 +167,47 @@ template <typename FF, size_t rate, size_t capacity, size_t t, typename Permutat
         return hash_internal<out_len, true>(input);
     }
     static FF hash_variable_length(std::span<FF> input) { return hash_variable_length<1>(input)[0]; }
+
+    /**
+     * @brief Compute the fixed-length hashes of NUM_HASHES inputs of equal length in lockstep, so that each duplex is a
+     * single call to Permutation::permutation_batch. Produces the same outputs as hash_fixed_length on each input.
+     *
+     * @details For a fixed-length input the absorb/squeeze schedule only depends on the input length: the inputs are
+     * added into the state `rate` elements at a time (the last chunk zero-padded) with a permutation after each chunk,
+     * and the output is the first element of the final state.
+     */
+    template <size_t NUM_HASHES>
+    static std::array<FF, NUM_HASHES> hash_fixed_length_batch(const std::array<std::span<const FF>, NUM_HASHES>& inputs)
+    {
+        constexpr size_t out_len = 1;
+        const size_t in_len = inputs[0].size();
+        std::array<std::array<FF, t>, NUM_HASHES> states;
+        for (size_t j = 0; j < NUM_HASHES; ++j) {
+            ASSERT(inputs[j].size() == in_len);
+            // initialise the state exactly as hash_internal does
+            const uint256_t iv = (static_cast<uint256_t>(in_len) << 64) + out_len - 1;
+            FieldSponge sponge{ FF(iv) };
+            states[j] = sponge.state;
+        }
+
+        // an empty input still squeezes out one permutation of the initial state
+        const size_t num_duplexes = in_len == 0 ? 1 : (in_len + rate - 1) / rate;
+        for (size_t i = 0; i < num_duplexes; ++i) {
+            const size_t chunk_start = i * rate;
+            const size_t chunk_end = std::min(chunk_start + rate, in_len);
+            for (size_t j = 0; j < NUM_HASHES; ++j) {
+                for (size_t k = chunk_start; k < chunk_end; ++k) {
+                    states[j][k - chunk_start] += inputs[j][k];
+                }
+            }
+            Permutation::permutation_batch(states);
+        }
+
+        std::array<FF, NUM_HASHES> output;
+        for (size_t j = 0; j < NUM_HASHES; ++j) {
+            output[j] = states[j][0];
+        }
+        return output;
+    }
 };
 } // namespace crypto
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "schnorr.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+using Fq = grumpkin::fq;
+using Fr = grumpkin::fr;
+using G1 = grumpkin::g1;
+
+struct SignedMessages {
+    std::vector<std::string> messages;
+    std::vector<G1::affine_element> public_keys;
+    std::vector<crypto::schnorr::signature> signatures;
+
+    explicit SignedMessages(const size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            crypto::schnorr::key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.push_back("transaction " + std::to_string(i));
+            public_keys.push_back(account.public_key);
+            signatures.push_back(crypto::schnorr::construct_signature<Blake2sHasher, Fq, Fr, G1>(messages[i], account));
+        }
+    }
+};
+
+void set_signature_rate(State& state)
+{
+    state.counters["signatures"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(state.range(0)), Counter::kIsRate);
+}
+} // namespace
+
+/**
+ * @brief Baseline: verify Schnorr signatures over Grumpkin one at a time
+ */
+void schnorr_verify_bench(State& state) noexcept
+{
+    const SignedMessages batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch.signatures.size(); ++i) {
+            DoNotOptimize(crypto::schnorr::verify_signature<Blake2sHasher, Fq, Fr, G1>(
+                batch.messages[i], batch.public_keys[i], batch.signatures[i]));
+        }
+    }
+    set_signature_rate(state);
+}
+BENCHMARK(schnorr_verify_bench)->Arg(1024)->Unit(kMillisecond);
+
+/**
+ * @brief Verify the same signatures with batch_verify_signatures
+ */
+void schnorr_batch_verify_bench(State& state) noexcept
+{
+    const SignedMessages batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::schnorr::batch_verify_signatures<Blake2sHasher, Fq, Fr, G1>(
+            batch.messages, batch.public_keys, batch.signatures));
+    }
+    set_signature_rate(state);
+}
+BENCHMARK(schnorr_batch_verify_bench)->Arg(1024)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 #include <array>
 #include <memory.h>
 #include <string>
+#include <vector>
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
@@ -38,6 +39,11 @@ struct signature {
 template <typename Hash, typename Fq, typename Fr, typename G1>
 bool verify_signature(const std::string& message, const typename G1::affine_element& public_key, const signature& sig);
 
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> batch_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<signature>& signatures);
+
 template <typename Hash, typename Fq, typename Fr, typename G1>
 signature construct_signature(const std::string& message, const key_pair<Fr, G1>& account);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/generators/double_base_mul.hpp"
 #include "barretenberg/crypto/hmac/hmac.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 
@@ -152,5 +154,60 @@ bool verify_signature(const std::string& message, const typename G1::affine_elem
     auto target_e = generate_schnorr_challenge<Hash, G1>(message, public_key, R);
     return std::equal(sig.e.begin(), sig.e.end(), target_e.begin(), target_e.end());
 }
+
+/**
+ * @brief Verify many Schnorr signatures, with the same result for each one as verify_signature
+ *
+ * @details A signature only holds the challenge e and not the nonce R, so R_i = s_i • G + e_i • pk_i has to be
+ * recomputed for every signature before its challenge can be hashed, and the signatures cannot be folded into a single
+ * random linear combination. Instead the double scalar multiplications share a precomputed table of G and a batched
+ * inversion (see batch_double_base_mul), and the multiplications and challenge hashes are spread across threads.
+ *
+ * @return whether each signature is valid for the message and public key at the same index
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> batch_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<signature>& signatures)
+{
+    ASSERT(messages.size() == public_keys.size() && messages.size() == signatures.size());
+    const size_t num_signatures = signatures.size();
+
+    // Signatures that fail the checks verify_signature makes before its scalar multiplication are marked invalid, and
+    // their multiplication is replaced by a trivial one
+    std::vector<uint8_t> is_valid(num_signatures);
+    std::vector<Fr> e(num_signatures);
+    std::vector<Fr> s(num_signatures);
+    std::vector<typename G1::affine_element> keys(num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        e[i] = Fr::serialize_from_buffer(&signatures[i].e[0]);
+        s[i] = Fr::serialize_from_buffer(&signatures[i].s[0]);
+        is_valid[i] = public_keys[i].on_curve() && !public_keys[i].is_point_at_infinity() && s[i] != 0 && e[i] != 0;
+        keys[i] = is_valid[i] ? public_keys[i] : G1::affine_one;
+        if (!is_valid[i]) {
+            e[i] = 0;
+            s[i] = 0;
+        }
+    }
+
+    // R = g^{sig.s} • pub^{sig.e}
+    const auto R = batch_double_base_mul<G1>(s, keys, e);
+
+    const size_t num_threads = std::max(std::min(get_num_cpus(), num_signatures), size_t(1));
+    const size_t signatures_per_thread = (num_signatures + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * signatures_per_thread, num_signatures);
+        const size_t end = std::min(start + signatures_per_thread, num_signatures);
+        for (size_t i = start; i < end; ++i) {
+            if (!is_valid[i] || R[i].is_point_at_infinity()) {
+                is_valid[i] = false;
+                continue;
+            }
+            auto target_e = generate_schnorr_challenge<Hash, G1>(messages[i], public_keys[i], R[i]);
+            is_valid[i] = std::equal(signatures[i].e.begin(), signatures[i].e.end(), target_e.begin(), target_e.end());
+        }
+    });
+    return std::vector<bool>(is_valid.begin(), is_valid.end());
+}
 } // namespace schnorr
 } // namespace crypto
@@ -137,3 +137,35 @@ TEST(schnorr, hmac_signature_consistency)
         message_b, account_b.public_key, signature_h);
     EXPECT_EQ(res, true);
 }
+
+TEST(schnorr, batch_verify_signatures)
+{
+    constexpr size_t num_signatures = 20;
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<crypto::schnorr::signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        auto account = generate_signature();
+        messages.push_back("message " + std::to_string(i));
+        public_keys.push_back(account.public_key);
+        signatures.push_back(
+            construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(messages[i], account));
+    }
+
+    // wrong message, wrong key, tampered s, zero e and a public key that is not on the curve
+    messages[3] = "another message";
+    public_keys[7] = generate_signature().public_key;
+    signatures[11].s[31] ^= 1;
+    signatures[13].e.fill(0);
+    public_keys[17].x += 1;
+
+    const auto results = batch_verify_signatures<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, public_keys, signatures);
+    ASSERT_EQ(results.size(), num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const bool expected = verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            messages[i], public_keys[i], signatures[i]);
+        EXPECT_EQ(results[i], expected) << "signature " << i;
+        EXPECT_EQ(results[i], i != 3 && i != 7 && i != 11 && i != 13 && i != 17);
+    }
+}
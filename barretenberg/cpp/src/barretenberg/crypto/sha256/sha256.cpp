@@ -4,6 +4,10 @@
 #include <array>
 #include <memory.h>
 
+#ifdef BBERG_MULTI_BUFFER_X86
+#include <immintrin.h>
+#endif
+
 namespace sha256 {
 
 namespace {
@@ -182,4 +186,258 @@ template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& inp
 template hash sha256<std::string>(const std::string& input);
 template hash sha256<std::span<uint8_t>>(const std::span<uint8_t>& input);
 
+namespace {
+using crypto::multi_buffer::Backend;
+using crypto::multi_buffer::BLOCK_SIZE;
+using crypto::multi_buffer::BlockView;
+
+uint32_t load_be32(const uint8_t* src)
+{
+    return (static_cast<uint32_t>(src[0]) << 24) | (static_cast<uint32_t>(src[1]) << 16) |
+           (static_cast<uint32_t>(src[2]) << 8) | static_cast<uint32_t>(src[3]);
+}
+
+void store_be32(uint8_t* dst, const uint32_t word)
+{
+    dst[0] = static_cast<uint8_t>(word >> 24);
+    dst[1] = static_cast<uint8_t>(word >> 16);
+    dst[2] = static_cast<uint8_t>(word >> 8);
+    dst[3] = static_cast<uint8_t>(word);
+}
+
+// A message of `length` bytes, followed by the 0x80 byte and the 8-byte bit length, takes this many blocks
+size_t num_padded_blocks(const size_t length)
+{
+    return (length + 9 + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+/**
+ * @brief View `input` as its padded blocks: the full blocks of the message are read in place and the last one or two
+ * blocks, which hold the rest of the message and the padding, are built in the tail
+ */
+BlockView padded_blocks(const std::vector<uint8_t>& input)
+{
+    BlockView view;
+    view.data = input.data();
+    view.num_full_blocks = input.size() / BLOCK_SIZE;
+    const size_t num_tail_blocks = num_padded_blocks(input.size()) - view.num_full_blocks;
+    const size_t remainder = input.size() - view.num_full_blocks * BLOCK_SIZE;
+    std::copy_n(input.data() + view.num_full_blocks * BLOCK_SIZE, remainder, view.tail.begin());
+    view.tail[remainder] = 0x80;
+    const uint64_t num_bits = static_cast<uint64_t>(input.size()) * 8;
+    uint8_t* length_bytes = view.tail.data() + num_tail_blocks * BLOCK_SIZE - 8;
+    store_be32(length_bytes, static_cast<uint32_t>(num_bits >> 32));
+    store_be32(length_bytes + 4, static_cast<uint32_t>(num_bits));
+    return view;
+}
+
+/**
+ * @brief SHA-256 of LANES messages that have the same number of padded blocks, one message per lane of Vec
+ */
+template <typename Vec, size_t LANES>
+BBERG_INLINE void sha256_lanes(const std::array<BlockView, LANES>& messages,
+                               const size_t num_blocks,
+                               const std::array<uint8_t*, LANES>& outputs)
+{
+    std::array<Vec, 8> state;
+    for (size_t i = 0; i < 8; ++i) {
+        state[i] = Vec{} + init_constants[i];
+    }
+    std::array<Vec, 64> w;
+    std::array<const uint8_t*, LANES> blocks;
+    for (size_t block = 0; block < num_blocks; ++block) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            blocks[lane] = messages[lane].block(block);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            crypto::multi_buffer::gather_word(w[i], blocks, i, load_be32);
+        }
+        for (size_t i = 16; i < 64; ++i) {
+            const Vec s0 = BBERG_MULTI_BUFFER_ROTR32(w[i - 15], 7) ^ BBERG_MULTI_BUFFER_ROTR32(w[i - 15], 18) ^
+                           (w[i - 15] >> 3);
+            const Vec s1 = BBERG_MULTI_BUFFER_ROTR32(w[i - 2], 17) ^ BBERG_MULTI_BUFFER_ROTR32(w[i - 2], 19) ^
+                           (w[i - 2] >> 10);
+            w[i] = w[i - 16] + w[i - 7] + s0 + s1;
+        }
+
+        Vec a = state[0];
+        Vec b = state[1];
+        Vec c = state[2];
+        Vec d = state[3];
+        Vec e = state[4];
+        Vec f = state[5];
+        Vec g = state[6];
+        Vec h = state[7];
+        for (size_t i = 0; i < 64; ++i) {
+            const Vec S1 = BBERG_MULTI_BUFFER_ROTR32(e, 6) ^ BBERG_MULTI_BUFFER_ROTR32(e, 11) ^
+                           BBERG_MULTI_BUFFER_ROTR32(e, 25);
+            const Vec ch = (e & f) ^ (~e & g);
+            const Vec temp1 = h + S1 + ch + round_constants[i] + w[i];
+            const Vec S0 = BBERG_MULTI_BUFFER_ROTR32(a, 2) ^ BBERG_MULTI_BUFFER_ROTR32(a, 13) ^
+                           BBERG_MULTI_BUFFER_ROTR32(a, 22);
+            const Vec maj = (a & b) ^ (a & c) ^ (b & c);
+            const Vec temp2 = S0 + maj;
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        crypto::multi_buffer::scatter_word(state[i], outputs, i, store_be32);
+    }
+}
+
+#ifdef BBERG_MULTI_BUFFER_X86
+template <size_t LANES> using LaneBlocks = std::array<BlockView, LANES>;
+template <size_t LANES> using LaneOutputs = std::array<uint8_t*, LANES>;
+
+__attribute__((target("avx2"))) void sha256_x8(const LaneBlocks<8>& messages,
+                                               size_t num_blocks,
+                                               const LaneOutputs<8>& outputs)
+{
+    sha256_lanes<crypto::multi_buffer::u32x8, 8>(messages, num_blocks, outputs);
+}
+
+__attribute__((target("avx512f"))) void sha256_x16(const LaneBlocks<16>& messages,
+                                                   size_t num_blocks,
+                                                   const LaneOutputs<16>& outputs)
+{
+    sha256_lanes<crypto::multi_buffer::u32x16, 16>(messages, num_blocks, outputs);
+}
+
+/**
+ * @brief Compress `num_blocks` consecutive blocks into `state` with the SHA extensions.
+ *
+ * @details The SHA-NI round instructions keep the state as the two registers ABEF and CDGH and process two rounds per
+ * sha256rnds2; sha256msg1/sha256msg2 extend the message schedule four words at a time.
+ */
+__attribute__((target("sha,sse4.1"))) void sha256_blocks_shani(std::array<uint32_t, 8>& state,
+                                                               const uint8_t* data,
+                                                               size_t num_blocks)
+{
+    const __m128i byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);               // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);         // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);      // CDGH
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const __m128i abef_save = state0;
+        const __m128i cdgh_save = state1;
+
+        __m128i msg[4];
+        for (size_t i = 0; i < 4; ++i) {
+            msg[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + block * BLOCK_SIZE + 16 * i)), byte_swap_mask);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            __m128i rounds_input = _mm_add_epi32(
+                msg[i % 4], _mm_loadu_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, rounds_input);
+            rounds_input = _mm_shuffle_epi32(rounds_input, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, rounds_input);
+            if (i < 12) {
+                // w[4i+16..4i+19] from w[4i..4i+3], w[4i+4..], w[4i+8..] and w[4i+12..]
+                __m128i next = _mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(msg[(i + 3) % 4], msg[(i + 2) % 4], 4));
+                msg[i % 4] = _mm_sha256msg2_epu32(next, msg[(i + 3) % 4]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);    // ABEF
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+hash sha256_shani(const std::vector<uint8_t>& input)
+{
+    const BlockView view = padded_blocks(input);
+    std::array<uint32_t, 8> state;
+    prepare_constants(state);
+    sha256_blocks_shani(state, view.data, view.num_full_blocks);
+    sha256_blocks_shani(state, view.tail.data(), num_padded_blocks(input.size()) - view.num_full_blocks);
+    hash output;
+    for (size_t i = 0; i < 8; ++i) {
+        store_be32(&output[4 * i], state[i]);
+    }
+    return output;
+}
+#endif
+
+template <size_t LANES, typename HashLanes>
+void sha256_many_lanes(const std::vector<std::vector<uint8_t>>& inputs,
+                       std::vector<hash>& outputs,
+                       HashLanes hash_lanes)
+{
+    crypto::multi_buffer::for_each_group<LANES>(
+        inputs, num_padded_blocks, [&](const std::array<size_t, LANES>& indices, size_t num_blocks) {
+            std::array<BlockView, LANES> messages;
+            std::array<uint8_t*, LANES> lane_outputs;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                messages[lane] = padded_blocks(inputs[indices[lane]]);
+                lane_outputs[lane] = outputs[indices[lane]].data();
+            }
+            hash_lanes(messages, num_blocks, lane_outputs);
+        });
+}
+} // namespace
+
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    // The 16-lane AVX-512 kernel outpaces SHA-NI on 32 to 1024 byte messages, which in turn beats the 8-lane AVX2
+    // kernel (see stdlib/hash/benchmarks/multi_buffer)
+    static const Backend backend = crypto::multi_buffer::select_backend(
+        std::array<Backend, 3>{ Backend::AVX512, Backend::SHA_NI, Backend::AVX2 });
+    return sha256_many(inputs, backend);
+}
+
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs, const Backend backend)
+{
+    ASSERT(crypto::multi_buffer::is_supported(backend));
+    std::vector<hash> outputs(inputs.size());
+    switch (backend) {
+#ifdef BBERG_MULTI_BUFFER_X86
+    case Backend::SHA_NI:
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = sha256_shani(inputs[i]);
+        }
+        break;
+    case Backend::AVX2:
+        sha256_many_lanes<8>(inputs, outputs, sha256_x8);
+        break;
+    case Backend::AVX512:
+        sha256_many_lanes<16>(inputs, outputs, sha256_x16);
+        break;
+#endif
+    default:
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = sha256(inputs[i]);
+        }
+    }
+    return outputs;
+}
+
 } // namespace sha256
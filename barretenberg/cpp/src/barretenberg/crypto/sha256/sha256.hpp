@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/crypto/multi_buffer/multi_buffer.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "stdint.h"
 #include <array>
@@ -19,6 +20,13 @@ extern template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& in
 extern template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 extern template hash sha256<std::string>(const std::string& input);
 
+/**
+ * @brief Hash many independent messages, with the same result as calling sha256 on each of them. Uses the fastest
+ * implementation supported by the CPU unless a backend is given.
+ */
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs);
+std::vector<hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs, crypto::multi_buffer::Backend backend);
+
 inline barretenberg::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256::sha256(input);
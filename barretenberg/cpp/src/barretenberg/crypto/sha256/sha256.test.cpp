@@ -1,4 +1,5 @@
 #include "sha256.hpp"
+#include "barretenberg/crypto/multi_buffer/multi_buffer.test.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
@@ -98,3 +99,12 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, test_sha256_many)
+{
+    using crypto::multi_buffer::Backend;
+    crypto::multi_buffer::test::check_hash_many(
+        { Backend::SCALAR, Backend::SHA_NI, Backend::AVX2, Backend::AVX512 },
+        [](const auto&... args) { return sha256::sha256_many(args...); },
+        [](const auto& input) { return sha256::sha256(input); });
+}
@@ -1,5 +1,4 @@
 #pragma once
-#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/dsl/types.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "blake2s_constraint.hpp"
@@ -40,10 +39,7 @@ struct acir_format {
     std::vector<RecursionConstraint> recursion_constraints;
     // A standard plonk arithmetic constraint, as defined in the poly_triple struct, consists of selector values
     // for q_M,q_L,q_R,q_O,q_C and indices of three variables taking the role of left, right and output wire
-    // This could be a large vector so use slab allocator, we don't expect the blackbox implementations to be so large.
-    std::vector<poly_triple_<curve::BN254::ScalarField>,
-                ContainerSlabAllocator<poly_triple_<curve::BN254::ScalarField>>>
-        constraints;
+    std::vector<poly_triple_<curve::BN254::ScalarField>> constraints;
     std::vector<BlockConstraint> block_constraints;
 
     // For serialization, update with any new fields
@@ -69,7 +65,7 @@ struct acir_format {
     friend bool operator==(acir_format const& lhs, acir_format const& rhs) = default;
 };
 
-using WitnessVector = std::vector<fr, ContainerSlabAllocator<fr>>;
+using WitnessVector = std::vector<fr>;
 
 void read_witness(Builder& builder, std::vector<barretenberg::fr> const& witness);
 
@@ -127,7 +127,7 @@ Builder create_outer_circuit(std::vector<Builder>& inner_circuits)
     // witness count starts at 1 (Composer reserves 1st witness to be the zero-valued zero_idx)
     size_t witness_offset = 1;
     std::array<uint32_t, RecursionConstraint::AGGREGATION_OBJECT_SIZE> output_aggregation_object;
-    std::vector<fr, ContainerSlabAllocator<fr>> witness;
+    WitnessVector witness;
 
     size_t circuit_idx = 0;
     for (auto& inner_circuit : inner_circuits) {
@@ -0,0 +1,57 @@
+#include "acir_composer.hpp"
+#include "barretenberg/dsl/types.hpp"
+#include "xor_program.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+/**
+ * @brief Baseline: per-proof latency of repeatedly proving the same program with its cached proving key, as
+ * AcirComposer::create_proof does, but building each circuit's lookup tables from scratch
+ *
+ * @details The sorted key order of the basic tables is cached process wide, so it is warm here too; the difference to
+ * prove_fixed_program is only the carried-over lookup tables.
+ */
+void prove_fixed_program_rebuilding_tables(State& state) noexcept
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    const auto num_xors = static_cast<uint32_t>(state.range(0));
+    auto constraint_system = acir_proofs::create_xor_program(num_xors);
+    acir_proofs::AcirComposer key_composer(0, false);
+    auto proving_key = key_composer.init_proving_key(constraint_system);
+    const size_t size_hint = key_composer.get_circuit_subgroup_size();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto witness = acir_proofs::create_xor_witness(num_xors);
+        state.ResumeTiming();
+        acir_format::Builder builder(size_hint);
+        acir_format::create_circuit_with_witness(builder, constraint_system, witness);
+        acir_format::Composer composer(proving_key, nullptr);
+        auto prover = composer.create_ultra_with_keccak_prover(builder);
+        DoNotOptimize(prover.construct_proof());
+    }
+}
+
+/**
+ * @brief Per-proof latency of repeatedly proving the same program for new witnesses with AcirComposer, which carries
+ * the lookup tables of the previous circuit over to the next one
+ */
+void prove_fixed_program(State& state) noexcept
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    const auto num_xors = static_cast<uint32_t>(state.range(0));
+    auto constraint_system = acir_proofs::create_xor_program(num_xors);
+    acir_proofs::AcirComposer composer(0, false);
+    composer.init_proving_key(constraint_system);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto witness = acir_proofs::create_xor_witness(num_xors);
+        state.ResumeTiming();
+        DoNotOptimize(composer.create_proof(constraint_system, witness, false));
+    }
+}
+
+BENCHMARK(prove_fixed_program_rebuilding_tables)->Arg(16)->Arg(256)->Unit(kMillisecond);
+BENCHMARK(prove_fixed_program)->Arg(16)->Arg(256)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -9,9 +9,86 @@
 #include "barretenberg/plonk/proof_system/verification_key/sol_gen.hpp"
 #include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include <algorithm>
 
 namespace acir_proofs {
 
+namespace {
+/**
+ * @brief Hashes the structure of a circuit that has not been finalized: the selectors and copy constraints of its
+ * gates, and what finalizing it adds gates for. Witness values are left out, so that every witness of a program gives
+ * the same hash.
+ *
+ * @details The gates are hashed in chunks, several chunks at a time, and the result is the hash of the chunks' hashes
+ * followed by the rest of the circuit's structure.
+ */
+sha256::hash compute_circuit_hash(const acir_format::Builder& builder)
+{
+    using barretenberg::fr;
+    using serialize::write;
+    constexpr size_t GATES_PER_CHUNK = 1 << 12;
+    constexpr size_t CHUNKS_PER_BATCH = 16;
+    constexpr size_t GATE_SIZE =
+        acir_format::Builder::NUM_WIRES * sizeof(uint32_t) + acir_format::Builder::num_selectors * sizeof(fr);
+
+    std::vector<uint8_t> buffer;
+    std::vector<std::vector<uint8_t>> chunks;
+    const auto hash_chunks = [&]() {
+        for (const auto& hash : sha256::sha256_many(chunks)) {
+            write(buffer, hash);
+        }
+        chunks.clear();
+    };
+    const size_t num_gates = builder.num_gates;
+    for (size_t start = 0; start < num_gates; start += GATES_PER_CHUNK) {
+        const size_t end = std::min(start + GATES_PER_CHUNK, num_gates);
+        auto& chunk = chunks.emplace_back();
+        chunk.reserve((end - start) * GATE_SIZE);
+        for (size_t i = start; i < end; ++i) {
+            // Variables that are constrained to be equal share their real variable index
+            for (const auto& wire : builder.wires) {
+                write(chunk, builder.real_variable_index[wire[i]]);
+            }
+            for (const auto& selector : builder.selectors.get()) {
+                write(chunk, selector[i]);
+            }
+        }
+        if (chunks.size() == CHUNKS_PER_BATCH) {
+            hash_chunks();
+        }
+    }
+    hash_chunks();
+
+    write(buffer, static_cast<uint64_t>(num_gates));
+    write(buffer, static_cast<uint64_t>(builder.variables.size()));
+    write(buffer, static_cast<uint32_t>(builder.public_inputs.size()));
+    for (const auto& index : builder.public_inputs) {
+        write(buffer, builder.real_variable_index[index]);
+    }
+    write(buffer, static_cast<uint32_t>(builder.lookup_tables.size()));
+    for (const auto& table : builder.lookup_tables) {
+        write(buffer, static_cast<uint64_t>(table.id));
+        write(buffer, static_cast<uint64_t>(table.lookup_gates.size()));
+    }
+    // Range lists are kept in a hash map, whose order does not follow the circuit
+    std::vector<uint64_t> target_ranges;
+    for (const auto& [target_range, range_list] : builder.range_lists) {
+        target_ranges.push_back(target_range);
+    }
+    std::sort(target_ranges.begin(), target_ranges.end());
+    write(buffer, target_ranges);
+    for (const auto& rom_array : builder.rom_arrays) {
+        write(buffer, static_cast<uint64_t>(rom_array.state.size()));
+        write(buffer, static_cast<uint64_t>(rom_array.records.size()));
+    }
+    for (const auto& ram_array : builder.ram_arrays) {
+        write(buffer, static_cast<uint64_t>(ram_array.state.size()));
+        write(buffer, static_cast<uint64_t>(ram_array.records.size()));
+    }
+    return sha256::sha256(buffer);
+}
+} // namespace
+
 AcirComposer::AcirComposer(size_t size_hint, bool verbose)
     : size_hint_(size_hint)
     , verbose_(verbose)
@@ -35,18 +112,41 @@ std::shared_ptr<proof_system::plonk::proving_key> AcirComposer::init_proving_key
     acir_format::acir_format& constraint_system)
 {
     create_circuit(constraint_system);
+    // Computing the key finalizes the circuit, so the circuit is hashed first, for keys written to be loaded for it
+    get_circuit_hash();
     acir_format::Composer composer;
     vinfo("computing proving key...");
     proving_key_ = composer.compute_proving_key(builder_);
     return proving_key_;
 }
 
+/**
+ * @brief Hash of the circuit's structure, which identifies the circuit a proving key was computed for
+ */
+sha256::hash AcirComposer::get_circuit_hash()
+{
+    if (!circuit_hash_) {
+        if (builder_.circuit_finalized) {
+            throw_or_abort("Cannot hash a circuit that has been finalized.");
+        }
+        circuit_hash_ = compute_circuit_hash(builder_);
+    }
+    return *circuit_hash_;
+}
+
 std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constraint_system,
                                                 acir_format::WitnessVector& witness,
                                                 bool is_recursive)
 {
     vinfo("building circuit with witness...");
+    // The lookup tables only depend on the program, so they are carried over from the previous circuit, and the
+    // selectors, sigma/id and table polynomials come from the cached proving key. The gates themselves are replayed for
+    // every witness: the gadgets compute witness dependent variables (lookup accumulators, range decompositions,
+    // memory records) while adding their constraints, so there is no witness-free circuit whose wires could be
+    // filled in instead.
+    auto lookup_tables = std::move(builder_.lookup_tables);
     builder_ = acir_format::Builder(size_hint_);
+    builder_.reuse_lookup_tables(std::move(lookup_tables));
     create_circuit_with_witness(builder_, constraint_system, witness);
     vinfo("gates: ", builder_.get_total_circuit_size());
 
@@ -87,6 +187,38 @@ std::shared_ptr<proof_system::plonk::verification_key> AcirComposer::init_verifi
     return verification_key_;
 }
 
+/**
+ * @brief Uses a proving key that was computed for this circuit, e.g. one read from a file, rather than computing it.
+ * The key's circuit type, size, number of public inputs and circuit hash must match those of the circuit built by
+ * create_circuit.
+ */
+void AcirComposer::load_proving_key(proof_system::plonk::proving_key_data&& data, sha256::hash const& circuit_hash)
+{
+    if (data.circuit_type != static_cast<uint32_t>(acir_format::Composer::type)) {
+        throw_or_abort("Proving key has the wrong circuit type.");
+    }
+    if (data.circuit_size != circuit_subgroup_size_) {
+        throw_or_abort(format("Proving key is for a circuit of size ",
+                              data.circuit_size,
+                              ", but the circuit has size ",
+                              circuit_subgroup_size_,
+                              "."));
+    }
+    if (data.num_public_inputs != builder_.public_inputs.size()) {
+        throw_or_abort(format("Proving key is for a circuit with ",
+                              data.num_public_inputs,
+                              " public inputs, but the circuit has ",
+                              builder_.public_inputs.size(),
+                              "."));
+    }
+    if (circuit_hash != get_circuit_hash()) {
+        throw_or_abort("Proving key was computed for a different circuit.");
+    }
+    const size_t circuit_size = data.circuit_size;
+    proving_key_ = std::make_shared<proof_system::plonk::proving_key>(
+        std::move(data), srs::get_crs_factory()->get_prover_crs(circuit_size + 1));
+}
+
 void AcirComposer::load_verification_key(proof_system::plonk::verification_key_data&& data)
 {
     verification_key_ = std::make_shared<proof_system::plonk::verification_key>(
@@ -1,10 +1,12 @@
 #pragma once
+#include <barretenberg/crypto/sha256/sha256.hpp>
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
 #include <barretenberg/plonk/proof_system/proving_key/proving_key.hpp>
 #include <barretenberg/plonk/proof_system/verification_key/verification_key.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 namespace acir_proofs {
 
@@ -20,6 +22,8 @@ class AcirComposer {
                                       acir_format::WitnessVector& witness,
                                       bool is_recursive);
 
+    void load_proving_key(proof_system::plonk::proving_key_data&& data, sha256::hash const& circuit_hash);
+
     void load_verification_key(proof_system::plonk::verification_key_data&& data);
 
     std::shared_ptr<proof_system::plonk::verification_key> init_verification_key();
@@ -30,6 +34,7 @@ class AcirComposer {
     size_t get_exact_circuit_size() { return exact_circuit_size_; };
     size_t get_total_circuit_size() { return total_circuit_size_; };
     size_t get_circuit_subgroup_size() { return circuit_subgroup_size_; };
+    sha256::hash get_circuit_hash();
 
     std::vector<barretenberg::fr> serialize_proof_into_fields(std::vector<uint8_t> const& proof,
                                                               size_t num_inner_public_inputs);
@@ -42,6 +47,7 @@ class AcirComposer {
     size_t exact_circuit_size_;
     size_t total_circuit_size_;
     size_t circuit_subgroup_size_;
+    std::optional<sha256::hash> circuit_hash_;
     std::shared_ptr<proof_system::plonk::proving_key> proving_key_;
     std::shared_ptr<proof_system::plonk::verification_key> verification_key_;
     bool verbose_ = true;
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "acir_composer.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+#include "xor_program.hpp"
+
+#ifndef __wasm__
+#include <filesystem>
+#include <fstream>
+#endif
+
+namespace acir_proofs::tests {
+
+class AcirComposerTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+};
+
+/**
+ * @brief Proofs for several witnesses of the same program reuse the proving key and lookup tables of the first
+ */
+TEST_F(AcirComposerTests, RepeatedProofsOfFixedCircuit)
+{
+    const uint32_t num_xors = 4;
+    auto constraint_system = create_xor_program(num_xors);
+
+    AcirComposer composer(0, false);
+    composer.init_proving_key(constraint_system);
+    for (size_t i = 0; i < 3; ++i) {
+        auto witness = create_xor_witness(num_xors);
+        auto proof = composer.create_proof(constraint_system, witness, false);
+        EXPECT_TRUE(composer.verify_proof(proof, false));
+    }
+
+    // Nothing carried over from the previous proofs can make up for an invalid witness: an input that exceeds its
+    // range
+    auto witness = create_xor_witness(num_xors);
+    witness[0] += barretenberg::fr(uint256_t(1) << 32);
+    auto proof = composer.create_proof(constraint_system, witness, false);
+    EXPECT_FALSE(composer.verify_proof(proof, false));
+}
+
+#ifndef __wasm__
+/**
+ * @brief A proving key written in the memory-mapped format proves the circuit it was computed for, and is rejected for
+ * a circuit of the same size and number of public inputs that computes something else
+ */
+TEST_F(AcirComposerTests, MappedProvingKeyIsCheckedAgainstCircuit)
+{
+    const uint32_t num_xors = 4;
+    auto constraint_system = create_xor_program(num_xors);
+    const std::string pk_path = std::filesystem::temp_directory_path() / "acir_composer_mapped_proving_key";
+    {
+        AcirComposer composer(0, false);
+        auto proving_key = composer.init_proving_key(constraint_system);
+        std::ofstream os(pk_path, std::ios::binary);
+        proof_system::plonk::write_mmap(os, *proving_key, composer.get_circuit_hash());
+    }
+    const auto load_proving_key = [&](AcirComposer& composer) {
+        proof_system::plonk::proving_key_data pk_data;
+        sha256::hash circuit_hash;
+        proof_system::plonk::read_mmap(pk_path, pk_data, circuit_hash);
+        composer.load_proving_key(std::move(pk_data), circuit_hash);
+    };
+
+    AcirComposer composer(0, false);
+    composer.create_circuit(constraint_system);
+    load_proving_key(composer);
+    auto witness = create_xor_witness(num_xors);
+    auto proof = composer.create_proof(constraint_system, witness, false);
+    EXPECT_TRUE(composer.verify_proof(proof, false));
+
+    // The same gates, but ands rather than xors
+    auto and_constraint_system = create_xor_program(num_xors);
+    for (auto& constraint : and_constraint_system.logic_constraints) {
+        constraint.is_xor_gate = 0;
+    }
+    AcirComposer and_composer(0, false);
+    and_composer.create_circuit(and_constraint_system);
+    EXPECT_EQ(and_composer.get_circuit_subgroup_size(), composer.get_circuit_subgroup_size());
+    EXPECT_ANY_THROW(load_proving_key(and_composer));
+
+    // More public inputs
+    auto public_constraint_system = create_xor_program(num_xors);
+    public_constraint_system.public_inputs.push_back(1);
+    AcirComposer public_composer(0, false);
+    public_composer.create_circuit(public_constraint_system);
+    EXPECT_ANY_THROW(load_proving_key(public_composer));
+
+    std::filesystem::remove(pk_path);
+}
+#endif
+
+} // namespace acir_proofs::tests
@@ -0,0 +1,42 @@
+#pragma once
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+namespace acir_proofs {
+
+/**
+ * @brief A program computing `num_xors` 32-bit xors, so that the circuit makes use of lookup tables. Shared by the
+ * tests and benchmarks of repeated proofs.
+ */
+inline acir_format::acir_format create_xor_program(const uint32_t num_xors)
+{
+    acir_format::acir_format constraint_system{};
+    constraint_system.varnum = 3 * num_xors + 1;
+    for (uint32_t i = 0; i < num_xors; ++i) {
+        const uint32_t a = 3 * i + 1;
+        constraint_system.logic_constraints.push_back(
+            { .a = a, .b = a + 1, .result = a + 2, .num_bits = 32, .is_xor_gate = 1 });
+        constraint_system.range_constraints.push_back({ .witness = a, .num_bits = 32 });
+        constraint_system.range_constraints.push_back({ .witness = a + 1, .num_bits = 32 });
+    }
+    return constraint_system;
+}
+
+/**
+ * @brief A random witness for the program of create_xor_program
+ */
+inline acir_format::WitnessVector create_xor_witness(const uint32_t num_xors)
+{
+    auto& engine = numeric::random::get_debug_engine();
+    acir_format::WitnessVector witness;
+    for (uint32_t i = 0; i < num_xors; ++i) {
+        const uint32_t a = engine.get_random_uint32();
+        const uint32_t b = engine.get_random_uint32();
+        witness.emplace_back(a);
+        witness.emplace_back(b);
+        witness.emplace_back(a ^ b);
+    }
+    return witness;
+}
+
+} // namespace acir_proofs
@@ -0,0 +1,95 @@
+#include "./scalar_multiplication.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+using Curve = curve::BN254;
+using Element = Curve::Element;
+using AffineElement = Curve::AffineElement;
+using Fr = Curve::ScalarField;
+
+constexpr size_t MAX_POINTS = 1024;
+
+struct MsmInputs {
+    std::vector<Fr> scalars;
+    std::vector<AffineElement> points;
+    // points followed by their endomorphism images, as pippenger expects
+    std::vector<AffineElement> pippenger_points;
+
+    explicit MsmInputs(const size_t num_points)
+        : scalars(num_points)
+        , points(num_points)
+        , pippenger_points(num_points * 2)
+    {
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[i] = Fr::random_element();
+            points[i] = AffineElement(Element::random_element());
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            points.data(), pippenger_points.data(), num_points);
+    }
+};
+} // namespace
+
+/**
+ * @brief Baseline: one scalar multiplication per point
+ */
+void naive_msm_bench(State& state) noexcept
+{
+    MsmInputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Element result = Curve::Group::point_at_infinity;
+        for (size_t i = 0; i < inputs.points.size(); ++i) {
+            result += Element(inputs.points[i]) * inputs.scalars[i];
+        }
+        DoNotOptimize(result);
+    }
+}
+BENCHMARK(naive_msm_bench)->RangeMultiplier(2)->Range(1, MAX_POINTS)->Unit(kMicrosecond);
+
+void straus_bench(State& state) noexcept
+{
+    MsmInputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::straus<Curve>(
+            inputs.scalars.data(), inputs.points.data(), inputs.points.size()));
+    }
+}
+BENCHMARK(straus_bench)->RangeMultiplier(2)->Range(1, MAX_POINTS)->Unit(kMicrosecond);
+
+/**
+ * @brief Pippenger proper, without the hand-off to Straus for small inputs. It needs at least 8 points per thread
+ */
+void pippenger_internal_bench(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    if (num_points < get_num_cpus_pow2() * 8) {
+        state.SkipWithError("too few points for the number of threads");
+        return;
+    }
+    MsmInputs inputs(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> runtime_state(num_points);
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_internal<Curve>(
+            inputs.pippenger_points.data(), inputs.scalars.data(), num_points, runtime_state, true));
+    }
+}
+BENCHMARK(pippenger_internal_bench)->RangeMultiplier(2)->Range(1, MAX_POINTS)->Unit(kMicrosecond);
+
+/**
+ * @brief pippenger, which picks Straus or Pippenger by size
+ */
+void pippenger_bench(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    MsmInputs inputs(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> runtime_state(num_points);
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger<Curve>(
+            inputs.scalars.data(), inputs.pippenger_points.data(), num_points, runtime_state));
+    }
+}
+BENCHMARK(pippenger_bench)->RangeMultiplier(2)->Range(1, MAX_POINTS)->Unit(kMicrosecond);
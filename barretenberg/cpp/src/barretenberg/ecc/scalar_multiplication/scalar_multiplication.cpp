@@ -854,6 +854,134 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
     return result;
 }
 
+namespace {
+template <typename Curve>
+typename Curve::Element straus_internal(const typename Curve::ScalarField* scalars,
+                                        const typename Curve::AffineElement* points,
+                                        const size_t num_initial_points)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t lookup_size = 8;
+    constexpr size_t num_rounds = 32;
+    constexpr size_t num_wnaf_bits = 4;
+    constexpr size_t wnaf_size = num_rounds * 2;
+
+    Element result = Curve::Group::point_at_infinity;
+    std::vector<size_t> active;
+    active.reserve(num_initial_points);
+    for (size_t i = 0; i < num_initial_points; ++i) {
+        if (!scalars[i].is_zero() && !points[i].is_point_at_infinity()) {
+            active.push_back(i);
+        }
+    }
+    const size_t num_points = active.size();
+    if (num_points == 0) {
+        return result;
+    }
+    // a single point does not amortise the batched inversion of the table
+    if (num_points == 1) {
+        return Element(points[active[0]]) * scalars[active[0]];
+    }
+
+    // odd multiples P, 3P, ..., 15P of every point. The subgroup has prime order, so none of them is the point at
+    // infinity
+    std::vector<Element> multiples(num_points * lookup_size);
+    for (size_t j = 0; j < num_points; ++j) {
+        Element* table = &multiples[j * lookup_size];
+        table[0] = Element(points[active[j]]);
+        const Element d2 = table[0].dbl();
+        for (size_t k = 1; k < lookup_size; ++k) {
+            table[k] = table[k - 1] + d2;
+        }
+    }
+    Element::batch_normalize(multiples.data(), multiples.size());
+    const Fq beta = Fq::cube_root_of_unity();
+    std::vector<AffineElement> lookup_table(multiples.size());
+    std::vector<AffineElement> endo_lookup_table(multiples.size());
+    for (size_t i = 0; i < multiples.size(); ++i) {
+        lookup_table[i] = AffineElement(multiples[i].x, multiples[i].y);
+        endo_lookup_table[i] = AffineElement(multiples[i].x * beta, -multiples[i].y);
+    }
+
+    // the wnaf digits of the two endomorphism halves of each scalar are interleaved, as in mul_with_endomorphism
+    std::vector<uint64_t> wnaf_table(num_points * wnaf_size);
+    std::vector<uint8_t> skew_table(num_points * 2);
+    for (size_t j = 0; j < num_points; ++j) {
+        const Fr converted_scalar = scalars[active[j]].from_montgomery_form();
+        Fr endo_scalar;
+        Fr::split_into_endomorphism_scalars(converted_scalar, endo_scalar, *(Fr*)&endo_scalar.data[2]); // NOLINT
+        bool skew = false;
+        bool endo_skew = false;
+        wnaf::fixed_wnaf(&endo_scalar.data[0], &wnaf_table[j * wnaf_size], skew, 0, 2, num_wnaf_bits);
+        wnaf::fixed_wnaf(&endo_scalar.data[2], &wnaf_table[j * wnaf_size + 1], endo_skew, 0, 2, num_wnaf_bits);
+        skew_table[j * 2] = static_cast<uint8_t>(skew);
+        skew_table[j * 2 + 1] = static_cast<uint8_t>(endo_skew);
+    }
+
+    for (size_t round = 0; round < num_rounds; ++round) {
+        if (round != 0) {
+            for (size_t k = 0; k < num_wnaf_bits; ++k) {
+                result.self_dbl();
+            }
+        }
+        for (size_t j = 0; j < num_points; ++j) {
+            const uint64_t wnaf_entry = wnaf_table[j * wnaf_size + round * 2];
+            const uint64_t endo_wnaf_entry = wnaf_table[j * wnaf_size + round * 2 + 1];
+
+            AffineElement to_add = lookup_table[j * lookup_size + (wnaf_entry & 0x0fffffffU)];
+            to_add.y.self_conditional_negate(static_cast<bool>((wnaf_entry >> 31) & 1));
+            result += to_add;
+
+            to_add = endo_lookup_table[j * lookup_size + (endo_wnaf_entry & 0x0fffffffU)];
+            to_add.y.self_conditional_negate(static_cast<bool>((endo_wnaf_entry >> 31) & 1));
+            result += to_add;
+        }
+    }
+
+    for (size_t j = 0; j < num_points; ++j) {
+        if (skew_table[j * 2] != 0) {
+            result += -lookup_table[j * lookup_size];
+        }
+        if (skew_table[j * 2 + 1] != 0) {
+            result += -endo_lookup_table[j * lookup_size];
+        }
+    }
+    return result;
+}
+} // namespace
+
+template <typename Curve>
+typename Curve::Element straus(const typename Curve::ScalarField* scalars,
+                               const typename Curve::AffineElement* points,
+                               const size_t num_points)
+{
+    using Element = typename Curve::Element;
+
+    // below this many points per thread, the shared doublings dominate and splitting the input does not pay off
+    constexpr size_t min_points_per_thread = 16;
+    const size_t num_threads = std::max(std::min(get_num_cpus(), num_points / min_points_per_thread), size_t(1));
+    if (num_threads == 1) {
+        return straus_internal<Curve>(scalars, points, num_points);
+    }
+
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * points_per_thread, num_points);
+        const size_t end = std::min(start + points_per_thread, num_points);
+        thread_results[thread_idx] = straus_internal<Curve>(scalars + start, points + start, end - start);
+    });
+    Element result = thread_results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result += thread_results[i];
+    }
+    return result;
+}
+
 template <typename Curve>
 typename Curve::Element pippenger_internal(typename Curve::AffineElement* points,
                                            typename Curve::ScalarField* scalars,
@@ -878,12 +1006,11 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
 {
     using Group = typename Curve::Group;
     using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
 
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
-    // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
-    // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms
-    // Pippenger
-    const size_t threshold = get_num_cpus_pow2() * 8;
+    // If we fall below this theshold, or below the size where Straus outperforms Pippenger, use Straus instead
+    const size_t threshold = std::max(get_num_cpus_pow2() * 8, STRAUS_MAX_POINTS);
 
     if (num_initial_points == 0) {
         Element out = Group::one;
@@ -892,16 +1019,12 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     }
 
     if (num_initial_points <= threshold) {
-        std::vector<Element> exponentiation_results(num_initial_points);
-        // might as well multithread this...
-        // Possible optimization: use group::batch_mul_with_endomorphism here.
-        parallel_for(num_initial_points,
-                     [&](size_t i) { exponentiation_results[i] = Element(points[i * 2]) * scalars[i]; });
-
-        for (size_t i = num_initial_points - 1; i > 0; --i) {
-            exponentiation_results[i - 1] += exponentiation_results[i];
+        // `points` holds each point followed by its endomorphism image
+        std::vector<AffineElement> base_points(num_initial_points);
+        for (size_t i = 0; i < num_initial_points; ++i) {
+            base_points[i] = points[i * 2];
         }
-        return exponentiation_results[0];
+        return straus<Curve>(scalars, base_points.data(), num_initial_points);
     }
 
     const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
@@ -1007,6 +1130,10 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element straus<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                    const curve::BN254::AffineElement* points,
+                                                    const size_t num_points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1058,6 +1185,10 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element straus<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                          const curve::Grumpkin::AffineElement* points,
+                                                          const size_t num_points);
+
 } // namespace barretenberg::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
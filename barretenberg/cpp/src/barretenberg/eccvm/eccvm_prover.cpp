@@ -224,18 +224,23 @@ template <ECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_univariatizatio
     std::vector<FF> rhos = pcs::gemini::powers_of_rho(rho, NUM_POLYNOMIALS);
 
     // Batch the unshifted polynomials and the to-be-shifted polynomials using ρ
-    Polynomial batched_poly_unshifted(key->circuit_size); // batched unshifted polynomials
-    size_t poly_idx = 0; // TODO(https://github.com/AztecProtocol/barretenberg/issues/391) zip
+    std::vector<std::span<const FF>> unshifted_polynomials;
     for (auto& unshifted_poly : prover_polynomials.get_unshifted()) {
-        batched_poly_unshifted.add_scaled(unshifted_poly, rhos[poly_idx]);
-        ++poly_idx;
+        unshifted_polynomials.emplace_back(unshifted_poly);
     }
-
-    Polynomial batched_poly_to_be_shifted(key->circuit_size); // batched to-be-shifted polynomials
+    std::vector<std::span<const FF>> to_be_shifted_polynomials;
     for (auto& to_be_shifted_poly : prover_polynomials.get_to_be_shifted()) {
-        batched_poly_to_be_shifted.add_scaled(to_be_shifted_poly, rhos[poly_idx]);
-        ++poly_idx;
+        to_be_shifted_polynomials.emplace_back(to_be_shifted_poly);
     };
+    const std::span<const FF> rhos_span(rhos);
+    // batched unshifted polynomials
+    auto batched_poly_unshifted = Polynomial::linear_combination(
+        unshifted_polynomials, rhos_span.subspan(0, unshifted_polynomials.size()), key->circuit_size);
+    // batched to-be-shifted polynomials
+    auto batched_poly_to_be_shifted = Polynomial::linear_combination(
+        to_be_shifted_polynomials,
+        rhos_span.subspan(unshifted_polynomials.size(), to_be_shifted_polynomials.size()),
+        key->circuit_size);
 
     // Compute d-1 polynomials Fold^(i), i = 1, ..., d-1.
     gemini_polynomials = Gemini::compute_gemini_polynomials(
@@ -347,14 +352,17 @@ template <ECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_transcript_cons
     std::array<FF, NUM_UNIVARIATES> univariate_evaluations;
 
     // Constuct the batched polynomial and batched evaluation
-    Polynomial batched_univariate{ key->circuit_size };
+    std::vector<std::span<const FF>> batched_polynomials;
+    std::vector<FF> batching_scalars;
     FF batched_evaluation{ 0 };
     auto batching_scalar = FF(1);
     for (auto [eval, polynomial] : zip_view(univariate_evaluations, univariate_polynomials)) {
-        batched_univariate.add_scaled(*polynomial, batching_scalar);
+        batched_polynomials.emplace_back(*polynomial);
+        batching_scalars.emplace_back(batching_scalar);
         batched_evaluation += eval * batching_scalar;
         batching_scalar *= batching_challenge;
     }
+    auto batched_univariate = Polynomial::linear_combination(batched_polynomials, batching_scalars, key->circuit_size);
 
     // Compute a proof for the batched univariate opening
     PCS::compute_opening_proof(
@@ -77,47 +77,13 @@ void UltraComposer::compute_witness(CircuitBuilder& circuit_constructor)
 
     for (auto& table : circuit_constructor.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
-        for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
-            } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
-            }
-        }
-
-#ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
-#else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
-#endif
-
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+        plookup::for_each_sorted_list_entry(table, [&](const std::array<fr, 3>& components) {
             s_1[count] = components[0];
             s_2[count] = components[1];
             s_3[count] = components[2];
             s_4[count] = table_index;
             ++count;
-        }
+        });
     }
 
     // Initialize the `s_randomness` positions in the s polynomials with 0.
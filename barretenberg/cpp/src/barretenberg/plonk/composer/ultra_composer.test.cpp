@@ -824,4 +824,114 @@ TEST(ultra_plonk_composer, range_constraint_small_variable)
     EXPECT_EQ(result, true);
 }
 
+// The fused quotient pass over all transition widgets must give the same quotient as running the widgets one by one
+TYPED_TEST(ultra_plonk_composer, fused_quotient_contribution)
+{
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+
+    size_t rom_id = builder.create_ROM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+    }
+    uint32_t a_idx = builder.read_ROM_array(rom_id, builder.add_variable(2));
+    uint32_t b_idx = builder.add_variable(fr(engine.get_random_uint16()));
+    builder.create_range_constraint(b_idx, 16, "range");
+    uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) * builder.get_variable(b_idx));
+    builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+
+    auto prover = composer.create_prover(builder);
+    prover.execute_preamble_round();
+    prover.queue.process_queue();
+    prover.execute_first_round();
+    prover.queue.process_queue();
+    prover.execute_second_round();
+    prover.queue.process_queue();
+    prover.execute_third_round();
+    prover.queue.process_queue();
+    prover.queue.flush_queue();
+
+    // Apply the random widgets as the fourth round does, which initialises the quotient parts
+    prover.transcript.apply_fiat_shamir("alpha");
+    fr alpha_base = fr::serialize_from_buffer(prover.transcript.get_challenge("alpha").begin());
+    prover.compute_lagrange_1_fft();
+    for (auto& widget : prover.random_widgets) {
+        alpha_base = widget->compute_quotient_contribution(alpha_base, prover.transcript);
+    }
+    auto& parts = prover.key->quotient_polynomial_parts;
+    const std::vector<polynomial> initial_parts(std::begin(parts), std::end(parts));
+
+    fr expected_alpha = alpha_base;
+    for (auto& widget : prover.transition_widgets) {
+        expected_alpha = widget->compute_quotient_contribution(expected_alpha, prover.transcript);
+    }
+    const std::vector<polynomial> expected_parts(std::begin(parts), std::end(parts));
+
+    for (size_t i = 0; i < NUM_QUOTIENT_PARTS; ++i) {
+        parts[i] = initial_parts[i];
+    }
+    const fr fused_alpha =
+        widget::compute_fused_quotient_contribution(prover.transition_widgets, alpha_base, prover.transcript);
+
+    EXPECT_EQ(fused_alpha, expected_alpha);
+    for (size_t i = 0; i < NUM_QUOTIENT_PARTS; ++i) {
+        EXPECT_EQ(parts[i], expected_parts[i]);
+    }
+}
+
+// Proving must not depend on which polynomials the proving key holds in memory and which it swaps out to a file
+TYPED_TEST(ultra_plonk_composer, bounded_polynomial_cache)
+{
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+
+    size_t rom_id = builder.create_ROM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+    }
+    uint32_t a_idx = builder.read_ROM_array(rom_id, builder.add_variable(3));
+    uint32_t b_idx = builder.add_variable(fr(engine.get_random_uint16()));
+    builder.create_range_constraint(b_idx, 16, "range");
+    uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) * builder.get_variable(b_idx));
+    builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+
+    composer.compute_proving_key(builder)->polynomial_store.set_max_cache_size(8);
+
+    TestFixture::prove_and_verify(builder, composer, /*expected_result=*/true);
+}
+
+TYPED_TEST(ultra_plonk_composer, memory_budget)
+{
+    // Proves the same circuit with a fresh key under the given budget, returning the bytes left in the key's store
+    const auto prove_with_budget = [](const size_t memory_budget) {
+        auto builder = UltraCircuitBuilder();
+        auto composer = UltraComposer();
+        uint32_t a_idx = builder.add_variable(fr(1234));
+        builder.create_range_constraint(a_idx, 16, "range");
+        uint32_t b_idx = builder.add_variable(builder.get_variable(a_idx).sqr());
+        builder.create_mul_gate({ a_idx, a_idx, b_idx, 1, -1, 0 });
+
+        auto prover = composer.create_prover(builder);
+        auto verifier = composer.create_verifier(builder);
+        prover.memory_budget = memory_budget;
+        auto proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+
+        EXPECT_EQ(prover.memory_report.phases.size(), 7UL);
+        return prover.key->polynomial_store.get_size_in_bytes();
+    };
+
+    const size_t unbudgeted_bytes = prove_with_budget(0);
+    ASSERT_GT(unbudgeted_bytes, 0UL);
+
+    // A budget below the store's size swaps polynomials out until the store fits, but no more than that
+    const size_t memory_budget = unbudgeted_bytes / 2;
+    const size_t budgeted_bytes = prove_with_budget(memory_budget);
+    EXPECT_LE(budgeted_bytes, memory_budget);
+    EXPECT_GT(budgeted_bytes, 0UL);
+
+    // A budget that can't be met swaps every polynomial out of memory
+    EXPECT_EQ(prove_with_budget(1), 0UL);
+}
+
 } // namespace proof_system::plonk::test_ultra_plonk_composer
@@ -35,6 +35,8 @@ ProverBase<settings>::ProverBase(ProverBase<settings>&& other)
     , key(std::move(other.key))
     , commitment_scheme(std::move(other.commitment_scheme))
     , queue(key.get(), &transcript)
+    , memory_report(std::move(other.memory_report))
+    , memory_budget(other.memory_budget)
 {
     for (size_t i = 0; i < other.random_widgets.size(); ++i) {
         random_widgets.emplace_back(std::move(other.random_widgets[i]));
@@ -61,6 +63,8 @@ template <typename settings> ProverBase<settings>& ProverBase<settings>::operato
     commitment_scheme = std::move(other.commitment_scheme);
 
     queue = work_queue(key.get(), &transcript);
+    memory_report = std::move(other.memory_report);
+    memory_budget = other.memory_budget;
     return *this;
 }
 
@@ -361,6 +365,9 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     transcript.apply_fiat_shamir("alpha");
     fr alpha_base = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
 
+    // The widgets read the coset FFTs of the polynomials
+    prefetch_polynomials("_fft");
+
     // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
     compute_lagrange_1_fft();
 
@@ -368,9 +375,9 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
         alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
     }
 
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
+    // The transition widgets are evaluated together, one block of coset rows at a time, so that the wire FFTs they
+    // share are read from memory once
+    alpha_base = widget::compute_fused_quotient_contribution(transition_widgets, alpha_base, transcript);
 
     // The parts of the quotient polynomial t(X) are stored as 4 separate polynomials in
     // the code. However, operations such as dividing by the pseudo vanishing polynomial
@@ -397,12 +404,18 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     add_blinding_to_quotient_polynomial_parts();
 
     compute_quotient_commitments();
+
+    if (memory_budget > 0) {
+        release_quotient_fft_polynomials();
+    }
 } // namespace proof_system::plonk
 
 template <typename settings> void ProverBase<settings>::execute_fifth_round()
 {
     queue.flush_queue();
     transcript.apply_fiat_shamir("z"); // end of 4th round
+    // The polynomials are evaluated at z in monomial form
+    prefetch_polynomials("");
 #ifdef DEBUG_TIMING
     std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 #endif
@@ -418,9 +431,61 @@ template <typename settings> void ProverBase<settings>::execute_sixth_round()
 {
     queue.flush_queue();
     transcript.apply_fiat_shamir("nu");
+    prefetch_polynomials("");
     commitment_scheme->batch_open(transcript, queue, key);
 }
 
+/**
+ * @brief Tells the polynomial store that the polynomials in the manifest, in the form given by the label suffix, are
+ * read next, so that any that were swapped out of memory are read back while the prover works.
+ */
+template <typename settings> void ProverBase<settings>::prefetch_polynomials(std::string const& label_suffix)
+{
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
+        labels.emplace_back(std::string(key->polynomial_manifest[i].polynomial_label) + label_suffix);
+    }
+    key->polynomial_store.prefetch(labels);
+}
+
+/**
+ * @brief Frees the coset FFTs of the witness polynomials and of L_1, which are only read while computing the quotient
+ * and are recomputed by the next proof.
+ */
+template <typename settings> void ProverBase<settings>::release_quotient_fft_polynomials()
+{
+    for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
+        if (key->polynomial_manifest[i].source == PolynomialSource::WITNESS) {
+            key->polynomial_store.remove(std::string(key->polynomial_manifest[i].polynomial_label) + "_fft");
+        }
+    }
+    key->polynomial_store.remove("lagrange_1_fft");
+}
+
+/**
+ * @brief If the proving key's store holds more polynomials in memory than the budget, swaps the smallest ones out
+ * until the excess is covered.
+ *
+ * @details The budget is compared against the store alone: the SRS tables and Pippenger state that are also allocated
+ * can't be spilled, so counting them would spill every polynomial once the budget is below their size.
+ */
+template <typename settings> void ProverBase<settings>::enforce_memory_budget()
+{
+    if (memory_budget == 0) {
+        return;
+    }
+    const size_t store_bytes = key->polynomial_store.get_size_in_bytes();
+    if (store_bytes > memory_budget) {
+        key->polynomial_store.swap_out_bytes(store_bytes - memory_budget);
+    }
+}
+
+template <typename settings> void ProverBase<settings>::finish_round(std::string const& name)
+{
+    enforce_memory_budget();
+    memory_report.end_phase(name);
+}
+
 template <typename settings> void ProverBase<settings>::compute_quotient_evaluation()
 {
 
@@ -494,40 +559,56 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
 {
+    memory_report.clear();
+
     // Execute init round. Randomize witness polynomials.
     // info("preamble");
+    memory_report.start_phase();
     execute_preamble_round();
     queue.process_queue();
+    finish_round("preamble");
 
     // Compute wire precommitments and sometimes random widget round commitments
     // info("first");
+    memory_report.start_phase();
     execute_first_round();
     queue.process_queue();
+    finish_round("first");
 
     // Fiat-Shamir eta + execute random widgets.
     // info("second");
+    memory_report.start_phase();
     execute_second_round();
     queue.process_queue();
+    finish_round("second");
 
     // Fiat-Shamir beta & gamma, execute random widgets (Permutation widget is executed here)
     // and fft the witnesses
     // info("third");
+    memory_report.start_phase();
     execute_third_round();
     queue.process_queue();
+    finish_round("third");
 
     // Fiat-Shamir alpha, compute & commit to quotient polynomial.
     // info("fourth");
+    memory_report.start_phase();
     execute_fourth_round();
     queue.process_queue();
+    finish_round("fourth");
 
     // info("fifth");
+    memory_report.start_phase();
     execute_fifth_round();
+    finish_round("fifth");
 
     // info("sixth");
+    memory_report.start_phase();
     execute_sixth_round();
     queue.process_queue();
 
     queue.flush_queue();
+    finish_round("sixth");
 
     return export_proof();
 }
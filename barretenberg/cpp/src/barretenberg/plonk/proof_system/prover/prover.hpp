@@ -4,6 +4,7 @@
 #include "../types/proof.hpp"
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "../widgets/transition_widgets/transition_widget.hpp"
+#include "barretenberg/common/memory_report.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/work_queue/work_queue.hpp"
 
@@ -38,6 +39,9 @@ template <typename settings> class ProverBase {
     void compute_quotient_evaluation();
     void add_blinding_to_quotient_polynomial_parts();
     void compute_lagrange_1_fft();
+    void prefetch_polynomials(std::string const& label_suffix);
+    void release_quotient_fft_polynomials();
+    void enforce_memory_budget();
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
 
@@ -95,7 +99,17 @@ template <typename settings> class ProverBase {
 
     work_queue queue;
 
+    // The peak and live memory of each round of the last call to construct_proof
+    barretenberg::MemoryReport memory_report;
+
+    // If non-zero, the number of bytes of polynomials the proving key's polynomial store may keep in memory. After each
+    // round, polynomials are swapped out of the store until it is met, and the coset FFTs of the witnesses are freed
+    // once the quotient is computed. Peaks within a round, and memory outside the store, are not bounded.
+    size_t memory_budget = 0;
+
   private:
+    void finish_round(std::string const& name);
+
     plonk::proof proof;
 };
 extern template class ProverBase<standard_settings>;
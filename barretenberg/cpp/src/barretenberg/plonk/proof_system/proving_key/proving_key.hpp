@@ -10,15 +10,18 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 
-#ifdef __wasm__
 #include "barretenberg/proof_system/polynomial_store/polynomial_store_cache.hpp"
-// #include "barretenberg/proof_system/polynomial_store/polynomial_store_wasm.hpp"
-#else
-#include "barretenberg/proof_system/polynomial_store/polynomial_store.hpp"
-#endif
 
 namespace proof_system::plonk {
 
+#ifdef __wasm__
+static constexpr size_t PROVING_KEY_POLYNOMIAL_CACHE_SIZE = 40;
+#else
+// Native builds hold every polynomial in memory, as they did before the store could spill to a file. A cap can be set
+// with PolynomialStoreCache::set_max_cache_size, e.g. for proving in a memory-capped container.
+static constexpr size_t PROVING_KEY_POLYNOMIAL_CACHE_SIZE = PolynomialStoreCache::UNBOUNDED;
+#endif
+
 struct proving_key_data {
     uint32_t circuit_type;
     uint32_t circuit_size;
@@ -27,12 +30,7 @@ struct proving_key_data {
     std::vector<uint32_t> recursive_proof_public_input_indices;
     std::vector<uint32_t> memory_read_records;
     std::vector<uint32_t> memory_write_records;
-#ifdef __wasm__
-    PolynomialStoreCache polynomial_store;
-    // PolynomialStoreWasm<barretenberg::fr> polynomial_store;
-#else
-    PolynomialStore<barretenberg::fr> polynomial_store;
-#endif
+    PolynomialStoreCache polynomial_store{ PROVING_KEY_POLYNOMIAL_CACHE_SIZE };
 };
 
 struct proving_key {
@@ -64,12 +62,8 @@ struct proving_key {
     std::vector<uint32_t> memory_read_records;  // Used by UltraPlonkComposer only; for ROM, RAM reads.
     std::vector<uint32_t> memory_write_records; // Used by UltraPlonkComposer only, for RAM writes.
 
-#ifdef __wasm__
-    PolynomialStoreCache polynomial_store;
-    // PolynomialStoreWasm<barretenberg::fr> polynomial_store;
-#else
-    PolynomialStore<barretenberg::fr> polynomial_store;
-#endif
+    // Polynomials that don't fit in the cache are swapped out to the external store (see PolynomialStoreCache)
+    PolynomialStoreCache polynomial_store{ PROVING_KEY_POLYNOMIAL_CACHE_SIZE };
 
     barretenberg::evaluation_domain small_domain;
     barretenberg::evaluation_domain large_domain;
@@ -89,50 +89,31 @@ TEST(proving_key, proving_key_from_serialized_key_ultra)
     EXPECT_EQ(p_key.contains_recursive_proof, proving_key->contains_recursive_proof);
 }
 
-/**
-// Test that a proving key can be serialized/deserialized using mmap
+// Test that a proving key can be written in the memory-mapped format, mapped, and used to construct a proof
 #ifndef __wasm__
 TEST(proving_key, proving_key_from_mmaped_key)
 {
-        builder coStandardCircuitBuilder = StandardComposer();auto composer =
-StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
-
-    // Write each precomputed polynomial in the proving key to
-    // its own file using write_mmap
-    std::string pk_dir = "../src/barretenberg/proof_system/proving_key/fixtures";
-    std::filesystem::create_directories(pk_dir);
-    std::string pk_path = pk_dir + "/proving_key";
-    std::ofstream os(pk_path);
-    // TODO: Investigate why this test fails in CI.
-    // WASI-SDK does not include support for <filesystem>, so we had to replace the call to
-    // `std::filesystem::create_directories(pk_dir);`
-    // with
-    // `mkdir(pk_dir.c_str(), 0700);`.
-    // It looks like the POSIX method would set the ERRNO after attempting to create the directory.
-    // The exception block is left here to help solve the problem later.
-    // try {
-    //     os.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    // } catch (const std::ios_base::failure& e) {
-    //     std::cout << "Caught an ios_base::failure.\n"
-    //               << "Error code: " << e.code().value() << " (" << e.code().message() << ")\n"
-    //               << "Error category: " << e.code().category().name() << '\n';
-    // }
-    if (!os.good()) {
-        std::cerr << "OS failed in composer_from_mmap_keys! \n";
-    }
+    auto builder = UltraCircuitBuilder();
+    fr a = fr::random_element();
+    uint32_t a_idx = builder.add_public_variable(a);
+    uint32_t b_idx = builder.add_variable(a.sqr());
+    builder.create_mul_gate({ a_idx, a_idx, b_idx, 1, -1, 0 });
+    builder.create_range_constraint(builder.add_variable(fr(1234)), 16, "range");
+
+    auto composer = UltraComposer();
     plonk::proving_key& p_key = *composer.compute_proving_key(builder);
-    write_mmap(os, pk_dir, p_key);
-    os.close();
-
-    // Read each precomputed polynomial from the files written above
-    // into a proving_key_data polynomial store using read_mmap
-    std::ifstream pk_stream = std::ifstream(pk_path);
-    if (!pk_stream.good()) {
-        std::cerr << "IS failed in composer_from_mmap_keys! \n";
+
+    const sha256::hash circuit_hash{ 1, 2, 3 };
+    const std::string pk_path = std::filesystem::temp_directory_path() / "proving_key_from_mmaped_key";
+    {
+        std::ofstream os(pk_path, std::ios::binary);
+        write_mmap(os, p_key, circuit_hash);
     }
     plonk::proving_key_data pk_data;
-    read_mmap(pk_stream, pk_dir, pk_data);
-    pk_stream.close();
+    sha256::hash mapped_circuit_hash;
+    read_mmap(pk_path, pk_data, mapped_circuit_hash);
+    // The polynomials keep the mapping alive
+    std::filesystem::remove(pk_path);
 
     // Loop over all pre-computed polys for the given composer type and ensure equality
     // between original proving key polynomial store and the polynomial store that was
@@ -141,8 +122,8 @@ StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
     bool all_polys_are_equal{ true };
     for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
         std::string poly_id = precomputed_poly_list[i];
-        barretenberg::polynomial& input_poly = p_key.polynomial_store.get(poly_id);
-        barretenberg::polynomial& output_poly = pk_data.polynomial_store.get(poly_id);
+        auto input_poly = p_key.polynomial_store.get(poly_id);
+        auto output_poly = pk_data.polynomial_store.get(poly_id);
         all_polys_are_equal = all_polys_are_equal && (input_poly == output_poly);
     }
 
@@ -150,10 +131,48 @@ StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
     EXPECT_EQ(all_polys_are_equal, true);
 
     // Check equality of other proving_key_data data
-    EXPECT_EQ(p_key.circuit_type, pk_data.circuit_type);
+    EXPECT_EQ(static_cast<uint32_t>(p_key.circuit_type), pk_data.circuit_type);
     EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
     EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+    EXPECT_EQ(p_key.memory_read_records, pk_data.memory_read_records);
+    EXPECT_EQ(p_key.memory_write_records, pk_data.memory_write_records);
+    EXPECT_EQ(mapped_circuit_hash, circuit_hash);
+
+    // Prove with the mapped key, which is mapped read-only, so that this would fault if the prover wrote to any of
+    // the pre-computed polynomials
+    auto crs = std::make_unique<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    const size_t circuit_size = pk_data.circuit_size;
+    auto mapped_key =
+        std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(circuit_size + 1));
+    auto mapped_composer = UltraComposer(mapped_key, nullptr);
+    auto prover = mapped_composer.create_prover(builder);
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_verifier(builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+// Test that a truncated memory-mapped proving key is rejected rather than read past the end of the mapping
+TEST(proving_key, truncated_mmaped_key)
+{
+    auto builder = UltraCircuitBuilder();
+    builder.add_public_variable(fr::random_element());
+    auto composer = UltraComposer();
+    plonk::proving_key& p_key = *composer.compute_proving_key(builder);
+
+    const sha256::hash circuit_hash{};
+    const std::string pk_path = std::filesystem::temp_directory_path() / "truncated_mmaped_key";
+    {
+        std::ofstream os(pk_path, std::ios::binary);
+        write_mmap(os, p_key, circuit_hash);
+    }
+    // Inside the polynomial labels, at the first label's length, inside the circuit hash and inside the magic
+    for (const size_t size : std::vector<size_t>{ 100, 56, 24, 3 }) {
+        std::filesystem::resize_file(pk_path, size);
+        plonk::proving_key_data pk_data;
+        sha256::hash mapped_circuit_hash;
+        EXPECT_ANY_THROW(read_mmap(pk_path, pk_data, mapped_circuit_hash));
+    }
+    std::filesystem::remove(pk_path);
 }
 #endif
-*/
@@ -7,6 +7,10 @@
 #include <fcntl.h>
 #include <ios>
 #include <sys/stat.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace proof_system::plonk {
 
@@ -138,4 +142,181 @@ template <typename B> inline void write_to_file(B& os, std::string const& path,
     write(os, key.memory_write_records);
 }
 
+/**
+ * The memory-mapped proving key format, written by `write_mmap` and read by `read_mmap`, is a single file made of a
+ * header followed by the pre-computed polynomials:
+ *
+ *   magic, version, circuit_type, circuit_size, num_public_inputs (uint32)
+ *   circuit_hash (32 bytes), identifying the circuit the key was computed for
+ *   num_polys (uint32), then for each polynomial: label (string), offset, size (uint64)
+ *   contains_recursive_proof, recursive_proof_public_input_indices, memory_read_records, memory_write_records
+ *
+ * The header is serialized like the rest of the key. Each polynomial is stored at a page-aligned offset as its
+ * coefficients in little endian Montgomery form, followed by a zero coefficient that fills its spare capacity, so that
+ * the mapped file can back the polynomials directly.
+ */
+constexpr uint32_t MMAP_PROVING_KEY_MAGIC = 0x4242504b; // "BBPK"
+constexpr uint32_t MMAP_PROVING_KEY_VERSION = 2;
+constexpr size_t MMAP_PROVING_KEY_ALIGNMENT = 4096;
+
+inline void write_mmap(std::ostream& os, proving_key& key, sha256::hash const& circuit_hash)
+{
+    using serialize::write;
+    using barretenberg::fr;
+
+    if (!is_little_endian()) {
+        throw_or_abort("Memory-mapped proving keys require a little endian host.");
+    }
+
+    PrecomputedPolyList precomputed_poly_list(key.circuit_type);
+    const size_t num_polys = precomputed_poly_list.size();
+    std::vector<barretenberg::polynomial> polys;
+    for (size_t i = 0; i < num_polys; ++i) {
+        polys.emplace_back(key.polynomial_store.get(precomputed_poly_list[i]));
+    }
+
+    // The header's size does not depend on the offsets it holds, so it is built once to find where the data starts
+    auto build_header = [&](const std::vector<uint64_t>& offsets) {
+        std::vector<uint8_t> header;
+        write(header, MMAP_PROVING_KEY_MAGIC);
+        write(header, MMAP_PROVING_KEY_VERSION);
+        write(header, static_cast<uint32_t>(key.circuit_type));
+        write(header, static_cast<uint32_t>(key.circuit_size));
+        write(header, static_cast<uint32_t>(key.num_public_inputs));
+        write(header, circuit_hash);
+        write(header, static_cast<uint32_t>(num_polys));
+        for (size_t i = 0; i < num_polys; ++i) {
+            write(header, precomputed_poly_list[i]);
+            write(header, offsets[i]);
+            write(header, static_cast<uint64_t>(polys[i].size()));
+        }
+        write(header, key.contains_recursive_proof);
+        write(header, key.recursive_proof_public_input_indices);
+        write(header, key.memory_read_records);
+        write(header, key.memory_write_records);
+        return header;
+    };
+    auto align = [](size_t offset) {
+        return (offset + MMAP_PROVING_KEY_ALIGNMENT - 1) & ~(MMAP_PROVING_KEY_ALIGNMENT - 1);
+    };
+
+    std::vector<uint64_t> offsets(num_polys);
+    size_t offset = align(build_header(offsets).size());
+    for (size_t i = 0; i < num_polys; ++i) {
+        offsets[i] = offset;
+        offset = align(offset + (polys[i].size() + 1) * sizeof(fr));
+    }
+    const auto header = build_header(offsets);
+    os.write((char*)header.data(), (std::streamsize)header.size());
+
+    const std::vector<char> padding(MMAP_PROVING_KEY_ALIGNMENT, 0);
+    size_t position = header.size();
+    for (size_t i = 0; i < num_polys; ++i) {
+        os.write(padding.data(), (std::streamsize)(offsets[i] - position));
+        os.write((char*)polys[i].data().get(), (std::streamsize)(polys[i].size() * sizeof(fr)));
+        os.write(padding.data(), (std::streamsize)sizeof(fr));
+        position = offsets[i] + (polys[i].size() + 1) * sizeof(fr);
+    }
+    if (!os.good()) {
+        throw_or_abort("Failed to write memory-mapped proving key.");
+    }
+}
+
+#ifndef __wasm__
+/**
+ * @brief Maps a proving key written by `write_mmap`. The pre-computed polynomials are not read: they point into the
+ * mapping, so their pages are loaded on first use and shared, through the page cache, by every process that maps the
+ * same file.
+ *
+ * @details The file is mapped read-only: the prover only reads the pre-computed polynomials, and writing to one of them
+ * faults rather than silently diverging from the file. The mapping is released once every polynomial backed by it has
+ * been destroyed. The key is not checked against any circuit here; the caller compares circuit_hash, which is read
+ * from the header, with the hash of the circuit it proves.
+ */
+inline void read_mmap(std::string const& path, proving_key_data& key, sha256::hash& circuit_hash)
+{
+    using serialize::read;
+    using barretenberg::fr;
+
+    if (!is_little_endian()) {
+        throw_or_abort("Memory-mapped proving keys require a little endian host.");
+    }
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open proving key: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        throw_or_abort("Failed to read proving key: " + path);
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    void* address = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        throw_or_abort("Failed to map proving key: " + path);
+    }
+    std::shared_ptr<uint8_t> mapping(static_cast<uint8_t*>(address),
+                                     [file_size](uint8_t* ptr) { munmap(ptr, file_size); });
+
+    // Every header field is checked against the end of the file before it is read, so that a truncated or corrupt key
+    // fails cleanly rather than reading past the mapping
+    const uint8_t* it = mapping.get();
+    const uint8_t* const end = mapping.get() + file_size;
+    const auto ensure_available = [&](const uint64_t num_bytes) {
+        if (static_cast<uint64_t>(end - it) < num_bytes) {
+            throw_or_abort("Truncated proving key: " + path);
+        }
+    };
+    const auto read_field = [&](auto& value) {
+        ensure_available(sizeof(value));
+        read(it, value);
+    };
+    // Strings and vectors are a uint32 count followed by that many elements
+    const auto read_sequence = [&](auto& value) {
+        using Element = typename std::decay_t<decltype(value)>::value_type;
+        uint32_t count = 0;
+        ensure_available(sizeof(count));
+        const uint8_t* count_it = it;
+        read(count_it, count);
+        ensure_available(sizeof(count) + static_cast<uint64_t>(count) * sizeof(Element));
+        read(it, value);
+    };
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    read_field(magic);
+    read_field(version);
+    if (magic != MMAP_PROVING_KEY_MAGIC || version != MMAP_PROVING_KEY_VERSION) {
+        throw_or_abort("Not a memory-mapped proving key of a supported version: " + path);
+    }
+    read_field(key.circuit_type);
+    read_field(key.circuit_size);
+    read_field(key.num_public_inputs);
+    read_field(circuit_hash);
+
+    uint32_t num_polys = 0;
+    read_field(num_polys);
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::string label;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        read_sequence(label);
+        read_field(offset);
+        read_field(size);
+        if (offset % MMAP_PROVING_KEY_ALIGNMENT != 0 || offset > file_size ||
+            (file_size - offset) / sizeof(fr) < size + 1) {
+            throw_or_abort("Corrupt proving key polynomial: " + label);
+        }
+        auto* coefficients = reinterpret_cast<fr*>(mapping.get() + offset);
+        key.polynomial_store.put(label, barretenberg::polynomial(std::shared_ptr<fr[]>(mapping, coefficients), size));
+    }
+    read_field(key.contains_recursive_proof);
+    read_sequence(key.recursive_proof_public_input_indices);
+    read_sequence(key.memory_read_records);
+    read_sequence(key.memory_write_records);
+}
+#endif
+
 } // namespace proof_system::plonk
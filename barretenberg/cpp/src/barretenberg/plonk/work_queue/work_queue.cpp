@@ -1,7 +1,11 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace proof_system::plonk {
 
@@ -199,87 +203,239 @@ void work_queue::add_to_queue(const work_item& item)
     // #endif
 }
 
+/**
+ * @brief Process the queued work items
+ *
+ * @details The scalars of a SCALAR_MULTIPLICATION item are fixed when it is queued, so the scalar multiplications are
+ * independent of the FFT and IFFT items (the transforms), which may depend on each other and are processed in order.
+ * The two run concurrently on separate groups of threads, sized by their estimated work (see
+ * get_num_transform_threads). The results of the scalar multiplications are added to the transcript once both groups
+ * are done.
+ */
 void work_queue::process_queue()
 {
+    std::vector<const work_item*> transforms;
+    std::vector<const work_item*> scalar_multiplications;
     for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
-
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
-
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
+            scalar_multiplications.push_back(&item);
+        } else {
+            transforms.push_back(&item);
+        }
+    }
+    const auto process_transforms = [&]() {
+        for (const auto* item : transforms) {
+            process_transform(*item);
+        }
+    };
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+    std::vector<barretenberg::g1::affine_element> results;
+    const size_t num_transform_threads = get_num_transform_threads();
+    if (num_transform_threads > 0) {
+        parallel_invoke_in_thread_groups(num_transform_threads, process_transforms, [&]() {
+            results = compute_scalar_multiplications(scalar_multiplications);
+        });
+    } else {
+        process_transforms();
+        results = compute_scalar_multiplications(scalar_multiplications);
+    }
 
-            transcript->add_element(item.tag, result.to_buffer());
+    for (size_t i = 0; i < scalar_multiplications.size(); ++i) {
+        transcript->add_element(scalar_multiplications[i]->tag, results[i].to_buffer());
+    }
+    work_item_queue = std::vector<work_item>();
+}
 
-            break;
+/**
+ * @details The threads are split in proportion to the estimated cost of the two kinds of work, leaving at least one to
+ * each. There is nothing to overlap on a single thread, or if the queue holds only one kind of work.
+ */
+size_t work_queue::get_num_transform_threads() const
+{
+    size_t transform_cost = 0;
+    size_t scalar_multiplication_cost = 0;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
+            scalar_multiplication_cost += get_scalar_multiplication_cost(item);
+        } else {
+            transform_cost += get_transform_cost(item);
         }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace barretenberg;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
-
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
-
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
+    }
+    const size_t num_threads = get_num_cpus();
+    if (num_threads < 2 || transform_cost == 0 || scalar_multiplication_cost == 0) {
+        return 0;
+    }
+    const double transform_share =
+        static_cast<double>(transform_cost) / static_cast<double>(transform_cost + scalar_multiplication_cost);
+    const auto num_transform_threads = std::llround(transform_share * static_cast<double>(num_threads));
+    return std::clamp<size_t>(static_cast<size_t>(num_transform_threads), 1, num_threads - 1);
+}
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+/**
+ * @brief Compute the scalar multiplications of the given SCALAR_MULTIPLICATION items against the monomial SRS
+ *
+ * @details Items small enough for Straus (the size below which pippenger itself hands off to Straus) are computed
+ * concurrently, one per thread. The others are computed one after another with Pippenger, each using all threads and
+ * all of them sharing the pooled runtime state, which is only reallocated when an item is larger than any before it.
+ */
+std::vector<barretenberg::g1::affine_element> work_queue::compute_scalar_multiplications(
+    const std::vector<const work_item*>& items)
+{
+    using namespace barretenberg;
+    std::vector<g1::affine_element> results(items.size());
+    if (items.empty()) {
+        return results;
+    }
+    // The SRS is stored as a pippenger point table, holding each point followed by its endomorphism image
+    g1::affine_element* srs_points = key->reference_string->get_monomial_points();
 
-            break;
+    const size_t straus_threshold = get_straus_threshold();
+    std::vector<size_t> small_items;
+    size_t max_msm_size = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+        const size_t msm_size = get_msm_size(items[i]);
+        ASSERT(msm_size <= key->reference_string->get_monomial_size());
+        if (msm_size <= straus_threshold) {
+            small_items.push_back(i);
+        } else {
+            max_msm_size = std::max(max_msm_size, msm_size);
         }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace barretenberg;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
-            break;
+    }
+
+    parallel_for(small_items.size(), [&](size_t j) {
+        const size_t i = small_items[j];
+        const size_t msm_size = get_msm_size(items[i]);
+        std::vector<g1::affine_element> points(msm_size);
+        for (size_t k = 0; k < msm_size; ++k) {
+            points[k] = srs_points[2 * k];
         }
-        default: {
+        results[i] =
+            scalar_multiplication::straus<curve::BN254>(items[i]->mul_scalars.get(), points.data(), msm_size);
+    });
+
+    if (max_msm_size == 0) {
+        return results;
+    }
+    // A state allocated within a smaller thread group has scratch space for fewer threads
+    if (pippenger_state == nullptr || pippenger_state->num_points < 2 * max_msm_size ||
+        pippenger_state->num_threads < get_num_cpus_pow2()) {
+        // Release the old state before allocating the new one
+        pippenger_state = nullptr;
+        pippenger_state =
+            std::make_shared<scalar_multiplication::pippenger_runtime_state<curve::BN254>>(max_msm_size);
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        const size_t msm_size = get_msm_size(items[i]);
+        if (msm_size > straus_threshold) {
+            results[i] = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+                items[i]->mul_scalars.get(), srs_points, msm_size, *pippenger_state);
         }
+    }
+    return results;
+}
+
+size_t work_queue::get_msm_size(const work_item* item)
+{
+    // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+    return static_cast<size_t>(static_cast<uint256_t>(item->constant));
+}
+
+/**
+ * @brief The size up to which a scalar multiplication is computed with Straus on one thread (the size below which
+ * pippenger itself hands off to Straus)
+ */
+size_t work_queue::get_straus_threshold()
+{
+    return std::max(get_num_cpus_pow2() * 8, barretenberg::scalar_multiplication::STRAUS_MAX_POINTS);
+}
+
+/**
+ * @brief The approximate number of field multiplications of an FFT (a coset FFT over the large domain) or an IFFT
+ * (over the small domain): half a multiplication per element per butterfly layer, and one per element for the coset
+ */
+size_t work_queue::get_transform_cost(const work_item& item) const
+{
+    const size_t size = item.work_type == WorkType::IFFT ? key->circuit_size : 4 * key->circuit_size;
+    if (size == 0) {
+        return 0;
+    }
+    return size / 2 * numeric::get_msb(size) + size;
+}
+
+/**
+ * @brief The approximate number of field multiplications of a scalar multiplication: Pippenger adds each point and
+ * its endomorphism image into a bucket in every round, and a batched affine addition costs about 6 multiplications
+ */
+size_t work_queue::get_scalar_multiplication_cost(const work_item& item)
+{
+    constexpr size_t AFFINE_ADDITION_COST = 6;
+    const size_t num_points = 2 * get_msm_size(&item);
+    if (num_points == 0) {
+        return 0;
+    }
+    return num_points * barretenberg::scalar_multiplication::get_num_rounds(num_points) * AFFINE_ADDITION_COST;
+}
+
+void work_queue::process_transform(const work_item& item)
+{
+    switch (item.work_type) {
+    // Commenting this out as per above.
+    // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
+    // due to the need to copy memory between web workers
+    // case WorkType::SMALL_FFT: {
+    //     using namespace barretenberg;
+    //     const size_t n = key->circuit_size;
+    //     auto wire = key->polynomial_store.get(item.tag);
+
+    //     polynomial wire_copy(wire, n);
+    //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
+
+    //     if (item.index != 0) {
+    //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
+    //         for (size_t i = 0; i < n; ++i) {
+    //             old_wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         old_wire_fft[4 * n + item.index] = wire_copy[0];
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
+    //     } else {
+    //         polynomial wire_fft(4 * n + 4);
+    //         for (size_t i = 0; i < n; ++i) {
+    //             wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    //     }
+    //     break;
+    // }
+    case WorkType::FFT: {
+        using namespace barretenberg;
+        auto wire = key->polynomial_store.get(item.tag);
+        polynomial wire_fft(wire, 4 * key->circuit_size + 4);
+
+        wire_fft.coset_fft(key->large_domain);
+        for (size_t i = 0; i < 4; i++) {
+            wire_fft[4 * key->circuit_size + i] = wire_fft[i];
         }
+
+        key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+
+        break;
+    }
+    // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+    case WorkType::IFFT: {
+        using namespace barretenberg;
+        // retrieve wire in lagrange form
+        auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+
+        // Compute wire monomial form via ifft on lagrange form then add it to the store
+        polynomial wire_monomial(key->circuit_size);
+        polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
+        key->polynomial_store.put(item.tag, std::move(wire_monomial));
+
+        break;
+    }
+    default: {
+    }
     }
-    work_item_queue = std::vector<work_item>();
 }
 
 std::vector<work_queue::work_item> work_queue::get_queue() const
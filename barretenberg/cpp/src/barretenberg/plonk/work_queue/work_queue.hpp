@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/transcript/transcript_wrappers.hpp"
 
@@ -34,9 +35,22 @@ class work_queue {
 
     work_queue(proving_key* prover_key = nullptr, transcript::StandardTranscript* prover_transcript = nullptr);
 
-    work_queue(const work_queue& other) = default;
+    // A copy gets its own pippenger state, so that the copies can be processed concurrently
+    work_queue(const work_queue& other)
+        : key(other.key)
+        , transcript(other.transcript)
+        , work_item_queue(other.work_item_queue)
+    {}
     work_queue(work_queue&& other) = default;
-    work_queue& operator=(const work_queue& other) = default;
+    work_queue& operator=(const work_queue& other)
+    {
+        key = other.key;
+        transcript = other.transcript;
+        // work_item is not assignable, so the items are copied into a new vector that then replaces ours
+        work_item_queue = std::vector<work_item>(other.work_item_queue);
+        pippenger_state = nullptr;
+        return *this;
+    }
     work_queue& operator=(work_queue&& other) = default;
 
     work_item_info get_queued_work_item_info() const;
@@ -61,11 +75,33 @@ class work_queue {
 
     void process_queue();
 
+    /**
+     * @brief The number of threads the queued FFTs and IFFTs get while the scalar multiplications run on the others,
+     * or 0 if the two don't overlap
+     */
+    size_t get_num_transform_threads() const;
+
     std::vector<work_item> get_queue() const;
 
   private:
+    void process_transform(const work_item& item);
+
+    std::vector<barretenberg::g1::affine_element> compute_scalar_multiplications(
+        const std::vector<const work_item*>& items);
+
+    static size_t get_msm_size(const work_item* item);
+
+    static size_t get_straus_threshold();
+
+    size_t get_transform_cost(const work_item& item) const;
+
+    static size_t get_scalar_multiplication_cost(const work_item& item);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    // Pippenger's scratch space, allocated for the largest scalar multiplication seen so far and reused by every
+    // process_queue call
+    std::shared_ptr<barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>> pippenger_state;
 };
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "work_queue.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+using namespace proof_system;
+using namespace proof_system::plonk;
+
+// Ensure that FFTs are overlapped with scalar multiplications too large for Straus, and that both still come out right
+TEST(work_queue, overlaps_ffts_with_pippenger)
+{
+    if (get_num_cpus() < 2) {
+        GTEST_SKIP() << "needs at least two threads (e.g. HARDWARE_CONCURRENCY=4)";
+    }
+    constexpr size_t n = 1024;
+    auto file_crs = std::make_shared<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto key = std::make_shared<proving_key>(n, 0, file_crs->get_prover_crs(n), CircuitType::STANDARD);
+    transcript::StandardTranscript transcript{ transcript::Manifest() };
+    work_queue queue(key.get(), &transcript);
+
+    polynomial wire(n);
+    for (auto& coeff : wire) {
+        coeff = fr::random_element();
+    }
+    key->polynomial_store.put("w_1", polynomial(wire));
+    std::shared_ptr<fr[]> scalars(new fr[n]);
+    for (fr* scalar = scalars.get(); scalar != scalars.get() + n; ++scalar) {
+        *scalar = fr::random_element();
+    }
+    queue.add_to_queue({ work_queue::WorkType::FFT, nullptr, "w_1", fr(0), 0 });
+    queue.add_to_queue({ work_queue::WorkType::SCALAR_MULTIPLICATION, scalars, "W_1", fr(n), 0 });
+
+    ASSERT_GT(n, std::max(get_num_cpus_pow2() * 8, scalar_multiplication::STRAUS_MAX_POINTS));
+    const size_t num_transform_threads = queue.get_num_transform_threads();
+    EXPECT_GE(num_transform_threads, 1UL);
+    EXPECT_LT(num_transform_threads, get_num_cpus());
+
+    queue.process_queue();
+
+    std::vector<g1::affine_element> points(n);
+    for (size_t i = 0; i < n; ++i) {
+        points[i] = key->reference_string->get_monomial_points()[2 * i];
+    }
+    const g1::affine_element expected_commitment(
+        scalar_multiplication::straus<curve::BN254>(scalars.get(), points.data(), n));
+    EXPECT_EQ(transcript.get_element("W_1"), expected_commitment.to_buffer());
+
+    polynomial expected_fft(wire, 4 * n + 4);
+    expected_fft.coset_fft(key->large_domain);
+    const auto wire_fft = key->polynomial_store.get("w_1_fft");
+    for (size_t i = 0; i < 4 * n; ++i) {
+        EXPECT_EQ(wire_fft[i], expected_fft[i]);
+    }
+}
@@ -94,6 +94,12 @@ Polynomial<Fr>::Polynomial(std::span<const Fr> coefficients)
     zero_memory_beyond(size_);
 }
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(pointer coefficients, const size_t size)
+    : coefficients_(std::move(coefficients))
+    , size_(size)
+{}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<const Fr> evaluations)
     : Polynomial(interpolation_points.size())
@@ -403,6 +409,59 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     return *this;
 }
 
+template <typename Fr>
+Polynomial<Fr> Polynomial<Fr>::linear_combination(std::span<const std::span<const Fr>> polynomials,
+                                                  std::span<const Fr> scalars,
+                                                  size_t size)
+{
+    // 512 coefficients of 32 bytes fill half of a typical L1 data cache
+    constexpr size_t BLOCK_SIZE = 1 << 9;
+    ASSERT(polynomials.size() == scalars.size());
+    for (const auto& poly : polynomials) {
+        size = std::max(size, poly.size());
+    }
+    Polynomial result(size, DontZeroMemory::FLAG);
+    result.zero_memory_beyond(size);
+    Fr* coefficients = result.coefficients_.get();
+
+    size_t num_threads = thread_utils::calculate_num_threads(size);
+    size_t range_per_thread = size / num_threads;
+    size_t leftovers = size - (range_per_thread * num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        size_t offset = j * range_per_thread;
+        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
+        for (size_t block_start = offset; block_start < end; block_start += BLOCK_SIZE) {
+            const size_t block_end = std::min(block_start + BLOCK_SIZE, end);
+            for (size_t i = block_start; i < block_end; ++i) {
+                coefficients[i] = Fr::zero();
+            }
+            for (size_t poly_idx = 0; poly_idx < polynomials.size(); ++poly_idx) {
+                const Fr* poly = polynomials[poly_idx].data();
+                const Fr scalar = scalars[poly_idx];
+                const size_t poly_end = std::min(block_end, polynomials[poly_idx].size());
+                // Prefetch the next input's rows of this block, one cache line per two coefficients, so that they
+                // arrive while this input is accumulated
+                const bool is_last = poly_idx + 1 == polynomials.size();
+                const Fr* next = is_last ? nullptr : polynomials[poly_idx + 1].data();
+                const size_t next_end = is_last ? 0 : std::min(block_end, polynomials[poly_idx + 1].size());
+                for (size_t i = block_start; i < next_end; i += 2) {
+                    __builtin_prefetch(next + i);
+                }
+                if (scalar == Fr::one()) {
+                    for (size_t i = block_start; i < poly_end; ++i) {
+                        coefficients[i] += poly[i];
+                    }
+                } else {
+                    for (size_t i = block_start; i < poly_end; ++i) {
+                        coefficients[i] += scalar * poly[i];
+                    }
+                }
+            }
+        }
+    });
+    return result;
+}
+
 template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evaluation_points, bool shift) const
 {
     const size_t m = evaluation_points.size();
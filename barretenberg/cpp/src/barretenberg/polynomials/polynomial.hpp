@@ -34,6 +34,10 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    // Create a polynomial that shares the given memory, which must hold size + DEFAULT_CAPACITY_INCREASE coefficients
+    // (e.g. a polynomial mapped read-only from a proving key file, which must then not be written to).
+    Polynomial(pointer coefficients, size_t size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -194,6 +198,21 @@ template <typename Fr> class Polynomial {
      */
     Polynomial& operator*=(const Fr scaling_factor);
 
+    /**
+     * @brief returns ∑ᵢ sᵢ⋅pᵢ(X), of the given size (by default, the size of the largest pᵢ)
+     *
+     * @details Batching with add_scaled reads and writes the whole result once per input polynomial. Here the result
+     * is written once: each thread walks its rows of the result in blocks small enough to stay in cache, accumulating
+     * every input into a block (while prefetching the next input's rows) before moving on to the next block.
+     *
+     * @param polynomials (p₀, …, pₘ₋₁), which may have different sizes
+     * @param scalars (s₀, …, sₘ₋₁)
+     * @param size the size of the result, at least that of every pᵢ
+     */
+    static Polynomial linear_combination(std::span<const std::span<const Fr>> polynomials,
+                                         std::span<const Fr> scalars,
+                                         size_t size = 0);
+
     /**
      * @brief evaluates p(X) = ∑ᵢ aᵢ⋅Xⁱ considered as multi-linear extension p(X₀,…,Xₘ₋₁) = ∑ᵢ aᵢ⋅Lᵢ(X₀,…,Xₘ₋₁)
      * at u = (u₀,…,uₘ₋₁)
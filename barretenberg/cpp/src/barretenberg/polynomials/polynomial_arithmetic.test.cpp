@@ -1305,3 +1305,39 @@ TYPED_TEST(PolynomialTests, RightShift)
 
     EXPECT_EQ(shifted_evaluation, shifted_eval_reconstructed);
 }
+
+/**
+ * @brief Test that Polynomial::linear_combination agrees with a sequence of add_scaled calls, including for inputs of
+ * different sizes and a result larger than every input
+ *
+ */
+TYPED_TEST(PolynomialTests, LinearCombination)
+{
+    using FF = TypeParam;
+
+    const std::vector<size_t> sizes{ 1000, 1, 1024, 513, 0, 777 };
+    std::vector<Polynomial<FF>> polys;
+    std::vector<FF> scalars;
+    for (const auto size : sizes) {
+        polys.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            polys.back()[i] = FF::random_element();
+        }
+        scalars.emplace_back(FF::random_element());
+    }
+    scalars[2] = FF::one();
+
+    for (const size_t result_size : std::vector<size_t>{ 0, 1024, 1500 }) {
+        Polynomial<FF> expected(std::max(result_size, size_t(1024)));
+        for (size_t j = 0; j < polys.size(); ++j) {
+            for (size_t i = 0; i < polys[j].size(); ++i) {
+                expected[i] += scalars[j] * polys[j][i];
+            }
+        }
+        std::vector<std::span<const FF>> poly_spans(polys.begin(), polys.end());
+        auto result = Polynomial<FF>::linear_combination(poly_spans, scalars, result_size);
+        EXPECT_EQ(result, expected);
+        // The coefficient past the end is zero, as shifted() requires
+        EXPECT_EQ(result.data().get()[result.size()], FF::zero());
+    }
+}
@@ -7,6 +7,7 @@
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/io.hpp"
 #include <benchmark/benchmark.h>
@@ -358,5 +359,66 @@ void fq_mul_asm_bench(State& state) noexcept
 }
 BENCHMARK(fq_mul_asm_bench);
 
+/**
+ * @brief Fill num_polys polynomials of the given size, and their batching scalars, with pseudorandom coefficients
+ */
+void generate_batch(std::vector<Polynomial<fr>>& polys, std::vector<fr>& scalars, size_t num_polys, size_t size)
+{
+    fr coefficient = fr::random_element();
+    const fr step = fr::random_element();
+    for (size_t j = 0; j < num_polys; ++j) {
+        polys.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            polys.back()[i] = coefficient;
+            coefficient *= step;
+        }
+        scalars.emplace_back(fr::random_element());
+    }
+}
+
+/**
+ * @brief Batch state.range(0) polynomials of size 2^state.range(1) with a sequence of add_scaled calls, as the
+ * commitment schemes used to
+ */
+void batch_add_scaled_bench(State& state) noexcept
+{
+    const auto num_polys = static_cast<size_t>(state.range(0));
+    const size_t size = size_t(1) << static_cast<size_t>(state.range(1));
+    std::vector<Polynomial<fr>> polys;
+    std::vector<fr> scalars;
+    generate_batch(polys, scalars, num_polys, size);
+    for (auto _ : state) {
+        Polynomial<fr> result(size);
+        for (size_t j = 0; j < num_polys; ++j) {
+            result.add_scaled(polys[j], scalars[j]);
+        }
+        DoNotOptimize(result);
+    }
+    const auto num_bytes = static_cast<size_t>(state.iterations()) * num_polys * size * sizeof(fr);
+    state.SetBytesProcessed(static_cast<int64_t>(num_bytes));
+}
+BENCHMARK(batch_add_scaled_bench)->ArgsProduct({ { 32, 64 }, { 16, 18 } })->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Batch state.range(0) polynomials of size 2^state.range(1) with Polynomial::linear_combination, which writes
+ * the result once instead of once per input
+ */
+void linear_combination_bench(State& state) noexcept
+{
+    const auto num_polys = static_cast<size_t>(state.range(0));
+    const size_t size = size_t(1) << static_cast<size_t>(state.range(1));
+    std::vector<Polynomial<fr>> polys;
+    std::vector<fr> scalars;
+    generate_batch(polys, scalars, num_polys, size);
+    std::vector<std::span<const fr>> poly_spans(polys.begin(), polys.end());
+    for (auto _ : state) {
+        auto result = Polynomial<fr>::linear_combination(poly_spans, scalars);
+        DoNotOptimize(result);
+    }
+    const auto num_bytes = static_cast<size_t>(state.iterations()) * num_polys * size * sizeof(fr);
+    state.SetBytesProcessed(static_cast<int64_t>(num_bytes));
+}
+BENCHMARK(linear_combination_bench)->ArgsProduct({ { 32, 64 }, { 16, 18 } })->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
 // 21218750000
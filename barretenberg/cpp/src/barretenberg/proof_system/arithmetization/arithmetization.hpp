@@ -1,7 +1,7 @@
 #pragma once
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include <array>
-#include <barretenberg/common/slab_allocator.hpp>
+#include <barretenberg/common/arena_allocator.hpp>
 #include <cstddef>
 #include <vector>
 
@@ -37,7 +37,7 @@ template <typename FF_> class Standard {
     static constexpr size_t NUM_WIRES = 3;
     static constexpr size_t NUM_SELECTORS = 5;
     using FF = FF_;
-    using SelectorType = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+    using SelectorType = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
     std::vector<SelectorType> selectors;
 
@@ -60,6 +60,16 @@ template <typename FF_> class Standard {
         }
     }
 
+    /**
+     * @brief Serve the (still empty) selectors from the given arena
+     */
+    void set_arena(const std::shared_ptr<barretenberg::MemoryArena>& arena)
+    {
+        for (auto& p : selectors) {
+            p = SelectorType(barretenberg::ContainerArenaAllocator<FF>(arena));
+        }
+    }
+
     // Note: These are needed for Plonk only (for poly storage in a std::map). Must be in same order as above struct.
     inline static const std::vector<std::string> selector_names = { "q_m", "q_1", "q_2", "q_3", "q_c" };
 };
@@ -69,7 +79,7 @@ template <typename FF_> class Ultra {
     static constexpr size_t NUM_WIRES = 4;
     static constexpr size_t NUM_SELECTORS = 11;
     using FF = FF_;
-    using SelectorType = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+    using SelectorType = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
   private:
     std::array<SelectorType, NUM_SELECTORS> selectors;
@@ -96,6 +106,16 @@ template <typename FF_> class Ultra {
         }
     }
 
+    /**
+     * @brief Serve the (still empty) selectors from the given arena
+     */
+    void set_arena(const std::shared_ptr<barretenberg::MemoryArena>& arena)
+    {
+        for (auto& vec : selectors) {
+            vec = SelectorType(barretenberg::ContainerArenaAllocator<FF>(arena));
+        }
+    }
+
     /**
      * @brief Add zeros to all selectors which are not part of the conventional Ultra arithmetization
      * @details Does nothing for this class since this IS the conventional Ultra arithmetization
@@ -111,16 +131,17 @@ template <typename FF_> class Ultra {
 
 /**
  * @brief Ultra Honk arithmetization
- * @details Extends the conventional Ultra arithmetization with a new selector related to databus lookups
+ * @details Extends the conventional Ultra arithmetization with a selector related to databus lookups and the selectors
+ * of the Poseidon2 external and internal round gates
  *
  * @tparam FF_
  */
 template <typename FF_> class UltraHonk {
   public:
     static constexpr size_t NUM_WIRES = 4;
-    static constexpr size_t NUM_SELECTORS = 12;
+    static constexpr size_t NUM_SELECTORS = 14;
     using FF = FF_;
-    using SelectorType = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+    using SelectorType = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
   private:
     std::array<SelectorType, NUM_SELECTORS> selectors;
@@ -138,6 +159,8 @@ template <typename FF_> class UltraHonk {
     SelectorType& q_aux() { return selectors[9]; };
     SelectorType& q_lookup_type() { return selectors[10]; };
     SelectorType& q_busread() { return this->selectors[11]; };
+    SelectorType& q_poseidon2_external() { return this->selectors[12]; };
+    SelectorType& q_poseidon2_internal() { return this->selectors[13]; };
 
     const auto& get() const { return selectors; };
 
@@ -148,13 +171,28 @@ template <typename FF_> class UltraHonk {
         }
     }
 
+    /**
+     * @brief Serve the (still empty) selectors from the given arena
+     */
+    void set_arena(const std::shared_ptr<barretenberg::MemoryArena>& arena)
+    {
+        for (auto& vec : selectors) {
+            vec = SelectorType(barretenberg::ContainerArenaAllocator<FF>(arena));
+        }
+    }
+
     /**
      * @brief Add zeros to all selectors which are not part of the conventional Ultra arithmetization
      * @details Facilitates reuse of Ultra gate construction functions in arithmetizations which extend the conventional
      * Ultra arithmetization
      *
      */
-    void pad_additional() { q_busread().emplace_back(0); };
+    void pad_additional()
+    {
+        q_busread().emplace_back(0);
+        q_poseidon2_external().emplace_back(0);
+        q_poseidon2_internal().emplace_back(0);
+    };
 
     // Note: Unused. Needed only for consistency with Ultra arith (which is used by Plonk)
     inline static const std::vector<std::string> selector_names = {};
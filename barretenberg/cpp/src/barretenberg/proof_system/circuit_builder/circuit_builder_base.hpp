@@ -1,4 +1,6 @@
 #pragma once
+#include "barretenberg/common/arena_allocator.hpp"
+#include "barretenberg/common/flat_hash_map.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
@@ -34,12 +36,17 @@ template <typename FF_> class CircuitBuilderBase {
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
     // DOCTODO(#231): replace with the relevant wiki link.
-    std::map<uint32_t, uint32_t> tau;
+    barretenberg::FlatHashMap<uint32_t, uint32_t> tau;
 
     // Publicin put indices which contain recursive proof information
     std::vector<uint32_t> recursive_proof_public_input_indices;
     bool contains_recursive_proof = false;
 
+    // Backing storage for the wire and selector columns of the derived builders. It is owned by the builder (and the
+    // containers it hands memory to), so that circuits can be constructed concurrently without any shared state. A copy
+    // gets an arena of its own, and a moved-from builder is left with a fresh one.
+    std::shared_ptr<barretenberg::MemoryArena> arena = std::make_shared<barretenberg::MemoryArena>();
+
     bool _failed = false;
     std::string _err;
     static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
@@ -55,10 +62,89 @@ template <typename FF_> class CircuitBuilderBase {
         real_variable_tags.reserve(size_hint * 3);
     }
 
-    CircuitBuilderBase(const CircuitBuilderBase& other) = default;
-    CircuitBuilderBase(CircuitBuilderBase&& other) noexcept = default;
-    CircuitBuilderBase& operator=(const CircuitBuilderBase& other) = default;
-    CircuitBuilderBase& operator=(CircuitBuilderBase&& other) noexcept = default;
+    CircuitBuilderBase(const CircuitBuilderBase& other)
+        : num_gates(other.num_gates)
+        , public_inputs(other.public_inputs)
+        , variables(other.variables)
+        , variable_names(other.variable_names)
+        , next_var_index(other.next_var_index)
+        , prev_var_index(other.prev_var_index)
+        , real_variable_index(other.real_variable_index)
+        , real_variable_tags(other.real_variable_tags)
+        , current_tag(other.current_tag)
+        , tau(other.tau)
+        , recursive_proof_public_input_indices(other.recursive_proof_public_input_indices)
+        , contains_recursive_proof(other.contains_recursive_proof)
+        , _failed(other._failed)
+        , _err(other._err)
+        , zero_idx(other.zero_idx)
+        , one_idx(other.one_idx)
+    {}
+    CircuitBuilderBase(CircuitBuilderBase&& other) noexcept
+        : num_gates(other.num_gates)
+        , public_inputs(std::move(other.public_inputs))
+        , variables(std::move(other.variables))
+        , variable_names(std::move(other.variable_names))
+        , next_var_index(std::move(other.next_var_index))
+        , prev_var_index(std::move(other.prev_var_index))
+        , real_variable_index(std::move(other.real_variable_index))
+        , real_variable_tags(std::move(other.real_variable_tags))
+        , current_tag(other.current_tag)
+        , tau(std::move(other.tau))
+        , recursive_proof_public_input_indices(std::move(other.recursive_proof_public_input_indices))
+        , contains_recursive_proof(other.contains_recursive_proof)
+        , arena(std::exchange(other.arena, std::make_shared<barretenberg::MemoryArena>()))
+        , _failed(other._failed)
+        , _err(std::move(other._err))
+        , zero_idx(other.zero_idx)
+        , one_idx(other.one_idx)
+    {}
+    CircuitBuilderBase& operator=(const CircuitBuilderBase& other)
+    {
+        // The arena is not copied: the columns the derived builders copy over stay in our own
+        if (this != &other) {
+            num_gates = other.num_gates;
+            public_inputs = other.public_inputs;
+            variables = other.variables;
+            variable_names = other.variable_names;
+            next_var_index = other.next_var_index;
+            prev_var_index = other.prev_var_index;
+            real_variable_index = other.real_variable_index;
+            real_variable_tags = other.real_variable_tags;
+            current_tag = other.current_tag;
+            tau = other.tau;
+            recursive_proof_public_input_indices = other.recursive_proof_public_input_indices;
+            contains_recursive_proof = other.contains_recursive_proof;
+            _failed = other._failed;
+            _err = other._err;
+            zero_idx = other.zero_idx;
+            one_idx = other.one_idx;
+        }
+        return *this;
+    }
+    CircuitBuilderBase& operator=(CircuitBuilderBase&& other) noexcept
+    {
+        if (this != &other) {
+            num_gates = other.num_gates;
+            public_inputs = std::move(other.public_inputs);
+            variables = std::move(other.variables);
+            variable_names = std::move(other.variable_names);
+            next_var_index = std::move(other.next_var_index);
+            prev_var_index = std::move(other.prev_var_index);
+            real_variable_index = std::move(other.real_variable_index);
+            real_variable_tags = std::move(other.real_variable_tags);
+            current_tag = other.current_tag;
+            tau = std::move(other.tau);
+            recursive_proof_public_input_indices = std::move(other.recursive_proof_public_input_indices);
+            contains_recursive_proof = other.contains_recursive_proof;
+            arena = std::exchange(other.arena, std::make_shared<barretenberg::MemoryArena>());
+            _failed = other._failed;
+            _err = std::move(other._err);
+            zero_idx = other.zero_idx;
+            one_idx = other.one_idx;
+        }
+        return *this;
+    }
     virtual ~CircuitBuilderBase() = default;
 
     virtual size_t get_num_gates() const { return num_gates; }
@@ -211,7 +297,7 @@ template <typename FF_> class CircuitBuilderBase {
 
         if (variable_names.contains(first_idx)) {
             if (cur_idx != REAL_VARIABLE) {
-                variable_names.extract(cur_idx);
+                variable_names.erase(cur_idx);
             }
             return;
         }
@@ -322,13 +408,13 @@ template <typename FF_> class CircuitBuilderBase {
     // This implicitly checks whether a variable index
     // is equal to IS_CONSTANT; assuming that we will never have
     // uint32::MAX number of variables
-    void assert_valid_variables(const std::vector<uint32_t>& variable_indices)
+    void assert_valid_variables(const std::vector<uint32_t>& variable_indices) const
     {
         for (const auto& variable_index : variable_indices) {
             ASSERT(is_valid_variable(variable_index));
         }
     }
-    bool is_valid_variable(uint32_t variable_index) { return variable_index < variables.size(); };
+    bool is_valid_variable(uint32_t variable_index) const { return variable_index < variables.size(); };
 
     /**
      * @brief Add information about which witnesses contain the recursive proof computation information
@@ -4,6 +4,7 @@
 #include "./msm_builder.hpp"
 #include "./precomputed_tables_builder.hpp"
 #include "./transcript_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/flavor/ecc_vm.hpp"
@@ -63,62 +64,109 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         return num_muls;
     }
 
-    std::vector<MSM> get_msms() const
+    /**
+     * For input point [P], return { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P] }, given the projective form of
+     * [P], 3[P], ..., 15[P] normalized to Z = 1
+     */
+    static std::array<AffineElement, POINT_TABLE_SIZE> compute_precomputed_table(const AffineElement& base_point,
+                                                                                 const Element* odd_multiples)
     {
-        const uint32_t num_muls = get_number_of_muls();
-        /**
-         * For input point [P], return { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P] }
-         */
-        const auto compute_precomputed_table = [](const AffineElement& base_point) {
-            const auto d2 = Element(base_point).dbl();
-            std::array<AffineElement, POINT_TABLE_SIZE> table;
-            table[POINT_TABLE_SIZE / 2] = base_point;
-            for (size_t i = 1; i < POINT_TABLE_SIZE / 2; ++i) {
-                table[i + POINT_TABLE_SIZE / 2] = Element(table[i + POINT_TABLE_SIZE / 2 - 1]) + d2;
+        std::array<AffineElement, POINT_TABLE_SIZE> table;
+        table[POINT_TABLE_SIZE / 2] = base_point;
+        for (size_t i = 1; i < POINT_TABLE_SIZE / 2; ++i) {
+            const Element& multiple = odd_multiples[i];
+            table[i + POINT_TABLE_SIZE / 2] =
+                multiple.is_point_at_infinity() ? AffineElement(multiple) : AffineElement(multiple.x, multiple.y);
+        }
+        for (size_t i = 0; i < POINT_TABLE_SIZE / 2; ++i) {
+            table[i] = -table[POINT_TABLE_SIZE - 1 - i];
+        }
+        return table;
+    }
+
+    static std::array<int, NUM_WNAF_SLICES> compute_wnaf_slices(uint256_t scalar)
+    {
+        std::array<int, NUM_WNAF_SLICES> output;
+        int previous_slice = 0;
+        for (size_t i = 0; i < NUM_WNAF_SLICES; ++i) {
+            // slice the scalar into 4-bit chunks, starting with the least significant bits
+            uint64_t raw_slice = static_cast<uint64_t>(scalar) & WNAF_MASK;
+
+            bool is_even = ((raw_slice & 1ULL) == 0ULL);
+
+            int wnaf_slice = static_cast<int>(raw_slice);
+
+            if (i == 0 && is_even) {
+                // if least significant slice is even, we add 1 to create an odd value && set 'skew' to true
+                wnaf_slice += 1;
+            } else if (is_even) {
+                // for other slices, if it's even, we add 1 to the slice value
+                // and subtract 16 from the previous slice to preserve the total scalar sum
+                static constexpr int borrow_constant = static_cast<int>(1ULL << WNAF_SLICE_BITS);
+                previous_slice -= borrow_constant;
+                wnaf_slice += 1;
             }
-            for (size_t i = 0; i < POINT_TABLE_SIZE / 2; ++i) {
-                table[i] = -table[POINT_TABLE_SIZE - 1 - i];
+
+            if (i > 0) {
+                const size_t idx = i - 1;
+                output[NUM_WNAF_SLICES - idx - 1] = previous_slice;
             }
-            return table;
-        };
-        const auto compute_wnaf_slices = [](uint256_t scalar) {
-            std::array<int, NUM_WNAF_SLICES> output;
-            int previous_slice = 0;
-            for (size_t i = 0; i < NUM_WNAF_SLICES; ++i) {
-                // slice the scalar into 4-bit chunks, starting with the least significant bits
-                uint64_t raw_slice = static_cast<uint64_t>(scalar) & WNAF_MASK;
-
-                bool is_even = ((raw_slice & 1ULL) == 0ULL);
-
-                int wnaf_slice = static_cast<int>(raw_slice);
-
-                if (i == 0 && is_even) {
-                    // if least significant slice is even, we add 1 to create an odd value && set 'skew' to true
-                    wnaf_slice += 1;
-                } else if (is_even) {
-                    // for other slices, if it's even, we add 1 to the slice value
-                    // and subtract 16 from the previous slice to preserve the total scalar sum
-                    static constexpr int borrow_constant = static_cast<int>(1ULL << WNAF_SLICE_BITS);
-                    previous_slice -= borrow_constant;
-                    wnaf_slice += 1;
-                }
+            previous_slice = wnaf_slice;
 
-                if (i > 0) {
-                    const size_t idx = i - 1;
-                    output[NUM_WNAF_SLICES - idx - 1] = previous_slice;
-                }
-                previous_slice = wnaf_slice;
+            // downshift raw_slice by 4 bits
+            scalar = scalar >> WNAF_SLICE_BITS;
+        }
 
-                // downshift raw_slice by 4 bits
-                scalar = scalar >> WNAF_SLICE_BITS;
-            }
+        ASSERT(scalar == 0);
+
+        output[0] = previous_slice;
 
-            ASSERT(scalar == 0);
+        return output;
+    }
 
-            output[0] = previous_slice;
+    /**
+     * @brief Computes the WNAF slices and point tables of the scalar muls of the MSMs, in parallel. The odd multiples
+     * of the points of each thread are computed in projective form and converted to affine form with a single batched
+     * inversion.
+     */
+    static void compute_scalar_mul_tables(std::vector<MSM>& msms)
+    {
+        static constexpr size_t NUM_ODD_MULTIPLES = POINT_TABLE_SIZE / 2;
+        std::vector<ScalarMul*> muls;
+        for (auto& msm : msms) {
+            for (auto& mul : msm) {
+                muls.push_back(&mul);
+            }
+        }
+        const size_t num_muls = muls.size();
+        const size_t num_threads = std::max(std::min(get_num_cpus(), num_muls), size_t(1));
+        const size_t muls_per_thread = (num_muls + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * muls_per_thread, num_muls);
+            const size_t end = std::min(start + muls_per_thread, num_muls);
+
+            // [P], 3[P], ..., 15[P] for each point
+            std::vector<Element> odd_multiples((end - start) * NUM_ODD_MULTIPLES);
+            for (size_t i = start; i < end; ++i) {
+                Element* multiples = &odd_multiples[(i - start) * NUM_ODD_MULTIPLES];
+                const Element d2 = Element(muls[i]->base_point).dbl();
+                multiples[0] = muls[i]->base_point;
+                for (size_t j = 1; j < NUM_ODD_MULTIPLES; ++j) {
+                    multiples[j] = multiples[j - 1] + d2;
+                }
+                muls[i]->wnaf_slices = compute_wnaf_slices(muls[i]->scalar);
+            }
+            Element::batch_normalize(odd_multiples.data(), odd_multiples.size());
+            for (size_t i = start; i < end; ++i) {
+                muls[i]->precomputed_table =
+                    compute_precomputed_table(muls[i]->base_point, &odd_multiples[(i - start) * NUM_ODD_MULTIPLES]);
+            }
+        });
+    }
 
-            return output;
-        };
+    std::vector<MSM> get_msms() const
+    {
+        const uint32_t num_muls = get_number_of_muls();
         std::vector<MSM> msms;
         std::vector<ScalarMul> active_msm;
 
@@ -131,16 +179,16 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         // we create a discontinuity in pc values between the last transcript row and the following empty row)
         uint32_t pc = num_muls;
 
-        const auto process_mul = [&active_msm, &pc, &compute_wnaf_slices, &compute_precomputed_table](
-                                     const auto& scalar, const auto& base_point) {
+        // The WNAF slices and point tables are filled in afterwards, in parallel
+        const auto process_mul = [&active_msm, &pc](const auto& scalar, const auto& base_point) {
             if (scalar != 0) {
                 active_msm.push_back(ScalarMul{
                     .pc = pc,
                     .scalar = scalar,
                     .base_point = base_point,
-                    .wnaf_slices = compute_wnaf_slices(scalar),
+                    .wnaf_slices = {},
                     .wnaf_skew = (scalar & 1) == 0,
-                    .precomputed_table = compute_precomputed_table(base_point),
+                    .precomputed_table = {},
                 });
                 pc--;
             }
@@ -163,6 +211,7 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         }
 
         ASSERT(pc == 0);
+        compute_scalar_mul_tables(msms);
         return msms;
     }
 
@@ -340,15 +389,27 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         size_t num_rows_pow2 = 1UL << (num_rows_log2 + (1UL << num_rows_log2 == num_rows ? 0 : 1));
 
         AllPolynomials polys;
-        for (auto* poly : polys.pointer_view()) {
-            *poly = Polynomial(num_rows_pow2);
-        }
+        auto poly_pointers = polys.pointer_view();
+        parallel_for(poly_pointers.size(), [&](size_t i) { *poly_pointers[i] = Polynomial(num_rows_pow2); });
+
+        // The columns are filled in parallel, one block of rows per thread
+        const auto parallel_for_rows = [](const size_t num_rows_to_fill, const auto& fill_row) {
+            const size_t num_threads = std::max(std::min(get_num_cpus(), num_rows_to_fill), size_t(1));
+            const size_t rows_per_thread = (num_rows_to_fill + num_threads - 1) / num_threads;
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const size_t start = std::min(thread_idx * rows_per_thread, num_rows_to_fill);
+                const size_t end = std::min(start + rows_per_thread, num_rows_to_fill);
+                for (size_t i = start; i < end; ++i) {
+                    fill_row(i);
+                }
+            });
+        };
 
         polys.lagrange_first[0] = 1;
         polys.lagrange_second[1] = 1;
         polys.lagrange_last[polys.lagrange_last.size() - 1] = 1;
 
-        for (size_t i = 0; i < point_table_read_counts[0].size(); ++i) {
+        parallel_for_rows(point_table_read_counts[0].size(), [&](size_t i) {
             // Explanation of off-by-one offset
             // When computing the WNAF slice for a point at point counter value `pc` and a round index `round`, the row
             // number that computes the slice can be derived. This row number is then mapped to the index of
@@ -357,8 +418,8 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             // row in our WNAF columns that computes a slice for a given value of pc and round)
             polys.lookup_read_counts_0[i + 1] = point_table_read_counts[0][i];
             polys.lookup_read_counts_1[i + 1] = point_table_read_counts[1][i];
-        }
-        for (size_t i = 0; i < transcript_state.size(); ++i) {
+        });
+        parallel_for_rows(transcript_state.size(), [&](size_t i) {
             polys.transcript_accumulator_empty[i] = transcript_state[i].accumulator_empty;
             polys.transcript_add[i] = transcript_state[i].q_add;
             polys.transcript_mul[i] = transcript_state[i].q_mul;
@@ -379,7 +440,7 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             polys.transcript_msm_x[i] = transcript_state[i].msm_output_x;
             polys.transcript_msm_y[i] = transcript_state[i].msm_output_y;
             polys.transcript_collision_check[i] = transcript_state[i].collision_check;
-        }
+        });
 
         // TODO(@zac-williamson) if final opcode resets accumulator, all subsequent "is_accumulator_empty" row values
         // must be 1. Ideally we find a way to tweak this so that empty rows that do nothing have column values that are
@@ -389,7 +450,7 @@ template <typename Flavor> class ECCVMCircuitBuilder {
                 polys.transcript_accumulator_empty[i] = 1;
             }
         }
-        for (size_t i = 0; i < precompute_table_state.size(); ++i) {
+        parallel_for_rows(precompute_table_state.size(), [&](size_t i) {
             // first row is always an empty row (to accomodate shifted polynomials which must have 0 as 1st
             // coefficient). All other rows in the precompute_table_state represent active wnaf gates (i.e.
             // precompute_select = 1)
@@ -416,9 +477,9 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             polys.precompute_dy[i] = precompute_table_state[i].precompute_double.y;
             polys.precompute_tx[i] = precompute_table_state[i].precompute_accumulator.x;
             polys.precompute_ty[i] = precompute_table_state[i].precompute_accumulator.y;
-        }
+        });
 
-        for (size_t i = 0; i < msm_state.size(); ++i) {
+        parallel_for_rows(msm_state.size(), [&](size_t i) {
             polys.msm_transition[i] = static_cast<int>(msm_state[i].msm_transition);
             polys.msm_add[i] = static_cast<int>(msm_state[i].q_add);
             polys.msm_double[i] = static_cast<int>(msm_state[i].q_double);
@@ -453,33 +514,37 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             polys.msm_slice2[i] = msm_state[i].add_state[1].slice;
             polys.msm_slice3[i] = msm_state[i].add_state[2].slice;
             polys.msm_slice4[i] = msm_state[i].add_state[3].slice;
-        }
+        });
 
-        polys.transcript_mul_shift = Polynomial(polys.transcript_mul.shifted());
-        polys.transcript_msm_count_shift = Polynomial(polys.transcript_msm_count.shifted());
-        polys.transcript_accumulator_x_shift = Polynomial(polys.transcript_accumulator_x.shifted());
-        polys.transcript_accumulator_y_shift = Polynomial(polys.transcript_accumulator_y.shifted());
-        polys.precompute_scalar_sum_shift = Polynomial(polys.precompute_scalar_sum.shifted());
-        polys.precompute_s1hi_shift = Polynomial(polys.precompute_s1hi.shifted());
-        polys.precompute_dx_shift = Polynomial(polys.precompute_dx.shifted());
-        polys.precompute_dy_shift = Polynomial(polys.precompute_dy.shifted());
-        polys.precompute_tx_shift = Polynomial(polys.precompute_tx.shifted());
-        polys.precompute_ty_shift = Polynomial(polys.precompute_ty.shifted());
-        polys.msm_transition_shift = Polynomial(polys.msm_transition.shifted());
-        polys.msm_add_shift = Polynomial(polys.msm_add.shifted());
-        polys.msm_double_shift = Polynomial(polys.msm_double.shifted());
-        polys.msm_skew_shift = Polynomial(polys.msm_skew.shifted());
-        polys.msm_accumulator_x_shift = Polynomial(polys.msm_accumulator_x.shifted());
-        polys.msm_accumulator_y_shift = Polynomial(polys.msm_accumulator_y.shifted());
-        polys.msm_count_shift = Polynomial(polys.msm_count.shifted());
-        polys.msm_round_shift = Polynomial(polys.msm_round.shifted());
-        polys.msm_add1_shift = Polynomial(polys.msm_add1.shifted());
-        polys.msm_pc_shift = Polynomial(polys.msm_pc.shifted());
-        polys.precompute_pc_shift = Polynomial(polys.precompute_pc.shifted());
-        polys.transcript_pc_shift = Polynomial(polys.transcript_pc.shifted());
-        polys.precompute_round_shift = Polynomial(polys.precompute_round.shifted());
-        polys.transcript_accumulator_empty_shift = Polynomial(polys.transcript_accumulator_empty.shifted());
-        polys.precompute_select_shift = Polynomial(polys.precompute_select.shifted());
+        // The shifts are copies of the shifted polynomials
+        const std::vector<std::pair<Polynomial*, Polynomial*>> shifts = {
+            { &polys.transcript_mul_shift, &polys.transcript_mul },
+            { &polys.transcript_msm_count_shift, &polys.transcript_msm_count },
+            { &polys.transcript_accumulator_x_shift, &polys.transcript_accumulator_x },
+            { &polys.transcript_accumulator_y_shift, &polys.transcript_accumulator_y },
+            { &polys.precompute_scalar_sum_shift, &polys.precompute_scalar_sum },
+            { &polys.precompute_s1hi_shift, &polys.precompute_s1hi },
+            { &polys.precompute_dx_shift, &polys.precompute_dx },
+            { &polys.precompute_dy_shift, &polys.precompute_dy },
+            { &polys.precompute_tx_shift, &polys.precompute_tx },
+            { &polys.precompute_ty_shift, &polys.precompute_ty },
+            { &polys.msm_transition_shift, &polys.msm_transition },
+            { &polys.msm_add_shift, &polys.msm_add },
+            { &polys.msm_double_shift, &polys.msm_double },
+            { &polys.msm_skew_shift, &polys.msm_skew },
+            { &polys.msm_accumulator_x_shift, &polys.msm_accumulator_x },
+            { &polys.msm_accumulator_y_shift, &polys.msm_accumulator_y },
+            { &polys.msm_count_shift, &polys.msm_count },
+            { &polys.msm_round_shift, &polys.msm_round },
+            { &polys.msm_add1_shift, &polys.msm_add1 },
+            { &polys.msm_pc_shift, &polys.msm_pc },
+            { &polys.precompute_pc_shift, &polys.precompute_pc },
+            { &polys.transcript_pc_shift, &polys.transcript_pc },
+            { &polys.precompute_round_shift, &polys.precompute_round },
+            { &polys.transcript_accumulator_empty_shift, &polys.transcript_accumulator_empty },
+            { &polys.precompute_select_shift, &polys.precompute_select },
+        };
+        parallel_for(shifts.size(), [&](size_t i) { *shifts[i].first = Polynomial(shifts[i].second->shifted()); });
         return polys;
     }
 
@@ -568,24 +633,30 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         return result;
     }
 
+    /**
+     * @brief The number of rows of the ECCVM trace, counted from the op queue without computing the trace
+     */
     [[nodiscard]] size_t get_num_gates() const
     {
-        // TODO(@zac-williamson) once we have a stable base to work off of, optimize this method!
-        // (issue #2218)
-        const auto msms = get_msms();
-        const auto flattened_muls = get_flattened_scalar_muls(msms);
-
-        std::array<std::vector<size_t>, 2> point_table_read_counts;
-        const auto transcript_state =
-            ECCVMTranscriptBuilder<Flavor>::compute_transcript_state(op_queue->raw_ops, get_number_of_muls());
-        const auto precompute_table_state =
-            ECCVMPrecomputedTablesBuilder<Flavor>::compute_precompute_state(flattened_muls);
-        const auto msm_state =
-            ECCVMMSMMBuilder<Flavor>::compute_msm_state(msms, point_table_read_counts, get_number_of_muls());
-
-        const size_t msm_size = msm_state.size();
-        const size_t transcript_size = transcript_state.size();
-        const size_t precompute_table_size = precompute_table_state.size();
+        static constexpr size_t NUM_ROWS_PER_SCALAR_MUL = NUM_WNAF_SLICES / WNAF_SLICES_PER_ROW;
+
+        // Each of the transcript, precomputed table and MSM columns start with an empty row. The transcript and MSM
+        // columns end with a final row holding the state of the accumulator.
+        const size_t transcript_size = op_queue->raw_ops.size() + 2;
+        const size_t precompute_table_size = 1 + get_number_of_muls() * NUM_ROWS_PER_SCALAR_MUL;
+        size_t msm_size = 2;
+        size_t active_msm_size = 0;
+        for (auto& op : op_queue->raw_ops) {
+            if (op.mul) {
+                active_msm_size += static_cast<size_t>(op.z1 != 0) + static_cast<size_t>(op.z2 != 0);
+            } else if (active_msm_size > 0) {
+                msm_size += ECCVMMSMMBuilder<Flavor>::get_num_rows_of_msm(active_msm_size);
+                active_msm_size = 0;
+            }
+        }
+        if (active_msm_size > 0) {
+            msm_size += ECCVMMSMMBuilder<Flavor>::get_num_rows_of_msm(active_msm_size);
+        }
 
         const size_t num_rows = std::max(precompute_table_size, std::max(msm_size, transcript_size));
         return num_rows;
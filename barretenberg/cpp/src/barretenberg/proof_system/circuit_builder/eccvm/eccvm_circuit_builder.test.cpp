@@ -270,4 +270,40 @@ TYPED_TEST(ECCVMCircuitBuilderTests, MSM)
     bool result = circuit.check_circuit();
     EXPECT_EQ(result, true);
 }
-} // namespace eccvm_circuit_builder_tests
\ No newline at end of file
+
+TYPED_TEST(ECCVMCircuitBuilderTests, NumGatesMatchesTrace)
+{
+    using Flavor = TypeParam;
+    using G1 = typename Flavor::CycleGroup;
+    using Fr = typename G1::Fr;
+    proof_system::ECCVMCircuitBuilder<Flavor> circuit;
+
+    auto generators = G1::derive_generators("test generators", 3);
+    typename G1::element a = generators[0];
+    typename G1::element b = generators[1];
+    typename G1::element c = generators[2];
+    Fr x = Fr::random_element(&engine);
+
+    circuit.add_accumulate(a);
+    for (size_t i = 0; i < 5; ++i) {
+        circuit.mul_accumulate(b, x);
+    }
+    circuit.empty_row();
+    circuit.mul_accumulate(c, x);
+    circuit.add_accumulate(b);
+    circuit.mul_accumulate(a, x);
+
+    const auto msms = circuit.get_msms();
+    std::array<std::vector<size_t>, 2> point_table_read_counts;
+    const auto transcript_state = proof_system::ECCVMTranscriptBuilder<Flavor>::compute_transcript_state(
+        circuit.op_queue->raw_ops, circuit.get_number_of_muls());
+    const auto precompute_table_state = proof_system::ECCVMPrecomputedTablesBuilder<Flavor>::compute_precompute_state(
+        circuit.get_flattened_scalar_muls(msms));
+    const auto msm_state = proof_system::ECCVMMSMMBuilder<Flavor>::compute_msm_state(
+        msms, point_table_read_counts, circuit.get_number_of_muls());
+
+    EXPECT_EQ(circuit.get_num_gates(),
+              std::max({ transcript_state.size(), precompute_table_state.size(), msm_state.size() }));
+    EXPECT_EQ(circuit.check_circuit(), true);
+}
+} // namespace eccvm_circuit_builder_tests
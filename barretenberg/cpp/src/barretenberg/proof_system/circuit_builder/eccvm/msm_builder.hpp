@@ -3,6 +3,7 @@
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace proof_system {
 
@@ -42,6 +43,18 @@ template <typename Flavor> class ECCVMMSMMBuilder {
         FF accumulator_y = 0;
     };
 
+    static constexpr size_t NUM_ROUNDS = NUM_SCALAR_BITS / WNAF_SLICE_BITS;
+
+    /**
+     * @brief The number of rows of the MSM columns that an MSM of the given size takes: one row of additions per 4
+     * points in each round, a doubling row between rounds, and a final round of skew additions.
+     */
+    static size_t get_num_rows_of_msm(const size_t msm_size)
+    {
+        const size_t rows_per_round = (msm_size / ADDITIONS_PER_ROW) + (msm_size % ADDITIONS_PER_ROW != 0 ? 1 : 0);
+        return NUM_ROUNDS * rows_per_round + (NUM_ROUNDS - 1) + rows_per_round;
+    }
+
     /**
      * @brief Computes the row values for the Straus MSM columns of the ECCVM.
      *
@@ -100,28 +113,46 @@ template <typename Flavor> class ECCVMMSMMBuilder {
                 point_table_read_counts[column_index][pc_offset + 15 - static_cast<size_t>(slice_row)]++;
             }
         };
-        std::vector<MSMState> msm_state;
+        // The MSMs are independent of each other, other than through the accumulator value on the first row of each
+        // (which is the previous MSM's output), so their rows are computed in parallel at precomputed offsets, and the
+        // first rows are patched once every MSM's output is known. Each point has its own pc value, so the read
+        // counts of different MSMs are disjoint.
+        const size_t num_msms = msms.size();
+        std::vector<size_t> msm_row_offsets(num_msms);
+        std::vector<uint32_t> msm_pcs(num_msms);
         // start with empty row (shiftable polynomials must have 0 as first coefficient)
-        msm_state.emplace_back(MSMState{});
-        uint32_t pc = total_number_of_muls;
-        AffineElement accumulator = CycleGroup::affine_point_at_infinity;
+        size_t num_rows = 1;
+        uint32_t next_pc = total_number_of_muls;
+        for (size_t i = 0; i < num_msms; ++i) {
+            msm_row_offsets[i] = num_rows;
+            msm_pcs[i] = next_pc;
+            num_rows += get_num_rows_of_msm(msms[i].size());
+            next_pc -= static_cast<uint32_t>(msms[i].size());
+        }
+        std::vector<MSMState> msm_state(num_rows + 1);
+        std::vector<AffineElement> msm_outputs(num_msms);
 
-        for (const auto& msm : msms) {
+        const auto add_points = [](auto& P1, auto& P2, auto& lambda, auto& collision_inverse, bool predicate) {
+            collision_inverse = predicate ? (P2.x - P1.x).invert() : 0;
+            lambda = predicate ? (P2.y - P1.y) * collision_inverse : 0;
+            auto x3 = predicate ? lambda * lambda - (P2.x + P1.x) : P1.x;
+            auto y3 = predicate ? lambda * (P1.x - x3) - P1.y : P1.y;
+            return AffineElement(x3, y3);
+        };
+
+        parallel_for(num_msms, [&](size_t msm_index) {
+            const auto& msm = msms[msm_index];
             const size_t msm_size = msm.size();
+            const uint32_t pc = msm_pcs[msm_index];
+            size_t row_index = msm_row_offsets[msm_index];
 
             const size_t rows_per_round = (msm_size / ADDITIONS_PER_ROW) + (msm_size % ADDITIONS_PER_ROW != 0 ? 1 : 0);
-            static constexpr size_t num_rounds = NUM_SCALAR_BITS / WNAF_SLICE_BITS;
 
-            const auto add_points = [](auto& P1, auto& P2, auto& lambda, auto& collision_inverse, bool predicate) {
-                lambda = predicate ? (P2.y - P1.y) / (P2.x - P1.x) : 0;
-                collision_inverse = predicate ? (P2.x - P1.x).invert() : 0;
-                auto x3 = predicate ? lambda * lambda - (P2.x + P1.x) : P1.x;
-                auto y3 = predicate ? lambda * (P1.x - x3) - P1.y : P1.y;
-                return AffineElement(x3, y3);
-            };
-            for (size_t j = 0; j < num_rounds; ++j) {
+            // The accumulator is set to the first point of the MSM without reading its previous value
+            AffineElement accumulator = CycleGroup::affine_point_at_infinity;
+            for (size_t j = 0; j < NUM_ROUNDS; ++j) {
                 for (size_t k = 0; k < rows_per_round; ++k) {
-                    MSMState row;
+                    MSMState& row = msm_state[row_index++];
                     const size_t points_per_row =
                         (k + 1) * ADDITIONS_PER_ROW > msm_size ? msm_size % ADDITIONS_PER_ROW : ADDITIONS_PER_ROW;
                     const size_t idx = k * ADDITIONS_PER_ROW;
@@ -174,10 +205,9 @@ template <typename Flavor> class ECCVMMSMMBuilder {
                     row.accumulator_y = accumulator.is_point_at_infinity() ? 0 : accumulator.y;
                     row.pc = pc;
                     accumulator = acc;
-                    msm_state.push_back(row);
                 }
-                if (j < num_rounds - 1) {
-                    MSMState row;
+                if (j < NUM_ROUNDS - 1) {
+                    MSMState& row = msm_state[row_index++];
                     row.msm_transition = false;
                     row.msm_round = static_cast<uint32_t>(j + 1);
                     row.msm_size = static_cast<uint32_t>(msm_size);
@@ -202,12 +232,12 @@ template <typename Flavor> class ECCVMMSMMBuilder {
 
                     row.accumulator_x = accumulator.is_point_at_infinity() ? 0 : accumulator.x;
                     row.accumulator_y = accumulator.is_point_at_infinity() ? 0 : accumulator.y;
-                    accumulator = Element(accumulator).dbl().dbl().dbl().dbl();
+                    // The doubling row computes 16 * accumulator, so reuse its result rather than doubling again
+                    accumulator = accumulator.is_point_at_infinity() ? accumulator : AffineElement(dx, dy);
                     row.pc = pc;
-                    msm_state.push_back(row);
                 } else {
                     for (size_t k = 0; k < rows_per_round; ++k) {
-                        MSMState row;
+                        MSMState& row = msm_state[row_index++];
 
                         const size_t points_per_row =
                             (k + 1) * ADDITIONS_PER_ROW > msm_size ? msm_size % ADDITIONS_PER_ROW : ADDITIONS_PER_ROW;
@@ -246,22 +276,32 @@ template <typename Flavor> class ECCVMMSMMBuilder {
 
                         row.pc = pc;
                         accumulator = acc;
-                        msm_state.emplace_back(row);
                     }
                 }
             }
-            pc -= static_cast<uint32_t>(msm_size);
+#ifndef NDEBUG
             // Validate our computed accumulator matches the real MSM result!
             Element expected = CycleGroup::point_at_infinity;
             for (size_t i = 0; i < msm.size(); ++i) {
                 expected += (Element(msm[i].base_point) * msm[i].scalar);
             }
-            // Validate the accumulator is correct!
             ASSERT(accumulator == AffineElement(expected));
+#endif
+            msm_outputs[msm_index] = accumulator;
+        });
+
+        // The first row of each MSM holds the output of the previous one
+        for (size_t i = 1; i < num_msms; ++i) {
+            const AffineElement& previous_output = msm_outputs[i - 1];
+            MSMState& first_row = msm_state[msm_row_offsets[i]];
+            first_row.accumulator_x = previous_output.is_point_at_infinity() ? 0 : previous_output.x;
+            first_row.accumulator_y = previous_output.is_point_at_infinity() ? 0 : previous_output.y;
         }
+        const AffineElement accumulator =
+            num_msms > 0 ? msm_outputs[num_msms - 1] : AffineElement(CycleGroup::affine_point_at_infinity);
 
-        MSMState final_row;
-        final_row.pc = pc;
+        MSMState& final_row = msm_state[num_rows];
+        final_row.pc = next_pc;
         final_row.msm_transition = true;
         final_row.accumulator_x = accumulator.is_point_at_infinity() ? 0 : accumulator.x;
         final_row.accumulator_y = accumulator.is_point_at_infinity() ? 0 : accumulator.y;
@@ -275,7 +315,6 @@ template <typename Flavor> class ECCVMMSMMBuilder {
                                 typename MSMState::AddState{ false, 0, AffineElement{ 0, 0 }, 0, 0 },
                                 typename MSMState::AddState{ false, 0, AffineElement{ 0, 0 }, 0, 0 } };
 
-        msm_state.emplace_back(final_row);
         return msm_state;
     }
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace proof_system {
 
@@ -71,6 +72,22 @@ template <typename Flavor> class ECCVMTranscriptBuilder {
         };
         VMState updated_state;
 
+        // The scalar multiplications don't depend on the VM state, so they are computed up front in parallel, leaving
+        // only the additions into the accumulators to the serial walk over the operations below
+        const size_t num_operations = vm_operations.size();
+        std::vector<Element> mul_outputs(num_operations);
+        const size_t num_threads = std::max(std::min(get_num_cpus(), num_operations), size_t(1));
+        const size_t operations_per_thread = (num_operations + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * operations_per_thread, num_operations);
+            const size_t end = std::min(start + operations_per_thread, num_operations);
+            for (size_t i = start; i < end; ++i) {
+                if (vm_operations[i].mul) {
+                    mul_outputs[i] = Element(vm_operations[i].base_point) * vm_operations[i].mul_scalar_full;
+                }
+            }
+        });
+
         // add an empty row. 1st row all zeroes because of our shiftable polynomials
         transcript_state.emplace_back(TranscriptState{});
         for (size_t i = 0; i < vm_operations.size(); ++i) {
@@ -104,9 +121,8 @@ template <typename Flavor> class ECCVMTranscriptBuilder {
             updated_state.count = current_ongoing_msm ? state.count + num_muls : 0;
 
             if (current_msm) {
-                const auto P = typename CycleGroup::element(entry.base_point);
                 const auto R = typename CycleGroup::element(state.msm_accumulator);
-                updated_state.msm_accumulator = R + P * entry.mul_scalar_full;
+                updated_state.msm_accumulator = R + mul_outputs[i];
             }
 
             if (entry.mul && next_not_msm) {
@@ -159,11 +175,12 @@ template <typename Flavor> class ECCVMTranscriptBuilder {
                 ASSERT((row.msm_output_x != row.accumulator_x) &&
                        "eccvm: attempting msm. Result point x-coordinate matches accumulator x-coordinate.");
                 state.msm_accumulator = CycleGroup::affine_point_at_infinity;
-                row.collision_check = (row.msm_output_x - row.accumulator_x).invert();
+                // inverted with the other rows' below
+                row.collision_check = row.msm_output_x - row.accumulator_x;
             } else if (entry.add && !row.accumulator_empty) {
                 ASSERT((row.base_x != row.accumulator_x) &&
                        "eccvm: attempting to add points with matching x-coordinates");
-                row.collision_check = (row.base_x - row.accumulator_x).invert();
+                row.collision_check = row.base_x - row.accumulator_x;
             }
 
             state = updated_state;
@@ -181,6 +198,16 @@ template <typename Flavor> class ECCVMTranscriptBuilder {
         final_row.accumulator_empty = updated_state.is_accumulator_empty;
 
         transcript_state.push_back(final_row);
+
+        // Invert the collision checks with a single batched inversion. Rows without a check hold 0, which is skipped
+        std::vector<FF> collision_checks(transcript_state.size());
+        for (size_t i = 0; i < transcript_state.size(); ++i) {
+            collision_checks[i] = transcript_state[i].collision_check;
+        }
+        FF::batch_invert(collision_checks);
+        for (size_t i = 0; i < transcript_state.size(); ++i) {
+            transcript_state[i].collision_check = collision_checks[i];
+        }
         return transcript_state;
     }
 };
@@ -9,6 +9,7 @@
  *
  */
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/arena_allocator.hpp"
 #include "barretenberg/ecc/curves/bn254/fq.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
@@ -326,7 +327,9 @@ class GoblinTranslatorCircuitBuilder : public CircuitBuilderBase<barretenberg::f
     // The input we evaluate polynomials on
     Fq evaluation_input_x;
 
-    std::array<std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>, NUM_WIRES> wires;
+    using WireVector = std::vector<uint32_t, barretenberg::ContainerArenaAllocator<uint32_t>>;
+
+    std::array<WireVector, NUM_WIRES> wires;
 
     /**
      * @brief Construct a new Goblin Translator Circuit Builder object
@@ -344,6 +347,7 @@ class GoblinTranslatorCircuitBuilder : public CircuitBuilderBase<barretenberg::f
     {
         add_variable(Fr::zero());
         for (auto& wire : wires) {
+            wire = WireVector(barretenberg::ContainerArenaAllocator<uint32_t>(this->arena));
             wire.emplace_back(0);
         }
         num_gates++;
@@ -1,4 +1,6 @@
 #include "goblin_ultra_circuit_builder.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -60,8 +62,38 @@ template <typename FF> void GoblinUltraCircuitBuilder_<FF>::add_gates_to_ensure_
     this->q_lookup_type.emplace_back(0);
     this->q_elliptic.emplace_back(0);
     this->q_aux.emplace_back(0);
+    q_poseidon2_external.emplace_back(0);
+    q_poseidon2_internal.emplace_back(0);
 
     ++this->num_gates;
+
+    // Add one external and one internal Poseidon2 round, followed by the row holding the output of the latter, so that
+    // the Poseidon2 selectors are non-zero. Like the calldata read above, this adds to the size of every circuit: three
+    // rows and twelve variables
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    std::array<FF, 4> state{ FF(1), FF(2), FF(3), FF(4) };
+    std::array<uint32_t, 4> state_indices;
+    const auto add_state_variables = [&]() {
+        for (size_t i = 0; i < 4; ++i) {
+            state_indices[i] = this->add_variable(state[i]);
+        }
+    };
+    add_state_variables();
+    create_poseidon2_external_gate({ state_indices[0], state_indices[1], state_indices[2], state_indices[3], 0 });
+    Permutation::add_round_constants(state, Permutation::round_constants[0]);
+    Permutation::apply_sbox(state);
+    Permutation::matrix_multiplication_external(state);
+    add_state_variables();
+
+    const size_t internal_round_idx = Permutation::rounds_f / 2;
+    create_poseidon2_internal_gate(
+        { state_indices[0], state_indices[1], state_indices[2], state_indices[3], internal_round_idx });
+    state[0] += Permutation::round_constants[internal_round_idx][0];
+    Permutation::apply_single_sbox(state[0]);
+    Permutation::matrix_multiplication_internal(state);
+    add_state_variables();
+
+    this->create_dummy_constraints({ state_indices[0], state_indices[1], state_indices[2], state_indices[3] });
 }
 
 /**
@@ -197,5 +229,113 @@ template <typename FF> void GoblinUltraCircuitBuilder_<FF>::populate_ecc_op_wire
     num_ecc_op_gates += 2;
 };
 
+/**
+ * @brief Add a gate applying an external (full) round of the Poseidon2 permutation to the state in its wires
+ *
+ * @details The gate constrains the wires of the next row to hold the state leaving the round, so it must be followed
+ * by the gate of the next round or by a row holding the output of the permutation
+ *
+ * @param in Indices of the state variables and index of the round, which selects the round constants
+ */
+template <typename FF>
+void GoblinUltraCircuitBuilder_<FF>::create_poseidon2_external_gate(const poseidon2_external_gate_<FF>& in)
+{
+    const auto& round_constants = crypto::Poseidon2Bn254ScalarFieldParams::round_constants[in.round_idx];
+    this->w_l.emplace_back(in.a);
+    this->w_r.emplace_back(in.b);
+    this->w_o.emplace_back(in.c);
+    this->w_4.emplace_back(in.d);
+    this->q_m.emplace_back(0);
+    this->q_1.emplace_back(round_constants[0]);
+    this->q_2.emplace_back(round_constants[1]);
+    this->q_3.emplace_back(round_constants[2]);
+    this->q_c.emplace_back(0);
+    this->q_arith.emplace_back(0);
+    this->q_4.emplace_back(round_constants[3]);
+    this->q_sort.emplace_back(0);
+    this->q_lookup_type.emplace_back(0);
+    this->q_elliptic.emplace_back(0);
+    this->q_aux.emplace_back(0);
+    q_busread.emplace_back(0);
+    q_poseidon2_external.emplace_back(1);
+    q_poseidon2_internal.emplace_back(0);
+    ++this->num_gates;
+}
+
+/**
+ * @brief Add a gate applying an internal (partial) round of the Poseidon2 permutation to the state in its wires
+ *
+ * @details Only the first state element goes through the round constant and the S-box, so only q_1 is used. As for
+ * external rounds, the state leaving the round is read from the next row.
+ *
+ * @param in Indices of the state variables and index of the round, which selects the round constant
+ */
+template <typename FF>
+void GoblinUltraCircuitBuilder_<FF>::create_poseidon2_internal_gate(const poseidon2_internal_gate_<FF>& in)
+{
+    const auto& round_constants = crypto::Poseidon2Bn254ScalarFieldParams::round_constants[in.round_idx];
+    this->w_l.emplace_back(in.a);
+    this->w_r.emplace_back(in.b);
+    this->w_o.emplace_back(in.c);
+    this->w_4.emplace_back(in.d);
+    this->q_m.emplace_back(0);
+    this->q_1.emplace_back(round_constants[0]);
+    this->q_2.emplace_back(0);
+    this->q_3.emplace_back(0);
+    this->q_c.emplace_back(0);
+    this->q_arith.emplace_back(0);
+    this->q_4.emplace_back(0);
+    this->q_sort.emplace_back(0);
+    this->q_lookup_type.emplace_back(0);
+    this->q_elliptic.emplace_back(0);
+    this->q_aux.emplace_back(0);
+    q_busread.emplace_back(0);
+    q_poseidon2_external.emplace_back(0);
+    q_poseidon2_internal.emplace_back(1);
+    ++this->num_gates;
+}
+
+/**
+ * @brief Check the Poseidon2 round gates natively, then the rest of the circuit as an Ultra circuit
+ *
+ * @return true if the witness satisfies all the gates
+ */
+template <typename FF> bool GoblinUltraCircuitBuilder_<FF>::check_circuit()
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto get_row = [&](const size_t row) {
+        return std::array<FF, 4>{ this->get_variable(this->w_l[row]),
+                                  this->get_variable(this->w_r[row]),
+                                  this->get_variable(this->w_o[row]),
+                                  this->get_variable(this->w_4[row]) };
+    };
+    for (size_t i = 0; i < this->num_gates; ++i) {
+        const bool is_external = q_poseidon2_external[i] == FF(1);
+        const bool is_internal = q_poseidon2_internal[i] == FF(1);
+        if (!is_external && !is_internal) {
+            continue;
+        }
+        if (i + 1 == this->num_gates) {
+            info("Poseidon2 round gate ", i, " is not followed by its output row");
+            return false;
+        }
+        auto state = get_row(i);
+        if (is_external) {
+            Permutation::add_round_constants(state, { this->q_1[i], this->q_2[i], this->q_3[i], this->q_4[i] });
+            Permutation::apply_sbox(state);
+            Permutation::matrix_multiplication_external(state);
+        } else {
+            state[0] += this->q_1[i];
+            Permutation::apply_single_sbox(state[0]);
+            Permutation::matrix_multiplication_internal(state);
+        }
+        if (state != get_row(i + 1)) {
+            info("Poseidon2 ", is_external ? "external" : "internal", " round fails at gate ", i);
+            return false;
+        }
+    }
+    return UltraCircuitBuilder_<arithmetization::UltraHonk<FF>>::check_circuit();
+}
+
 template class GoblinUltraCircuitBuilder_<barretenberg::fr>;
 } // namespace proof_system
\ No newline at end of file
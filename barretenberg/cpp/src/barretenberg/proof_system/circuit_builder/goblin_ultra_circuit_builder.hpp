@@ -31,8 +31,8 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
     uint32_t mul_accum_op_idx;
     uint32_t equality_op_idx;
 
-    using WireVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
-    using SelectorVector = std::vector<FF, ContainerSlabAllocator<FF>>;
+    using WireVector = std::vector<uint32_t, ContainerArenaAllocator<uint32_t>>;
+    using SelectorVector = std::vector<FF, ContainerArenaAllocator<FF>>;
 
     // Wires storing ecc op queue data; values are indices into the variables array
     std::array<WireVector, arithmetization::UltraHonk<FF>::NUM_WIRES> ecc_op_wires;
@@ -43,6 +43,8 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
     WireVector& ecc_op_wire_4 = std::get<3>(ecc_op_wires);
 
     SelectorVector& q_busread = this->selectors.q_busread();
+    SelectorVector& q_poseidon2_external = this->selectors.q_poseidon2_external();
+    SelectorVector& q_poseidon2_internal = this->selectors.q_poseidon2_internal();
 
     // DataBus call/return data arrays
     std::vector<uint32_t> public_calldata;
@@ -54,6 +56,10 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
     ecc_op_tuple queue_ecc_mul_accum(const g1::affine_element& point, const FF& scalar);
     ecc_op_tuple queue_ecc_eq();
 
+    // Poseidon2 round gates
+    void create_poseidon2_external_gate(const poseidon2_external_gate_<FF>& in);
+    void create_poseidon2_internal_gate(const poseidon2_internal_gate_<FF>& in);
+
   private:
     void populate_ecc_op_wires(const ecc_op_tuple& in);
     ecc_op_tuple decompose_ecc_operands(uint32_t op, const g1::affine_element& point, const FF& scalar = FF::zero());
@@ -64,6 +70,9 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
         : UltraCircuitBuilder_<arithmetization::UltraHonk<FF>>(size_hint)
         , op_queue(op_queue_in)
     {
+        for (auto& wire : ecc_op_wires) {
+            wire = WireVector(ContainerArenaAllocator<uint32_t>(this->arena));
+        }
         // Set indices to constants corresponding to Goblin ECC op codes
         null_op_idx = this->zero_idx;
         add_accum_op_idx = this->put_constant_variable(FF(EccOpCode::ADD_ACCUM));
@@ -73,6 +82,10 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
     GoblinUltraCircuitBuilder_(std::shared_ptr<ECCOpQueue> op_queue_in)
         : GoblinUltraCircuitBuilder_(0, op_queue_in)
     {}
+    GoblinUltraCircuitBuilder_(const GoblinUltraCircuitBuilder_& other) = delete;
+    GoblinUltraCircuitBuilder_(GoblinUltraCircuitBuilder_&& other) = default;
+    GoblinUltraCircuitBuilder_& operator=(const GoblinUltraCircuitBuilder_& other) = delete;
+    ~GoblinUltraCircuitBuilder_() override = default;
 
     void finalize_circuit();
     void add_gates_to_ensure_all_polys_are_non_zero();
@@ -132,6 +145,8 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
         }
         public_calldata.emplace_back(witness_index);
     }
+
+    bool check_circuit() override;
 };
 extern template class GoblinUltraCircuitBuilder_<barretenberg::fr>;
 using GoblinUltraCircuitBuilder = GoblinUltraCircuitBuilder_<barretenberg::fr>;
@@ -107,4 +107,26 @@ TEST(UltraCircuitBuilder, GoblinEccOpQueueUltraOps)
     }
 }
 
-} // namespace proof_system
\ No newline at end of file
+
+/**
+ * @brief The Goblin gates that keep the polynomials non-zero: a calldata read and three Poseidon2 rows on top of the
+ * Ultra ones
+ */
+TEST(UltraCircuitBuilder, GoblinNonZeroPolynomialGates)
+{
+    using UltraBuilder = UltraCircuitBuilder_<arithmetization::UltraHonk<fr>>;
+    auto ultra_builder = GoblinUltraCircuitBuilder();
+    ultra_builder.UltraBuilder::add_gates_to_ensure_all_polys_are_non_zero();
+
+    auto builder = GoblinUltraCircuitBuilder();
+    builder.add_gates_to_ensure_all_polys_are_non_zero();
+
+    EXPECT_EQ(builder.num_gates, ultra_builder.num_gates + 4);
+    EXPECT_TRUE(builder.check_circuit());
+
+    // check_circuit is virtual, so the Poseidon2 rows are checked through a base reference too
+    builder.variables[builder.w_l[builder.num_gates - 1]] += 1;
+    UltraBuilder& base = builder;
+    EXPECT_FALSE(base.check_circuit());
+}
+} // namespace proof_system
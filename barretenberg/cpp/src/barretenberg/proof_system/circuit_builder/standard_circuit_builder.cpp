@@ -448,8 +448,8 @@ void StandardCircuitBuilder_<FF>::fix_witness(const uint32_t witness_index, cons
 
 template <typename FF> uint32_t StandardCircuitBuilder_<FF>::put_constant_variable(const FF& variable)
 {
-    if (constant_variable_indices.contains(variable)) {
-        return constant_variable_indices.at(variable);
+    if (const auto it = constant_variable_indices.find(variable); it != constant_variable_indices.end()) {
+        return it->second;
     } else {
 
         uint32_t variable_index = this->add_variable(variable);
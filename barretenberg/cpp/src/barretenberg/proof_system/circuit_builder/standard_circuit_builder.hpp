@@ -23,11 +23,11 @@ template <typename FF> class StandardCircuitBuilder_ : public CircuitBuilderBase
     static constexpr merkle::HashType merkle_hash_type = merkle::HashType::FIXED_BASE_PEDERSEN;
     static constexpr pedersen::CommitmentType commitment_type = pedersen::CommitmentType::FIXED_BASE_PEDERSEN;
 
-    std::array<std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>, NUM_WIRES> wires;
-    Arithmetization selectors;
+    using WireVector = std::vector<uint32_t, barretenberg::ContainerArenaAllocator<uint32_t>>;
+    using SelectorVector = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
-    using WireVector = std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>;
-    using SelectorVector = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+    std::array<WireVector, NUM_WIRES> wires;
+    Arithmetization selectors;
 
     WireVector& w_l = std::get<0>(wires);
     WireVector& w_r = std::get<1>(wires);
@@ -44,15 +44,16 @@ template <typename FF> class StandardCircuitBuilder_ : public CircuitBuilderBase
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
-    std::map<FF, uint32_t> constant_variable_indices;
+    barretenberg::FlatHashMap<FF, uint32_t> constant_variable_indices;
 
     StandardCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
     {
-        selectors.reserve(size_hint);
-        w_l.reserve(size_hint);
-        w_r.reserve(size_hint);
-        w_o.reserve(size_hint);
+        for (auto& wire : wires) {
+            wire = WireVector(barretenberg::ContainerArenaAllocator<uint32_t>(this->arena));
+        }
+        selectors.set_arena(this->arena);
+        reserve_gates(size_hint);
         // To effieciently constrain wires to zero, we set the first value of w_1 to be 0, and use copy constraints for
         // all future zero values.
         // (#216)(Adrian): This should be done in a constant way, maybe by initializing the constant_variable_indices
@@ -71,12 +72,29 @@ template <typename FF> class StandardCircuitBuilder_ : public CircuitBuilderBase
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
         constant_variable_indices = other.constant_variable_indices;
-        wires = other.wires;
-        selectors = other.selectors;
+        wires = std::move(other.wires);
+        selectors = std::move(other.selectors);
         return *this;
     };
     ~StandardCircuitBuilder_() override = default;
 
+    /**
+     * @brief Reserve storage for `num_gates` rows in every wire and selector, carved out of a single arena chunk
+     */
+    void reserve_gates(const size_t num_gates)
+    {
+        if (num_gates == 0) {
+            return;
+        }
+        constexpr size_t num_columns = NUM_WIRES + num_selectors;
+        constexpr size_t row_size = NUM_WIRES * sizeof(uint32_t) + num_selectors * sizeof(FF);
+        this->arena->reserve(num_gates * row_size + num_columns * barretenberg::MemoryArena::ALIGNMENT);
+        for (auto& wire : wires) {
+            wire.reserve(num_gates);
+        }
+        selectors.reserve(num_gates);
+    }
+
     void assert_equal_constant(uint32_t const a_idx, FF const& b, std::string const& msg = "assert equal constant");
 
     void create_add_gate(const add_triple_<FF>& in) override;
@@ -0,0 +1,73 @@
+#include "barretenberg/numeric/random/engine.hpp"
+#include "ultra_circuit_builder.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace proof_system;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+constexpr size_t ROM_SIZE = 1024;
+constexpr size_t LOOKUP_FREQUENCY = 8;
+
+/**
+ * @brief Construct a circuit with roughly 2^log2_num_gates gates that mixes arithmetic gates, range constraints,
+ * lookups and ROM reads, so that every part of check_circuit is exercised
+ */
+void generate_mixed_circuit(UltraCircuitBuilder& builder, const size_t log2_num_gates)
+{
+    const size_t target_num_gates = 1UL << log2_num_gates;
+
+    const size_t rom_id = builder.create_ROM_array(ROM_SIZE);
+    for (size_t i = 0; i < ROM_SIZE; ++i) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr(i)));
+    }
+
+    uint32_t a_idx = builder.add_variable(fr::random_element(&engine));
+    uint32_t b_idx = builder.add_variable(fr::random_element(&engine));
+    for (size_t i = 0; builder.num_gates < target_num_gates; ++i) {
+        const fr a = builder.get_variable(a_idx);
+        const fr b = builder.get_variable(b_idx);
+        const uint32_t c_idx = builder.add_variable(a * b);
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+        const uint32_t d_idx = builder.add_variable(a + builder.get_variable(c_idx));
+        builder.create_add_gate({ a_idx, c_idx, d_idx, 1, 1, -1, 0 });
+
+        const uint32_t range_idx = builder.add_variable(fr(i & 0xffff));
+        builder.create_range_constraint(range_idx, 16, "check_circuit bench range constraint");
+
+        builder.read_ROM_array(rom_id, builder.add_variable(fr(i % ROM_SIZE)));
+
+        if (i % LOOKUP_FREQUENCY == 0) {
+            const uint32_t left = engine.get_random_uint32();
+            const uint32_t right = engine.get_random_uint32();
+            const auto accumulators =
+                plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, fr(left), fr(right), true);
+            builder.create_gates_from_plookup_accumulators(plookup::MultiTableId::UINT32_XOR,
+                                                           accumulators,
+                                                           builder.add_variable(fr(left)),
+                                                           builder.add_variable(fr(right)));
+        }
+
+        a_idx = c_idx;
+        b_idx = d_idx;
+    }
+}
+} // namespace
+
+/**
+ * @brief Check a pre-constructed circuit. The circuit is left unfinalized by check_circuit, so the same builder can be
+ * checked on every iteration.
+ */
+void check_circuit(State& state) noexcept
+{
+    UltraCircuitBuilder builder;
+    generate_mixed_circuit(builder, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(builder.check_circuit());
+    }
+}
+BENCHMARK(check_circuit)->DenseRange(16, 20, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
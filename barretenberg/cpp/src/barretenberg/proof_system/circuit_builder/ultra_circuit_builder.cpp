@@ -6,7 +6,12 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include <atomic>
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -40,8 +45,15 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
      *
      * Therefore, we introduce a boolean flag `circuit_finalized` here. Once we add the rom and range gates,
      * our circuit is finalized, and we must not to execute these functions again.
+     *
+     * The process_* passes below run one after another: each appends variables, gates and tags to the builder, so
+     * the indices it assigns depend on the passes before it, and process_RAM_arrays adds range constraints on the
+     * timestamp deltas that process_range_lists then has to include. The parts that don't touch the builder, sorting
+     * the memory transcripts and range lists and deduplicating the non-native field multiplications, run concurrently
+     * in prepare_finalization() and prepare_range_list().
      */
     if (!circuit_finalized) {
+        prepare_finalization();
         process_non_native_field_multiplications();
         process_ROM_arrays();
         process_RAM_arrays();
@@ -50,6 +62,52 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     }
 }
 
+namespace {
+/**
+ * @brief Sort a memory transcript whose records may already be partially sorted, e.g. a transcript sorted in
+ * prepare_finalization() to which the initialization records of unset cells have since been appended
+ */
+template <typename Record> void sort_memory_records(std::vector<Record>& records)
+{
+    const auto unsorted_begin = std::is_sorted_until(records.begin(), records.end());
+#ifdef NO_TBB
+    std::sort(unsorted_begin, records.end());
+#else
+    std::sort(std::execution::par_unseq, unsorted_begin, records.end());
+#endif
+    std::inplace_merge(records.begin(), unsorted_begin, records.end());
+}
+} // namespace
+
+/**
+ * @brief Run the parts of the finalization passes that do not add variables or gates
+ *
+ * @details The non-native field multiplication cache and the ROM/RAM transcripts are independent of each other until
+ * their gates are appended, so they are deduplicated and sorted concurrently. The process_* passes then append the
+ * gates serially in a fixed order, which keeps the circuit identical to a fully serial finalization.
+ */
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::prepare_finalization()
+{
+    const size_t num_rom_arrays = rom_arrays.size();
+    const size_t num_tasks = 1 + num_rom_arrays + ram_arrays.size();
+    parallel_for(num_tasks, [&](size_t task) {
+        if (task == 0) {
+            for (auto& c : cached_partial_non_native_field_multiplications) {
+                for (size_t j = 0; j < 5; ++j) {
+                    c.a[j] = this->real_variable_index[c.a[j]];
+                    c.b[j] = this->real_variable_index[c.b[j]];
+                }
+            }
+            cached_partial_non_native_field_multiplication::deduplicate(
+                cached_partial_non_native_field_multiplications);
+        } else if (task <= num_rom_arrays) {
+            sort_memory_records(rom_arrays[task - 1].records);
+        } else {
+            sort_memory_records(ram_arrays[task - 1 - num_rom_arrays].records);
+        }
+    });
+}
+
 /**
  * @brief Ensure all polynomials have at least one non-zero coefficient to avoid commiting to the zero-polynomial
  *
@@ -567,8 +625,8 @@ void UltraCircuitBuilder_<Arithmetization>::fix_witness(const uint32_t witness_i
 template <typename Arithmetization>
 uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF& variable)
 {
-    if (constant_variable_indices.contains(variable)) {
-        return constant_variable_indices.at(variable);
+    if (const auto it = constant_variable_indices.find(variable); it != constant_variable_indices.end()) {
+        return it->second;
     } else {
         uint32_t variable_index = this->add_variable(variable);
         fix_witness(variable_index, variable);
@@ -801,7 +859,7 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
             this->failure(msg);
         }
     }
-    if (range_lists.count(target_range) == 0) {
+    if (!range_lists.contains(target_range)) {
         range_lists.insert({ target_range, create_range_list(target_range) });
     }
 
@@ -845,7 +903,13 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
     }
 }
 
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+/**
+ * @brief Deduplicate the variables of a range list and return their values in sorted order
+ *
+ * @details Does not modify the builder, so that the lists can be prepared concurrently
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::prepare_range_list(RangeList& list) const
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -878,6 +942,12 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 #else
     std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
 #endif
+    return sorted_list;
+}
+
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list, const std::vector<uint32_t>& sorted_list)
+{
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
     constexpr size_t gate_width = NUM_WIRES;
     size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
@@ -901,8 +971,26 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_lists()
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
+    // The iteration order of range_lists is unspecified, so process the lists in order of increasing range to keep the
+    // resulting circuit independent of the hash map layout
+    std::vector<uint64_t> target_ranges;
+    target_ranges.reserve(range_lists.size());
+    for (const auto& [target_range, list] : range_lists) {
+        target_ranges.emplace_back(target_range);
+    }
+    std::sort(target_ranges.begin(), target_ranges.end());
+
+    // Sorting the variables of each list doesn't depend on the other lists, so do it concurrently. The gates are then
+    // appended in order of increasing range.
+    std::vector<RangeList*> lists(target_ranges.size());
+    for (size_t i = 0; i < target_ranges.size(); ++i) {
+        lists[i] = &range_lists.at(target_ranges[i]);
+    }
+    std::vector<std::vector<uint32_t>> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = prepare_range_list(*lists[i]); });
+
+    for (size_t i = 0; i < lists.size(); ++i) {
+        process_range_list(*lists[i], sorted_lists[i]);
     }
 }
 
@@ -916,7 +1004,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
   *
   * create range constraint parameters: variable index && range size
   *
-  * std::map<uint64_t, RangeList> range_lists;
+  * FlatHashMap<uint64_t, RangeList> range_lists;
 */
 // Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checkj)
 template <typename Arithmetization>
@@ -1658,14 +1746,7 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<Arithmetization>::evaluate_non_nati
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::process_non_native_field_multiplications()
 {
-    for (size_t i = 0; i < cached_partial_non_native_field_multiplications.size(); ++i) {
-        auto& c = cached_partial_non_native_field_multiplications[i];
-        for (size_t j = 0; j < 5; ++j) {
-            c.a[j] = this->real_variable_index[c.a[j]];
-            c.b[j] = this->real_variable_index[c.b[j]];
-        }
-    }
-    cached_partial_non_native_field_multiplication::deduplicate(cached_partial_non_native_field_multiplications);
+    // The cache has been mapped to real variable indices and deduplicated in prepare_finalization()
 
     // iterate over the cached items and create constraints
     for (const auto& input : cached_partial_non_native_field_multiplications) {
@@ -2414,11 +2495,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    sort_memory_records(rom_array.records);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2502,11 +2579,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    sort_memory_records(ram_array.records);
 
     std::vector<RamRecord> sorted_ram_records;
 
@@ -3180,22 +3253,93 @@ inline typename Arithmetization::FF UltraCircuitBuilder_<Arithmetization>::compu
     return auxiliary_identity;
 }
 
+namespace {
+/**
+ * @brief Hash for (column_1, column_2, column_3) lookup table entries used to simulate lookups in check_circuit
+ */
+struct LookupEntryHash {
+    const barretenberg::fr mult_const = barretenberg::fr(uint256_t(0x1337, 0x1336, 0x1335, 0x1334));
+    const barretenberg::fr mc_sqr = mult_const.sqr();
+
+    size_t operator()(const std::array<barretenberg::fr, 3>& entry) const
+    {
+        return (size_t)((entry[0] + mult_const * entry[1] + mc_sqr * entry[2]).reduce_once().data[0]);
+    }
+};
+
+/**
+ * @brief The set of all entries of a basic lookup table
+ */
+struct LookupEntrySet {
+    std::unordered_set<std::array<barretenberg::fr, 3>, LookupEntryHash> entries;
+};
+
+/**
+ * @brief Get the set of entries of a basic lookup table, building it on first use
+ *
+ * @details The sets are built once per table and cached for the lifetime of the process (see
+ * plookup::BasicTableCache).
+ */
+std::shared_ptr<const LookupEntrySet> get_lookup_entry_set(const plookup::BasicTable& table)
+{
+    static plookup::BasicTableCache<LookupEntrySet> cache;
+
+    return cache.get(table, [](const plookup::BasicTable& table) {
+        LookupEntrySet entry_set;
+        entry_set.entries.reserve(table.size);
+        for (size_t i = 0; i < table.size; ++i) {
+            entry_set.entries.insert({ table.column_1[i], table.column_2[i], table.column_3[i] });
+        }
+        return entry_set;
+    });
+}
+} // namespace
+
 /**
  * @brief Check that the circuit is correct in its current state
  *
- * @details The method switches the circuit to the "in-the-head" version, finalizes it, checks gates, lookups and
- * permutations and then switches it back from the in-the-head version, discarding the updates
+ * @details The builder itself is left untouched: an unfinalized circuit is finalized in a separate builder that holds
+ * only the finalization gates and the variables, and the gates of both are checked together.
  *
  * @return true
  * @return false
  */
 template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::check_circuit()
+{
+    if (circuit_finalized) {
+        return check_finalized_circuit(*this);
+    }
+    UltraCircuitBuilder_ finalization(*this, FinalizationOf{});
+    finalization.finalize_circuit();
+    return finalization.check_finalized_circuit(*this);
+}
+
+/**
+ * @details Gate and lookup checks are independent across rows, so they are split into contiguous chunks that are
+ * checked in parallel; the earliest failing gate is reported. The tag check walks the wires once to find the first
+ * occurrence of every tagged variable and then accumulates the tag products in parallel.
+ *
+ * @return true
+ * @return false
+ */
+template <typename Arithmetization>
+bool UltraCircuitBuilder_<Arithmetization>::check_finalized_circuit(const UltraCircuitBuilder_& circuit)
 {
     bool result = true;
-    CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
-    // Finalize circuit-in-the-head
+    const size_t num_gates = this->num_gates;
 
-    finalize_circuit();
+    // Gates below num_circuit_gates are read from the circuit, and the rest from this builder's columns
+    struct GateRow {
+        const UltraCircuitBuilder_& builder;
+        size_t row;
+    };
+    const size_t num_circuit_gates = &circuit == this ? 0 : circuit.num_gates;
+    auto gate_row = [&](const size_t gate_idx) {
+        if (gate_idx < num_circuit_gates) {
+            return GateRow{ circuit, gate_idx };
+        }
+        return GateRow{ *this, gate_idx - num_circuit_gates };
+    };
 
     // Sample randomness
     const FF arithmetic_base = FF::random_element();
@@ -3204,155 +3348,67 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
     const FF auxillary_base = FF::random_element();
     const FF alpha = FF::random_element();
     const FF eta = FF::random_element();
+    // Randomness for the tag check
+    const FF tag_gamma = FF::random_element();
 
-    // We need to get all memory
-    std::unordered_set<size_t> memory_read_record_gates;
-    std::unordered_set<size_t> memory_write_record_gates;
+    // Mark the gates that hold memory records. There is an extra slot so that the shifted gate can always be queried
+    enum MemoryRecordType : uint8_t { NO_RECORD, READ_RECORD, WRITE_RECORD };
+    std::vector<uint8_t> memory_record_types(num_gates + 1, NO_RECORD);
     for (const auto& gate_idx : memory_read_records) {
-        memory_read_record_gates.insert(gate_idx);
+        memory_record_types[gate_idx] = READ_RECORD;
     }
     for (const auto& gate_idx : memory_write_records) {
-        memory_write_record_gates.insert(gate_idx);
-    }
-
-    // A hashing implementation for quick simulation lookups
-    struct HashFrTuple {
-        const FF mult_const = FF(uint256_t(0x1337, 0x1336, 0x1335, 0x1334));
-        const FF mc_sqr = mult_const.sqr();
-        const FF mc_cube = mult_const * mc_sqr;
-
-        size_t operator()(const std::tuple<FF, FF, FF, FF>& entry) const
-        {
-            return (size_t)((std::get<0>(entry) + mult_const * std::get<1>(entry) + mc_sqr * std::get<2>(entry) +
-                             mc_cube * std::get<3>(entry))
-                                .reduce_once()
-                                .data[0]);
+        memory_record_types[gate_idx] = WRITE_RECORD;
+    }
+    // If we are touching a gate with memory access, we need to update the value of the 4th witness
+    auto compute_w_4_value = [&](const size_t gate_idx, const FF& w_1, const FF& w_2, const FF& w_3, const FF& w_4) {
+        switch (memory_record_types[gate_idx]) {
+        case READ_RECORD:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta;
+        case WRITE_RECORD:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta + FF::one();
+        default:
+            return w_4;
         }
     };
 
-    // Equality checks for lookup tuples
-    struct EqualFrTuple {
-
-        bool operator()(const std::tuple<FF, FF, FF, FF>& entry1, const std::tuple<FF, FF, FF, FF>& entry2) const
-        {
-            return entry1 == entry2;
-        }
-    };
-    // The set of all lookup tuples that are in the tables
-    std::unordered_set<std::tuple<FF, FF, FF, FF>, HashFrTuple, EqualFrTuple> table_hash;
-    // Prepare the lookup set for use in the circuit
-    for (auto& table : lookup_tables) {
-        const FF table_index(table.table_index);
-        for (size_t i = 0; i < table.size; ++i) {
-            const auto components =
-                std::make_tuple(table.column_1[i], table.column_2[i], table.column_3[i], table_index);
-            table_hash.insert(components);
-        }
-    }
-
-    // We use a running tag product mechanism to ensure tag correctness
-    // This is the product of (value + γ ⋅ tag)
-    FF left_tag_product = FF::one();
-    // This is the product of (value + γ ⋅ tau[tag])
-    FF right_tag_product = FF::one();
-    // Randomness for the tag check
-    const FF tag_gamma = FF::random_element();
-    // We need to include each variable only once
-    std::unordered_set<size_t> encountered_variables;
-
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_information = [&](size_t variable_index, FF value) {
-        size_t real_index = this->real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (encountered_variables.contains(real_index)) {
-            return;
+    // The lookup tables are addressed by their table index, which is stored in q_3 of every lookup gate
+    std::vector<std::shared_ptr<const LookupEntrySet>> table_entry_sets;
+    for (const auto& table : circuit.lookup_tables) {
+        if (table.table_index >= table_entry_sets.size()) {
+            table_entry_sets.resize(table.table_index + 1);
         }
-        size_t tag_in = this->real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            size_t tag_out = this->tau.at((uint32_t)tag_in);
-            left_tag_product *= value + tag_gamma * FF(tag_in);
-            right_tag_product *= value + tag_gamma * FF(tag_out);
-            encountered_variables.insert(real_index);
+        table_entry_sets[table.table_index] = get_lookup_entry_set(table);
+    }
+
+    enum GateFailure : uint8_t { NO_FAILURE, ARITHMETIC, AUXILIARY, ELLIPTIC, GENPERM_SORT, LOOKUP };
+    auto check_gate = [&](const size_t i) {
+        const auto [gate, row] = gate_row(i);
+        const FF w_1_value = this->get_variable(gate.w_l[row]);
+        const FF w_2_value = this->get_variable(gate.w_r[row]);
+        const FF w_3_value = this->get_variable(gate.w_o[row]);
+        const FF w_4_value = compute_w_4_value(i, w_1_value, w_2_value, w_3_value, this->get_variable(gate.w_4[row]));
+        FF w_1_shifted_value = FF::zero();
+        FF w_2_shifted_value = FF::zero();
+        FF w_3_shifted_value = FF::zero();
+        FF w_4_shifted_value = FF::zero();
+        if (i < (num_gates - 1)) {
+            const auto [next_gate, next_row] = gate_row(i + 1);
+            w_1_shifted_value = this->get_variable(next_gate.w_l[next_row]);
+            w_2_shifted_value = this->get_variable(next_gate.w_r[next_row]);
+            w_3_shifted_value = this->get_variable(next_gate.w_o[next_row]);
+            w_4_shifted_value = this->get_variable(next_gate.w_4[next_row]);
         }
-    };
-    // For each gate
-    for (size_t i = 0; i < this->num_gates; i++) {
-        FF q_arith_value;
-        FF q_aux_value;
-        FF q_elliptic_value;
-        FF q_sort_value;
-        FF q_lookup_type_value;
-        FF q_1_value;
-        FF q_2_value;
-        FF q_3_value;
-        FF q_4_value;
-        FF q_m_value;
-        FF q_c_value;
-        FF w_1_value;
-        FF w_2_value;
-        FF w_3_value;
-        FF w_4_value;
-        FF w_4_index;
-        // Get the values of selectors and wires and update tag products along the way
-        q_arith_value = q_arith[i];
-        q_aux_value = q_aux[i];
-        q_elliptic_value = q_elliptic[i];
-        q_sort_value = q_sort[i];
-        q_lookup_type_value = q_lookup_type[i];
-        q_1_value = q_1[i];
-        q_2_value = q_2[i];
-        q_3_value = q_3[i];
-        q_4_value = q_4[i];
-        q_m_value = q_m[i];
-        q_c_value = q_c[i];
-        w_1_value = this->get_variable(w_l[i]);
-        update_tag_check_information(w_l[i], w_1_value);
-        w_2_value = this->get_variable(w_r[i]);
-        update_tag_check_information(w_r[i], w_2_value);
-        w_3_value = this->get_variable(w_o[i]);
-        update_tag_check_information(w_o[i], w_3_value);
-        w_4_value = this->get_variable(w_4[i]);
-        // We need to wait before updating tag product for w_4
-        w_4_index = w_4[i];
-
-        // If we are touching a gate with memory access, we need to update the value of the 4th witness
-        if (memory_read_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta + FF::one();
-        }
-        // Now we can update the tag product for w_4
-        update_tag_check_information((uint32_t)w_4_index, w_4_value);
-        FF w_1_shifted_value;
-        FF w_2_shifted_value;
-        FF w_3_shifted_value;
-        FF w_4_shifted_value;
-        if (i < (this->num_gates - 1)) {
-            w_1_shifted_value = this->get_variable(w_l[i + 1]);
-            w_2_shifted_value = this->get_variable(w_r[i + 1]);
-            w_3_shifted_value = this->get_variable(w_o[i + 1]);
-            w_4_shifted_value = this->get_variable(w_4[i + 1]);
-        } else {
-            w_1_shifted_value = FF::zero();
-            w_2_shifted_value = FF::zero();
-            w_3_shifted_value = FF::zero();
-            w_4_shifted_value = FF::zero();
-        }
-        if (memory_read_record_gates.contains(i + 1)) {
-            w_4_shifted_value = ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i + 1)) {
-            w_4_shifted_value =
-                ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta + FF::one();
-        }
-        if (!compute_arithmetic_identity(q_arith_value,
-                                         q_1_value,
-                                         q_2_value,
-                                         q_3_value,
-                                         q_4_value,
-                                         q_m_value,
-                                         q_c_value,
+        w_4_shifted_value =
+            compute_w_4_value(i + 1, w_1_shifted_value, w_2_shifted_value, w_3_shifted_value, w_4_shifted_value);
+
+        if (!compute_arithmetic_identity(gate.q_arith[row],
+                                         gate.q_1[row],
+                                         gate.q_2[row],
+                                         gate.q_3[row],
+                                         gate.q_4[row],
+                                         gate.q_m[row],
+                                         gate.q_c[row],
                                          w_1_value,
                                          w_2_value,
                                          w_3_value,
@@ -3362,20 +3418,16 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                          arithmetic_base,
                                          alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Arithemtic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return ARITHMETIC;
         }
-        if (!compute_auxilary_identity(q_aux_value,
-                                       q_arith_value,
-                                       q_1_value,
-                                       q_2_value,
-                                       q_3_value,
-                                       q_4_value,
-                                       q_m_value,
-                                       q_c_value,
+        if (!compute_auxilary_identity(gate.q_aux[row],
+                                       gate.q_arith[row],
+                                       gate.q_1[row],
+                                       gate.q_2[row],
+                                       gate.q_3[row],
+                                       gate.q_4[row],
+                                       gate.q_m[row],
+                                       gate.q_c[row],
                                        w_1_value,
                                        w_2_value,
                                        w_3_value,
@@ -3388,16 +3440,11 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                        alpha,
                                        eta)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Auxilary identity fails at gate ", i);
-#endif
-
-            result = false;
-            break;
+            return AUXILIARY;
         }
-        if (!compute_elliptic_identity(q_elliptic_value,
-                                       q_1_value,
-                                       q_m_value,
+        if (!compute_elliptic_identity(gate.q_elliptic[row],
+                                       gate.q_1[row],
+                                       gate.q_m[row],
                                        w_2_value,
                                        w_3_value,
                                        w_1_shifted_value,
@@ -3407,35 +3454,139 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
                                        elliptic_base,
                                        alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Elliptic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return ELLIPTIC;
         }
-        if (!compute_genperm_sort_identity(
-                 q_sort_value, w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
+        if (!compute_genperm_sort_identity(gate.q_sort[row],
+                                           w_1_value,
+                                           w_2_value,
+                                           w_3_value,
+                                           w_4_value,
+                                           w_1_shifted_value,
+                                           genperm_sort_base,
+                                           alpha)
                  .is_zero()) {
+            return GENPERM_SORT;
+        }
+        if (!gate.q_lookup_type[row].is_zero()) {
+            const uint256_t table_index(gate.q_3[row]);
+            if (table_index >= table_entry_sets.size() || table_entry_sets[(size_t)table_index] == nullptr) {
+                return LOOKUP;
+            }
+            const std::array<FF, 3> entry{ w_1_value + gate.q_2[row] * w_1_shifted_value,
+                                           w_2_value + gate.q_m[row] * w_2_shifted_value,
+                                           w_3_value + gate.q_c[row] * w_3_shifted_value };
+            if (!table_entry_sets[(size_t)table_index]->entries.contains(entry)) {
+                return LOOKUP;
+            }
+        }
+        return NO_FAILURE;
+    };
+
+    // Check the gates in parallel chunks. Chunks stop early once a failure has been found before their position
+    constexpr size_t MIN_GATES_PER_THREAD = 1 << 10;
+    const size_t num_threads = thread_utils::calculate_num_threads(num_gates, MIN_GATES_PER_THREAD);
+    const size_t gates_per_thread = (num_gates + num_threads - 1) / num_threads;
+    std::atomic<size_t> first_failing_gate = num_gates;
+    std::vector<GateFailure> thread_failures(num_threads, NO_FAILURE);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * gates_per_thread;
+        const size_t end = std::min(start + gates_per_thread, num_gates);
+        for (size_t i = start; i < end; ++i) {
+            if (first_failing_gate.load(std::memory_order_relaxed) < i) {
+                return;
+            }
+            const GateFailure failure = check_gate(i);
+            if (failure != NO_FAILURE) {
+                thread_failures[thread_idx] = failure;
+                size_t current = first_failing_gate.load();
+                while (i < current && !first_failing_gate.compare_exchange_weak(current, i)) {
+                }
+                return;
+            }
+        }
+    });
+
+    if (first_failing_gate < num_gates) {
+        result = false;
 #ifndef FUZZING
+        const size_t i = first_failing_gate;
+        switch (thread_failures[i / gates_per_thread]) {
+        case ARITHMETIC:
+            info("Arithemtic identity fails at gate ", i);
+            break;
+        case AUXILIARY:
+            info("Auxilary identity fails at gate ", i);
+            break;
+        case ELLIPTIC:
+            info("Elliptic identity fails at gate ", i);
+            break;
+        case GENPERM_SORT:
             info("Genperm sort identity fails at gate ", i);
-#endif
-
-            result = false;
+            break;
+        default:
+            info("Lookup fails at gate ", i);
             break;
         }
-        if (!q_lookup_type_value.is_zero()) {
-            if (!table_hash.contains(std::make_tuple(w_1_value + q_2_value * w_1_shifted_value,
-                                                     w_2_value + q_m_value * w_2_shifted_value,
-                                                     w_3_value + q_c_value * w_3_shifted_value,
-                                                     q_3_value))) {
-#ifndef FUZZING
-                info("Lookup fails at gate ", i);
 #endif
+    }
+
+    // We use a running tag product mechanism to ensure tag correctness
+    // Each variable is included only once, with the value it has at its first occurrence in the wires
+    struct TagCheckEntry {
+        uint32_t gate_idx;
+        uint32_t wire_idx;
+        uint32_t tag_in;
+        uint32_t tag_out;
+    };
+    std::vector<TagCheckEntry> tag_check_entries;
+    std::vector<bool> encountered_variables(this->variables.size(), false);
+    for (size_t i = 0; i < num_gates; ++i) {
+        const auto [gate, row] = gate_row(i);
+        for (size_t j = 0; j < NUM_WIRES; ++j) {
+            const uint32_t real_index = this->real_variable_index[gate.wires[j][row]];
+            if (encountered_variables[real_index]) {
+                continue;
+            }
+            const uint32_t tag_in = this->real_variable_tags[real_index];
+            if (tag_in != DUMMY_TAG) {
+                tag_check_entries.push_back({ static_cast<uint32_t>(i),
+                                              static_cast<uint32_t>(j),
+                                              tag_in,
+                                              this->tau.at(tag_in) });
+                encountered_variables[real_index] = true;
+            }
+        }
+    }
 
-                result = false;
-                break;
+    // Compute the products of (value + γ ⋅ tag) and (value + γ ⋅ tau[tag]) in parallel
+    const size_t num_entries = tag_check_entries.size();
+    const size_t num_tag_threads = thread_utils::calculate_num_threads(num_entries, MIN_GATES_PER_THREAD);
+    const size_t entries_per_thread = (num_entries + num_tag_threads - 1) / num_tag_threads;
+    std::vector<FF> left_tag_products(num_tag_threads, FF::one());
+    std::vector<FF> right_tag_products(num_tag_threads, FF::one());
+    parallel_for(num_tag_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * entries_per_thread;
+        const size_t end = std::min(start + entries_per_thread, num_entries);
+        for (size_t k = start; k < end; ++k) {
+            const auto& entry = tag_check_entries[k];
+            const auto [gate, row] = gate_row(entry.gate_idx);
+            FF value = this->get_variable(gate.wires[entry.wire_idx][row]);
+            if (entry.wire_idx == NUM_WIRES - 1) {
+                value = compute_w_4_value(entry.gate_idx,
+                                          this->get_variable(gate.w_l[row]),
+                                          this->get_variable(gate.w_r[row]),
+                                          this->get_variable(gate.w_o[row]),
+                                          value);
             }
+            left_tag_products[thread_idx] *= value + tag_gamma * FF(entry.tag_in);
+            right_tag_products[thread_idx] *= value + tag_gamma * FF(entry.tag_out);
         }
+    });
+    FF left_tag_product = FF::one();
+    FF right_tag_product = FF::one();
+    for (size_t j = 0; j < num_tag_threads; ++j) {
+        left_tag_product *= left_tag_products[j];
+        right_tag_product *= right_tag_products[j];
     }
     if (left_tag_product != right_tag_product) {
 #ifndef FUZZING
@@ -3446,7 +3597,6 @@ template <typename Arithmetization> bool UltraCircuitBuilder_<Arithmetization>::
 
         result = false;
     }
-    circuit_backup.restore_prefinilized_state(this);
     return result;
 }
 template class UltraCircuitBuilder_<arithmetization::Ultra<barretenberg::fr>>;
@@ -95,7 +95,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         uint32_t index = 0;
         uint32_t record_witness = 0;
         size_t gate_index = 0;
-        bool operator<(const RomRecord& other) const { return index < other.index; }
+        // Reads of the same cell are ordered by gate index, so that sorting a transcript is deterministic
+        bool operator<(const RomRecord& other) const
+        {
+            return index < other.index || (index == other.index && gate_index < other.gate_index);
+        }
         bool operator==(const RomRecord& other) const noexcept
         {
             return index_witness == other.index_witness && value_column1_witness == other.value_column1_witness &&
@@ -271,16 +275,15 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     };
 
     /**
-     * @brief CircuitDataBackup is a structure we use to store all the information about the circuit that is needed
-     * to restore it back to a pre-finalized state
+     * @brief CircuitDataBackup is a structure we use to store all the logic-related information about the circuit
      * @details In check_circuit method in UltraCircuitBuilder we want to check that the whole circuit works,
      * but ultra circuits need to have ram, rom and range gates added in the end for the check to be complete as
-     * well as the set permutation check, so we finalize the circuit when we check it. This structure allows us to
-     * restore the circuit to the state before the finalization.
+     * well as the set permutation check, so check_circuit finalizes the circuit on the side. The tests use this
+     * structure to ensure that the builder itself is left as it was.
      */
     struct CircuitDataBackup {
-        using WireVector = std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>;
-        using SelectorVector = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+        using WireVector = std::vector<uint32_t, barretenberg::ContainerArenaAllocator<uint32_t>>;
+        using SelectorVector = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
         std::vector<uint32_t> public_inputs;
         std::vector<FF> variables;
@@ -291,7 +294,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         // indices of corresponding real variables
         std::vector<uint32_t> real_variable_index;
         std::vector<uint32_t> real_variable_tags;
-        std::map<FF, uint32_t> constant_variable_indices;
+        barretenberg::FlatHashMap<FF, uint32_t> constant_variable_indices;
         WireVector w_l;
         WireVector w_r;
         WireVector w_o;
@@ -308,20 +311,21 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         SelectorVector q_aux;
         SelectorVector q_lookup_type;
         uint32_t current_tag = DUMMY_TAG;
-        std::map<uint32_t, uint32_t> tau;
+        barretenberg::FlatHashMap<uint32_t, uint32_t> tau;
 
         std::vector<RamTranscript> ram_arrays;
         std::vector<RomTranscript> rom_arrays;
 
         std::vector<uint32_t> memory_read_records;
         std::vector<uint32_t> memory_write_records;
-        std::map<uint64_t, RangeList> range_lists;
+        barretenberg::FlatHashMap<uint64_t, RangeList> range_lists;
 
         std::vector<UltraCircuitBuilder_::cached_partial_non_native_field_multiplication>
             cached_partial_non_native_field_multiplications;
 
         size_t num_gates;
         bool circuit_finalized = false;
+
         /**
          * @brief Stores the state of everything logic-related in the builder.
          *
@@ -375,90 +379,6 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
             return stored_state;
         }
 
-        /**
-         * @brief Stores the state of all members of the circuit constructor that are needed to restore the state
-         * after finalizing the circuit.
-         *
-         * @param builder
-         * @return CircuitDataBackup
-         */
-        template <typename CircuitBuilder>
-        static CircuitDataBackup store_prefinilized_state(const CircuitBuilder* builder)
-        {
-            CircuitDataBackup stored_state;
-            stored_state.public_inputs = builder->public_inputs;
-            stored_state.variables = builder->variables;
-
-            stored_state.next_var_index = builder->next_var_index;
-
-            stored_state.prev_var_index = builder->prev_var_index;
-
-            stored_state.real_variable_index = builder->real_variable_index;
-            stored_state.real_variable_tags = builder->real_variable_tags;
-            stored_state.constant_variable_indices = builder->constant_variable_indices;
-            stored_state.current_tag = builder->current_tag;
-            stored_state.tau = builder->tau;
-
-            stored_state.ram_arrays = builder->ram_arrays;
-            stored_state.rom_arrays = builder->rom_arrays;
-
-            stored_state.memory_read_records = builder->memory_read_records;
-            stored_state.memory_write_records = builder->memory_write_records;
-            stored_state.range_lists = builder->range_lists;
-            stored_state.circuit_finalized = builder->circuit_finalized;
-            stored_state.num_gates = builder->num_gates;
-            stored_state.cached_partial_non_native_field_multiplications =
-                builder->cached_partial_non_native_field_multiplications;
-
-            return stored_state;
-        }
-
-        /**
-         * @brief Restores circuit constructor to a prefinilized state.
-         *
-         * @param builder
-         * @return CircuitDataBackup
-         */
-        template <typename CircuitBuilder> void restore_prefinilized_state(CircuitBuilder* builder)
-        {
-            builder->public_inputs = public_inputs;
-            builder->variables = variables;
-
-            builder->next_var_index = next_var_index;
-
-            builder->prev_var_index = prev_var_index;
-
-            builder->real_variable_index = real_variable_index;
-            builder->real_variable_tags = real_variable_tags;
-            builder->constant_variable_indices = constant_variable_indices;
-            builder->current_tag = current_tag;
-            builder->tau = tau;
-
-            builder->ram_arrays = ram_arrays;
-            builder->rom_arrays = rom_arrays;
-
-            builder->memory_read_records = memory_read_records;
-            builder->memory_write_records = memory_write_records;
-            builder->range_lists = range_lists;
-            builder->circuit_finalized = circuit_finalized;
-            builder->num_gates = num_gates;
-            builder->cached_partial_non_native_field_multiplications = cached_partial_non_native_field_multiplications;
-            builder->w_l.resize(num_gates);
-            builder->w_r.resize(num_gates);
-            builder->w_o.resize(num_gates);
-            builder->w_4.resize(num_gates);
-            builder->q_m.resize(num_gates);
-            builder->q_c.resize(num_gates);
-            builder->q_1.resize(num_gates);
-            builder->q_2.resize(num_gates);
-            builder->q_3.resize(num_gates);
-            builder->q_4.resize(num_gates);
-            builder->q_arith.resize(num_gates);
-            builder->q_sort.resize(num_gates);
-            builder->q_elliptic.resize(num_gates);
-            builder->q_aux.resize(num_gates);
-            builder->q_lookup_type.resize(num_gates);
-        }
         /**
          * @brief Checks that the circuit state is the same as the stored circuit's one
          *
@@ -569,11 +489,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         }
     };
 
-    std::array<std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>, NUM_WIRES> wires;
-    Arithmetization selectors;
+    using WireVector = std::vector<uint32_t, barretenberg::ContainerArenaAllocator<uint32_t>>;
+    using SelectorVector = std::vector<FF, barretenberg::ContainerArenaAllocator<FF>>;
 
-    using WireVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
-    using SelectorVector = std::vector<FF, ContainerSlabAllocator<FF>>;
+    std::array<WireVector, NUM_WIRES> wires;
+    Arithmetization selectors;
 
     WireVector& w_l = std::get<0>(wires);
     WireVector& w_r = std::get<1>(wires);
@@ -595,11 +515,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
-    std::map<FF, uint32_t> constant_variable_indices;
+    barretenberg::FlatHashMap<FF, uint32_t> constant_variable_indices;
 
     std::vector<plookup::BasicTable> lookup_tables;
     std::vector<plookup::MultiTable> lookup_multi_tables;
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    barretenberg::FlatHashMap<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -627,57 +547,127 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
 
     bool circuit_finalized = false;
 
+    void prepare_finalization();
     void process_non_native_field_multiplications();
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
     {
-        selectors.reserve(size_hint);
-        w_l.reserve(size_hint);
-        w_r.reserve(size_hint);
-        w_o.reserve(size_hint);
-        w_4.reserve(size_hint);
+        for (auto& wire : wires) {
+            wire = WireVector(barretenberg::ContainerArenaAllocator<uint32_t>(this->arena));
+        }
+        selectors.set_arena(this->arena);
+        reserve_gates(size_hint);
         this->zero_idx = put_constant_variable(FF::zero());
         this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
     };
-    UltraCircuitBuilder_(const UltraCircuitBuilder_& other) = delete;
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
         : CircuitBuilderBase<FF>(std::move(other))
     {
-        wires = other.wires;
-        selectors = other.selectors;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        wires = std::move(other.wires);
+        selectors = std::move(other.selectors);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = delete;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
-        wires = other.wires;
-        selectors = other.selectors;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        lookup_multi_tables = other.lookup_multi_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        wires = std::move(other.wires);
+        selectors = std::move(other.selectors);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        lookup_multi_tables = std::move(other.lookup_multi_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
 
+  protected:
+    struct FinalizationOf {};
+
+    /**
+     * @brief Start a builder that holds the finalization of `circuit`, for check_circuit to finalize the circuit
+     * without touching it
+     *
+     * @details The new builder gets the variables of the circuit and the structures that the finalization passes
+     * consume (range lists, memory transcripts and cached non-native field multiplications), but none of its gates,
+     * lookup tables or variable names. It starts with empty wires and selectors and a gate count of
+     * circuit.num_gates, so finalizing it appends the finalization gates to its own columns, with the indices they
+     * would have in the circuit.
+     */
+    UltraCircuitBuilder_(const UltraCircuitBuilder_& circuit, FinalizationOf /*unused*/)
+        : constant_variable_indices(circuit.constant_variable_indices)
+        , range_lists(circuit.range_lists)
+        , ram_arrays(circuit.ram_arrays)
+        , rom_arrays(circuit.rom_arrays)
+        , memory_read_records(circuit.memory_read_records)
+        , memory_write_records(circuit.memory_write_records)
+        , cached_partial_non_native_field_multiplications(circuit.cached_partial_non_native_field_multiplications)
+    {
+        for (auto& wire : wires) {
+            wire = WireVector(barretenberg::ContainerArenaAllocator<uint32_t>(this->arena));
+        }
+        selectors.set_arena(this->arena);
+        this->num_gates = circuit.num_gates;
+        this->public_inputs = circuit.public_inputs;
+        this->variables = circuit.variables;
+        this->next_var_index = circuit.next_var_index;
+        this->prev_var_index = circuit.prev_var_index;
+        this->real_variable_index = circuit.real_variable_index;
+        this->real_variable_tags = circuit.real_variable_tags;
+        this->current_tag = circuit.current_tag;
+        this->tau = circuit.tau;
+        this->zero_idx = circuit.zero_idx;
+        this->one_idx = circuit.one_idx;
+    }
+
+    /**
+     * @brief Check the gates, lookups and tags of a finalized circuit
+     *
+     * @param circuit The builder that holds the lookup tables and the gates below its gate count. Any gates from there
+     * on are held by this builder, which is either the circuit itself or its finalization.
+     */
+    bool check_finalized_circuit(const UltraCircuitBuilder_& circuit);
+
+  public:
+
+    /**
+     * @brief Reserve storage for `num_gates` rows in every wire and selector, e.g. from the gate count estimate of an
+     * ACIR program. All columns are carved out of a single arena chunk, so building the circuit costs no further
+     * allocations for them until the estimate is exceeded.
+     */
+    void reserve_gates(const size_t num_gates)
+    {
+        if (num_gates == 0) {
+            return;
+        }
+        constexpr size_t num_columns = NUM_WIRES + Arithmetization::NUM_SELECTORS;
+        constexpr size_t row_size = NUM_WIRES * sizeof(uint32_t) + Arithmetization::NUM_SELECTORS * sizeof(FF);
+        this->arena->reserve(num_gates * row_size + num_columns * barretenberg::MemoryArena::ALIGNMENT);
+        for (auto& wire : wires) {
+            wire.reserve(num_gates);
+        }
+        selectors.reserve(num_gates);
+    }
+
     void finalize_circuit();
 
     void add_gates_to_ensure_all_polys_are_non_zero();
@@ -923,6 +913,19 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     plookup::BasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& create_table(const plookup::MultiTableId id);
 
+    /**
+     * @brief Start the circuit with the basic tables of an earlier circuit of the same program, so that they are not
+     * generated again. The tables keep their indices; the lookups recorded in them are discarded.
+     */
+    void reuse_lookup_tables(std::vector<plookup::BasicTable>&& tables)
+    {
+        ASSERT(lookup_tables.empty());
+        lookup_tables = std::move(tables);
+        for (auto& table : lookup_tables) {
+            table.lookup_gates.clear();
+        }
+    }
+
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
         const plookup::MultiTableId& id,
         const plookup::ReadData<FF>& read_values,
@@ -969,7 +972,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     }
 
     RangeList create_range_list(const uint64_t target_range);
-    void process_range_list(RangeList& list);
+    std::vector<uint32_t> prepare_range_list(RangeList& list) const;
+    void process_range_list(RangeList& list, const std::vector<uint32_t>& sorted_list);
     void process_range_lists();
 
     /**
@@ -1087,7 +1091,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
                                      FF alpha_base,
                                      FF alpha) const;
 
-    bool check_circuit();
+    virtual bool check_circuit();
 };
 extern template class UltraCircuitBuilder_<arithmetization::Ultra<barretenberg::fr>>;
 extern template class UltraCircuitBuilder_<arithmetization::UltraHonk<barretenberg::fr>>;
@@ -1,4 +1,5 @@
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include <gtest/gtest.h>
 
@@ -815,4 +816,192 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(circuit_constructor.check_circuit(), true);
 }
 
-} // namespace proof_system
\ No newline at end of file
+
+TEST(ultra_circuit_constructor, check_circuit_lookups_across_builders)
+{
+    const uint32_t left = engine.get_random_uint32();
+    const uint32_t right = engine.get_random_uint32();
+    const auto accumulators =
+        plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, fr(left), fr(right), /*is_2_to_1_lookup*/ true);
+
+    // Lookup table entries are shared between builders, so both circuits are checked against the same tables
+    UltraCircuitBuilder honest_builder = UltraCircuitBuilder();
+    honest_builder.create_gates_from_plookup_accumulators(
+        MultiTableId::UINT32_XOR, accumulators, honest_builder.add_variable(left), honest_builder.add_variable(right));
+    EXPECT_EQ(honest_builder.check_circuit(), true);
+
+    UltraCircuitBuilder dishonest_builder = UltraCircuitBuilder();
+    const auto lookup_witnesses = dishonest_builder.create_gates_from_plookup_accumulators(
+        MultiTableId::UINT32_XOR,
+        accumulators,
+        dishonest_builder.add_variable(left),
+        dishonest_builder.add_variable(right));
+    EXPECT_EQ(dishonest_builder.check_circuit(), true);
+
+    const uint32_t output_index = dishonest_builder.real_variable_index[lookup_witnesses[ColumnIdx::C3][0]];
+    dishonest_builder.variables[output_index] += fr(1);
+    auto saved_state = UltraCircuitBuilder::CircuitDataBackup::store_full_state(dishonest_builder);
+    EXPECT_EQ(dishonest_builder.check_circuit(), false);
+    EXPECT_TRUE(saved_state.is_same_state(dishonest_builder));
+}
+
+TEST(ultra_circuit_constructor, check_circuit_detects_failure_in_last_gate)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    // Enough gates for the check to be split between several threads
+    const size_t num_gates = 1 << 14;
+    uint32_t a_idx = circuit_constructor.add_variable(fr::random_element());
+    uint32_t b_idx = circuit_constructor.add_variable(fr::random_element());
+    uint32_t c_idx = 0;
+    for (size_t i = 0; i < num_gates; ++i) {
+        const fr a = circuit_constructor.get_variable(a_idx);
+        const fr b = circuit_constructor.get_variable(b_idx);
+        c_idx = circuit_constructor.add_variable(a + b);
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        a_idx = b_idx;
+        b_idx = c_idx;
+    }
+    EXPECT_EQ(circuit_constructor.check_circuit(), true);
+
+    circuit_constructor.variables[circuit_constructor.real_variable_index[c_idx]] += fr(1);
+    EXPECT_EQ(circuit_constructor.check_circuit(), false);
+}
+
+/**
+ * @brief The finalization passes sort the memory transcripts and range lists concurrently; check that the resulting
+ * circuit is nonetheless deterministic and satisfied
+ */
+TEST(ultra_circuit_constructor, finalization_is_deterministic)
+{
+    const auto construct_circuit = [](UltraCircuitBuilder& builder) {
+        constexpr size_t ARRAY_SIZE = 16;
+        for (size_t array = 0; array < 3; ++array) {
+            const size_t rom_id = builder.create_ROM_array(ARRAY_SIZE);
+            // Leave the last cells uninitialized, these are initialized during finalization
+            for (size_t i = 0; i < ARRAY_SIZE - array; ++i) {
+                builder.set_ROM_element(rom_id, i, builder.add_variable(fr(array * ARRAY_SIZE + i)));
+            }
+            // Read some cells repeatedly
+            for (size_t i = 0; i < 3 * ARRAY_SIZE; ++i) {
+                builder.read_ROM_array(rom_id, builder.add_variable(fr((i * 7) % (ARRAY_SIZE - array))));
+            }
+        }
+        for (size_t array = 0; array < 2; ++array) {
+            const size_t ram_id = builder.create_RAM_array(ARRAY_SIZE);
+            for (size_t i = 0; i < ARRAY_SIZE - array; ++i) {
+                builder.init_RAM_element(ram_id, i, builder.add_variable(fr(i)));
+            }
+            for (size_t i = 0; i < 2 * ARRAY_SIZE; ++i) {
+                const size_t index = (i * 5) % (ARRAY_SIZE - array);
+                builder.write_RAM_array(ram_id, builder.add_variable(fr(index)), builder.add_variable(fr(i)));
+                builder.read_RAM_array(ram_id, builder.add_variable(fr(index)));
+            }
+        }
+        for (size_t i = 0; i < 64; ++i) {
+            const uint64_t num_bits = 4 + (i % 5);
+            const fr value(i % (1UL << num_bits));
+            const uint32_t value_idx = builder.add_variable(value);
+            builder.create_new_range_constraint(value_idx, (1UL << num_bits) - 1);
+            builder.create_add_gate({ value_idx, builder.zero_idx, builder.zero_idx, 1, 0, 0, -value });
+        }
+    };
+
+    UltraCircuitBuilder first_builder;
+    UltraCircuitBuilder second_builder;
+    construct_circuit(first_builder);
+    construct_circuit(second_builder);
+    first_builder.finalize_circuit();
+    second_builder.finalize_circuit();
+
+    EXPECT_EQ(first_builder.num_gates, second_builder.num_gates);
+    EXPECT_EQ(first_builder.variables, second_builder.variables);
+    EXPECT_EQ(first_builder.real_variable_tags, second_builder.real_variable_tags);
+    EXPECT_EQ(first_builder.memory_read_records, second_builder.memory_read_records);
+    EXPECT_EQ(first_builder.memory_write_records, second_builder.memory_write_records);
+    for (size_t i = 0; i < first_builder.wires.size(); ++i) {
+        EXPECT_EQ(first_builder.wires[i], second_builder.wires[i]);
+    }
+    EXPECT_EQ(first_builder.check_circuit(), true);
+}
+
+TEST(ultra_circuit_constructor, reserve_gates)
+{
+    const size_t num_gates = 1000;
+    UltraCircuitBuilder circuit_builder(num_gates);
+    const auto* w_l_data = circuit_builder.w_l.data();
+    const auto* q_arith_data = circuit_builder.q_arith.data();
+    const size_t arena_capacity = circuit_builder.arena->capacity();
+
+    const uint32_t a_idx = circuit_builder.add_variable(fr(1));
+    for (size_t i = 0; i + 1 < num_gates; ++i) {
+        circuit_builder.create_add_gate({ a_idx, a_idx, circuit_builder.zero_idx, 1, -1, 0, 0 });
+    }
+    // No column was reallocated and the arena did not grow
+    EXPECT_EQ(circuit_builder.w_l.data(), w_l_data);
+    EXPECT_EQ(circuit_builder.q_arith.data(), q_arith_data);
+    EXPECT_EQ(circuit_builder.arena->capacity(), arena_capacity);
+    EXPECT_EQ(circuit_builder.check_circuit(), true);
+
+    // A moved builder takes over the columns rather than copying them
+    const auto* finalized_w_l_data = circuit_builder.w_l.data();
+    UltraCircuitBuilder moved_builder = std::move(circuit_builder);
+    EXPECT_EQ(moved_builder.w_l.data(), finalized_w_l_data);
+    EXPECT_EQ(moved_builder.check_circuit(), true);
+
+    // The moved-from builder is left with an arena of its own
+    ASSERT_NE(circuit_builder.arena, nullptr);
+    EXPECT_NE(circuit_builder.arena, moved_builder.arena);
+    circuit_builder.reserve_gates(num_gates);
+    EXPECT_GT(circuit_builder.arena->capacity(), 0UL);
+}
+
+/**
+ * @brief Builders own their column storage, so independent circuits can be constructed from several threads at once
+ */
+TEST(ultra_circuit_constructor, concurrent_construction)
+{
+    const size_t num_builders = 4;
+    std::vector<UltraCircuitBuilder> builders(num_builders);
+    parallel_for(num_builders, [&](size_t i) {
+        auto& builder = builders[i];
+        for (size_t j = 0; j < 1000; ++j) {
+            const uint32_t a_idx = builder.add_variable(fr(j));
+            const uint32_t b_idx = builder.add_variable(fr(i));
+            const uint32_t c_idx = builder.add_variable(fr(j + i));
+            builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+            builder.create_new_range_constraint(a_idx, 1023);
+        }
+    });
+    for (size_t i = 0; i < num_builders; ++i) {
+        EXPECT_EQ(builders[i].get_num_gates(), builders[0].get_num_gates());
+        EXPECT_EQ(builders[i].check_circuit(), true);
+    }
+}
+
+/**
+ * @brief Tables built by hand with the same id and size as another table do not pick up its cached entries
+ */
+TEST(ultra_circuit_constructor, lookup_table_cache_keys_on_contents)
+{
+    const auto make_table = [](const std::vector<uint64_t>& keys) {
+        plookup::BasicTable table;
+        table.id = plookup::BasicTableId::HONK_DUMMY_BASIC1;
+        table.table_index = 0;
+        table.size = keys.size();
+        table.use_twin_keys = false;
+        for (const auto key : keys) {
+            table.column_1.emplace_back(key);
+            table.column_2.emplace_back(0);
+            table.column_3.emplace_back(0);
+        }
+        return table;
+    };
+    const auto ascending = plookup::get_sorted_table_keys(make_table({ 1, 2, 3 }));
+    const auto descending = plookup::get_sorted_table_keys(make_table({ 3, 2, 1 }));
+    EXPECT_EQ(ascending->rows, std::vector<uint32_t>({ 0, 1, 2 }));
+    EXPECT_EQ(descending->rows, std::vector<uint32_t>({ 2, 1, 0 }));
+    // The same contents hit the cache
+    EXPECT_EQ(plookup::get_sorted_table_keys(make_table({ 3, 2, 1 })), descending);
+}
+} // namespace proof_system
@@ -0,0 +1,64 @@
+#pragma once
+#include "types.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace plookup {
+
+/**
+ * @brief Hash of everything that determines the entries of a basic table
+ */
+inline uint64_t hash_table_contents(const BasicTable& table)
+{
+    // FNV-1a over the 64-bit limbs of the columns
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const auto absorb = [&hash](const uint64_t word) {
+        hash ^= word;
+        hash *= 0x100000001b3ULL;
+    };
+    absorb(static_cast<uint64_t>(table.id));
+    absorb(table.size);
+    absorb(static_cast<uint64_t>(table.use_twin_keys));
+    for (const auto* column : { &table.column_1, &table.column_2, &table.column_3 }) {
+        for (size_t i = 0; i < table.size; ++i) {
+            for (const auto limb : (*column)[i].data) {
+                absorb(limb);
+            }
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief A process-wide cache of values derived from the contents of a basic table, such as its sorted keys
+ *
+ * @details Values are keyed on the table id and a hash of the table's contents, so that a table built by hand with the
+ * id of another one gets an entry of its own. Cached values are immutable and can be shared between builders and
+ * threads.
+ */
+template <typename Value> class BasicTableCache {
+  public:
+    /**
+     * @brief Get the value for a table, computing it with `compute(table)` on first use
+     */
+    template <typename Compute> std::shared_ptr<const Value> get(const BasicTable& table, Compute&& compute)
+    {
+        const Key key{ table.id, table.size, hash_table_contents(table) };
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& cached = cache[key];
+        if (cached == nullptr) {
+            cached = std::make_shared<const Value>(compute(table));
+        }
+        return cached;
+    }
+
+  private:
+    using Key = std::tuple<BasicTableId, size_t, uint64_t>;
+
+    std::mutex mutex;
+    std::map<Key, std::shared_ptr<const Value>> cache;
+};
+
+} // namespace plookup
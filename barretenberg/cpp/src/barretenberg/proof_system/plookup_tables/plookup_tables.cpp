@@ -1,5 +1,9 @@
 #include "plookup_tables.hpp"
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <map>
+#include <mutex>
+#include <numeric>
 
 namespace plookup {
 
@@ -204,4 +208,36 @@ ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
     return lookup;
 }
 
+/**
+ * @brief Get the keys of a basic table in sorted order, sorting them on first use
+ *
+ * @details The sorted keys only depend on the table's contents, so they are computed once per table and cached for the
+ * lifetime of the process (see BasicTableCache).
+ */
+std::shared_ptr<const SortedTableKeys> get_sorted_table_keys(const BasicTable& table)
+{
+    static BasicTableCache<SortedTableKeys> cache;
+
+    return cache.get(table, [](const BasicTable& table) {
+        SortedTableKeys sorted_keys;
+        std::vector<std::array<uint64_t, 2>> keys(table.size);
+        for (size_t i = 0; i < table.size; ++i) {
+            const uint256_t key_1 = table.column_1[i];
+            const uint256_t key_2 = table.use_twin_keys ? uint256_t(table.column_2[i]) : uint256_t(0);
+            ASSERT(key_1.get_msb() < 64 && key_2.get_msb() < 64);
+            keys[i] = { key_1.data[0], key_2.data[0] };
+        }
+        sorted_keys.rows.resize(table.size);
+        std::iota(sorted_keys.rows.begin(), sorted_keys.rows.end(), 0);
+        std::stable_sort(sorted_keys.rows.begin(), sorted_keys.rows.end(), [&](uint32_t a, uint32_t b) {
+            return keys[a] < keys[b];
+        });
+        sorted_keys.keys.reserve(table.size);
+        for (const auto row : sorted_keys.rows) {
+            sorted_keys.keys.emplace_back(keys[row]);
+        }
+        return sorted_keys;
+    });
+}
+
 } // namespace plookup
@@ -1,8 +1,14 @@
 #pragma once
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <memory>
+#ifndef NO_TBB
+#include <execution>
+#endif
 
 #include "./fixed_base/fixed_base.hpp"
 #include "aes128.hpp"
+#include "basic_table_cache.hpp"
 #include "blake2s.hpp"
 #include "dummy.hpp"
 #include "keccak/keccak_chi.hpp"
@@ -216,4 +222,53 @@ inline BasicTable create_basic_table(const BasicTableId id, const size_t index)
     }
     }
 }
+
+/**
+ * @brief The keys of a basic table in increasing order, together with the row each key is found in
+ */
+struct SortedTableKeys {
+    std::vector<std::array<uint64_t, 2>> keys;
+    std::vector<uint32_t> rows;
+};
+
+std::shared_ptr<const SortedTableKeys> get_sorted_table_keys(const BasicTable& table);
+
+/**
+ * @brief Visit the entries of the sorted list of a basic table, i.e. the table entries together with the lookups
+ * recorded in `table.lookup_gates`, in increasing key order. `fn` receives the three sorted list components of each
+ * entry. The recorded lookups are sorted in place.
+ *
+ * @details The table entries, and hence their order, only depend on the table id, so they are sorted once per process
+ * (see get_sorted_table_keys). Per witness only the lookups are sorted, and then merged into the table. Keys of table
+ * entries fit in 64 bits, so the components of a table entry are its columns.
+ */
+template <typename Fn> void for_each_sorted_list_entry(BasicTable& table, Fn&& fn)
+{
+    auto& lookup_gates = table.lookup_gates;
+#ifdef NO_TBB
+    std::sort(lookup_gates.begin(), lookup_gates.end());
+#else
+    std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
+#endif
+    const auto sorted_keys = get_sorted_table_keys(table);
+
+    auto lookup = lookup_gates.begin();
+    for (size_t i = 0; i < table.size; ++i) {
+        const BasicTable::KeyEntry table_entry{ { sorted_keys->keys[i][0], sorted_keys->keys[i][1] } };
+        // A lookup of a key that is not in the table (i.e. an invalid witness) keeps its place in key order
+        while (lookup != lookup_gates.end() && *lookup < table_entry) {
+            fn(lookup->to_sorted_list_components(table.use_twin_keys));
+            ++lookup;
+        }
+        const size_t row = sorted_keys->rows[i];
+        fn(std::array<barretenberg::fr, 3>{ table.column_1[row], table.column_2[row], table.column_3[row] });
+        while (lookup != lookup_gates.end() && lookup->key == table_entry.key) {
+            fn(lookup->to_sorted_list_components(table.use_twin_keys));
+            ++lookup;
+        }
+    }
+    for (; lookup != lookup_gates.end(); ++lookup) {
+        fn(lookup->to_sorted_list_components(table.use_twin_keys));
+    }
+}
 } // namespace plookup
@@ -3,6 +3,8 @@
 
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "polynomial_store.hpp"
+#include "polynomial_store_cache.hpp"
+#include "polynomial_store_file.hpp"
 
 namespace proof_system {
 
@@ -90,4 +92,80 @@ TEST(PolynomialStore, Remove)
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
 
+// Ensure that polynomials swapped out of a bounded cache to a file come back unchanged, whether prefetched or not
+TEST(PolynomialStoreCache, SwapToFile)
+{
+    PolynomialStoreCache polynomial_store;
+    std::vector<Polynomial> copies;
+    for (size_t i = 0; i < 8; ++i) {
+        Polynomial poly(100 + i);
+        for (auto& coeff : poly) {
+            coeff = Fr::random_element();
+        }
+        copies.emplace_back(poly);
+        polynomial_store.put("id_" + std::to_string(i), std::move(poly));
+    }
+    // Keep the two largest in memory
+    polynomial_store.set_max_cache_size(2);
+
+    polynomial_store.prefetch({ "id_3", "id_1", "id_7", "id_0", "id_5" });
+    for (const size_t i : std::vector<size_t>{ 1, 0, 6, 3, 7, 2, 5, 4 }) {
+        EXPECT_EQ(polynomial_store.get("id_" + std::to_string(i)), copies[i]);
+    }
+
+    // Replacing a polynomial that is being prefetched must not read back the old one
+    polynomial_store.prefetch({ "id_2" });
+    Polynomial replacement(copies[3]);
+    polynomial_store.put("id_2", std::move(replacement));
+    EXPECT_EQ(polynomial_store.get("id_2"), copies[3]);
+    // The replacement is the smallest polynomial in memory, so it is the next to be swapped out
+    polynomial_store.set_max_cache_size(1);
+    EXPECT_EQ(polynomial_store.get("id_2"), copies[3]);
+}
+
+// Ensure that eviction goes by the size of the polynomial now held under a key, not the one first put under it
+TEST(PolynomialStoreCache, ReplaceWithDifferentSize)
+{
+    PolynomialStoreCache polynomial_store;
+    polynomial_store.put("small_then_large", Polynomial(10));
+    polynomial_store.put("medium", Polynomial(50));
+    polynomial_store.put("small_then_large", Polynomial(100));
+
+    EXPECT_EQ(polynomial_store.swap_out_bytes(1), 50 * sizeof(Fr));
+    EXPECT_EQ(polynomial_store.swap_out_bytes(1), 100 * sizeof(Fr));
+    EXPECT_EQ(polynomial_store.get("small_then_large").size(), 100UL);
+}
+
+#ifndef __wasm__
+// Ensure that a polynomial that is read back, modified and swapped out again, as the prover does every round, reuses
+// the region of the file it was first swapped out to
+TEST(PolynomialStoreFile, RespillReusesRegion)
+{
+    PolynomialStoreFile<Fr> store;
+    store.put("other", Polynomial(64));
+    store.put("respilled", Polynomial(100));
+    const size_t file_size = store.get_file_size();
+    EXPECT_EQ(file_size, 164 * sizeof(Fr));
+
+    for (size_t i = 0; i < 16; ++i) {
+        auto poly = store.get("respilled");
+        // The cache removes a polynomial from the file when it is put back in memory
+        store.remove("respilled");
+        poly[0] = Fr(i);
+        store.put("respilled", std::move(poly));
+        EXPECT_EQ(store.get("respilled")[0], Fr(i));
+        EXPECT_EQ(store.get_file_size(), file_size);
+    }
+
+    // A smaller polynomial fits in a free region, and a larger one only fits at the end of the file
+    store.remove("respilled");
+    store.put("smaller", Polynomial(80));
+    EXPECT_EQ(store.get_file_size(), file_size);
+    store.put("larger", Polynomial(120));
+    EXPECT_EQ(store.get_file_size(), file_size + 120 * sizeof(Fr));
+    EXPECT_EQ(store.get("other").size(), 64UL);
+    EXPECT_EQ(store.get("smaller").size(), 80UL);
+}
+#endif
+
 } // namespace proof_system
@@ -1,4 +1,5 @@
 #include "./polynomial_store_cache.hpp"
+#include <algorithm>
 
 namespace proof_system {
 
@@ -15,10 +16,17 @@ void PolynomialStoreCache::put(std::string const& key, Polynomial&& value)
     // info("cache put ", key);
     auto it = cache_.find(key);
     if (it != cache_.end()) {
+        // The polynomial may have changed size, and eviction picks the smallest ones
+        auto size_it =
+            std::find_if(size_map_.begin(), size_map_.end(), [&](auto const& entry) { return entry.second == it; });
+        size_map_.erase(size_it);
+        size_map_.insert({ value.size(), it });
         it->second = std::move(value);
         return;
     }
 
+    // A polynomial that was swapped out has a stale copy in the external store, which may be being read back
+    external_store.remove(key);
     purge_until_free();
 
     auto size = value.size();
@@ -38,9 +46,65 @@ PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& ke
     return external_store.get(key);
 };
 
+void PolynomialStoreCache::remove(std::string const& key)
+{
+    // A polynomial that was swapped out and then put again also has a stale copy in the external store
+    external_store.remove(key);
+    auto it = cache_.find(key);
+    if (it == cache_.end()) {
+        return;
+    }
+    auto size_it =
+        std::find_if(size_map_.begin(), size_map_.end(), [&](auto const& entry) { return entry.second == it; });
+    size_map_.erase(size_it);
+    cache_.erase(it);
+}
+
+void PolynomialStoreCache::prefetch(std::vector<std::string> const& keys)
+{
+    std::vector<std::string> external_keys;
+    for (auto const& key : keys) {
+        if (!cache_.contains(key)) {
+            external_keys.push_back(key);
+        }
+    }
+    external_store.prefetch(external_keys);
+}
+
+void PolynomialStoreCache::set_max_cache_size(size_t max_cache_size)
+{
+    max_cache_size_ = max_cache_size;
+    purge_until_size(max_cache_size_);
+}
+
+size_t PolynomialStoreCache::swap_out_bytes(size_t num_bytes)
+{
+    size_t swapped_out = 0;
+    while (swapped_out < num_bytes && !cache_.empty()) {
+        swapped_out += size_map_.begin()->first * sizeof(barretenberg::fr);
+        purge_until_size(cache_.size() - 1);
+    }
+    return swapped_out;
+}
+
+size_t PolynomialStoreCache::get_size_in_bytes() const
+{
+    size_t size_in_bytes = 0;
+    for (auto const& entry : size_map_) {
+        size_in_bytes += entry.first * sizeof(barretenberg::fr);
+    }
+    return size_in_bytes;
+}
+
 void PolynomialStoreCache::purge_until_free()
 {
-    while (cache_.size() >= max_cache_size_) {
+    // Make room for one more polynomial
+    purge_until_size(max_cache_size_ > 0 ? max_cache_size_ - 1 : 0);
+}
+
+void PolynomialStoreCache::purge_until_size(size_t num_polynomials)
+{
+    while (cache_.size() > num_polynomials) {
         auto size_it = size_map_.begin();
         auto [size, cache_it] = *size_it;
         auto key = cache_it->first;
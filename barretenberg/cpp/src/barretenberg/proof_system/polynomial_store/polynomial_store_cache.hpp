@@ -1,8 +1,11 @@
 #pragma once
+#include "./polynomial_store_file.hpp"
 #include "./polynomial_store_wasm.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace proof_system {
 
@@ -14,16 +17,26 @@ namespace proof_system {
  * In combination with the slab allocator, this brings us to about 4GB mem usage for 512k circuits.
  * In tests using just the external store increased proof time from by about 50%.
  * This pretty much recoups all losses.
+ *
+ * In wasm the external store is held by the JavaScript environment. In native builds it is a local file
+ * (PolynomialStoreFile).
  */
 class PolynomialStoreCache {
   private:
     using Polynomial = barretenberg::Polynomial<barretenberg::fr>;
     std::map<std::string, Polynomial> cache_;
     std::multimap<size_t, std::map<std::string, Polynomial>::iterator> size_map_;
+#ifdef __wasm__
     PolynomialStoreWasm<barretenberg::fr> external_store;
+#else
+    PolynomialStoreFile<barretenberg::fr> external_store;
+#endif
     size_t max_cache_size_;
 
   public:
+    // A cache size that holds every polynomial in memory, so that nothing is swapped out
+    static constexpr size_t UNBOUNDED = std::numeric_limits<size_t>::max();
+
     PolynomialStoreCache();
     explicit PolynomialStoreCache(size_t max_cache_size_);
 
@@ -31,8 +44,33 @@ class PolynomialStoreCache {
 
     Polynomial get(std::string const& key);
 
+    void remove(std::string const& key);
+
+    /**
+     * Tells the store which polynomials will be read next, in order, so that those that were swapped out can be read
+     * back ahead of time.
+     */
+    void prefetch(std::vector<std::string> const& keys);
+
+    /**
+     * Sets the number of polynomials held in memory, swapping out the smallest ones if there are more.
+     */
+    void set_max_cache_size(size_t max_cache_size);
+
+    /**
+     * Swaps out the smallest polynomials in memory until at least num_bytes of them have been swapped out, or none are
+     * left. Returns the number of bytes swapped out.
+     */
+    size_t swap_out_bytes(size_t num_bytes);
+
+    /**
+     * The number of bytes of the polynomials held in memory, not counting those swapped out.
+     */
+    size_t get_size_in_bytes() const;
+
   private:
     void purge_until_free();
+    void purge_until_size(size_t num_polynomials);
 };
 
 } // namespace proof_system
\ No newline at end of file
@@ -0,0 +1,212 @@
+#ifndef __wasm__
+#include "polynomial_store_file.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <unistd.h>
+#include <utility>
+
+namespace proof_system {
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile()
+    : directory_(std::filesystem::temp_directory_path().string())
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile(std::string directory)
+    : directory_(std::move(directory))
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>::PolynomialStoreFile(PolynomialStoreFile&& other) noexcept
+    : directory_(std::move(other.directory_))
+    , fd_(std::exchange(other.fd_, -1))
+    , end_(other.end_)
+    , slots_(std::move(other.slots_))
+    , free_slots_(std::move(other.free_slots_))
+    , pending_(std::move(other.pending_))
+    , prefetched_(std::move(other.prefetched_))
+{}
+
+template <typename Fr>
+PolynomialStoreFile<Fr>& PolynomialStoreFile<Fr>::operator=(PolynomialStoreFile&& other) noexcept
+{
+    if (this != &other) {
+        prefetched_.clear();
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+        directory_ = std::move(other.directory_);
+        fd_ = std::exchange(other.fd_, -1);
+        end_ = other.end_;
+        slots_ = std::move(other.slots_);
+        free_slots_ = std::move(other.free_slots_);
+        pending_ = std::move(other.pending_);
+        prefetched_ = std::move(other.prefetched_);
+    }
+    return *this;
+}
+
+template <typename Fr> PolynomialStoreFile<Fr>::~PolynomialStoreFile()
+{
+    // Wait for any reads in flight before closing the file they read from
+    prefetched_.clear();
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::put(std::string const& key, Polynomial&& value)
+{
+    if (fd_ < 0) {
+        open_file();
+    }
+    cancel_prefetch(key);
+
+    auto it = slots_.find(key);
+    if (it != slots_.end() && it->second.capacity < value.size()) {
+        release(it->second);
+        slots_.erase(it);
+        it = slots_.end();
+    }
+    if (it == slots_.end()) {
+        it = slots_.emplace(key, allocate(value.size())).first;
+    }
+    it->second.size = value.size();
+
+    const auto* buf = reinterpret_cast<const uint8_t*>(value.data().get());
+    size_t remaining = value.size() * sizeof(Fr);
+    auto offset = static_cast<off_t>(it->second.offset);
+    while (remaining > 0) {
+        const auto written = pwrite(fd_, buf, remaining, offset);
+        if (written <= 0) {
+            throw_or_abort("Failed to spill polynomial " + key + " to " + directory_);
+        }
+        buf += written;
+        remaining -= static_cast<size_t>(written);
+        offset += written;
+    }
+}
+
+template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStoreFile<Fr>::get(std::string const& key)
+{
+    auto prefetched = prefetched_.find(key);
+    if (prefetched != prefetched_.end()) {
+        auto p = prefetched->second.get();
+        prefetched_.erase(prefetched);
+        fill_prefetch_window();
+        return p;
+    }
+
+    auto it = slots_.find(key);
+    if (it == slots_.end()) {
+        throw_or_abort("Polynomial not found in store: " + key);
+    }
+    pending_.erase(std::remove(pending_.begin(), pending_.end(), key), pending_.end());
+    return read(fd_, it->second);
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::remove(std::string const& key)
+{
+    cancel_prefetch(key);
+    pending_.erase(std::remove(pending_.begin(), pending_.end(), key), pending_.end());
+    auto it = slots_.find(key);
+    if (it != slots_.end()) {
+        release(it->second);
+        slots_.erase(it);
+    }
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::prefetch(std::vector<std::string> const& keys)
+{
+    // Reads that are no longer expected are dropped, so that they don't hold memory or the prefetch window
+    std::erase_if(prefetched_, [&](auto const& entry) {
+        return std::find(keys.begin(), keys.end(), entry.first) == keys.end();
+    });
+    pending_.clear();
+    for (auto const& key : keys) {
+        if (slots_.contains(key) && !prefetched_.contains(key)) {
+            pending_.push_back(key);
+        }
+    }
+    fill_prefetch_window();
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::open_file()
+{
+    std::string path = directory_ + "/bb_polynomials_XXXXXX";
+    fd_ = mkstemp(path.data());
+    if (fd_ < 0) {
+        throw_or_abort("Failed to create polynomial store file in " + directory_);
+    }
+    unlink(path.c_str());
+}
+
+/**
+ * Takes the smallest free region that fits size coefficients, or appends one to the file. The cache removes a
+ * polynomial from the file whenever it is put back in memory, so the same region is reused every time it is swapped
+ * out again, and the file stays at the size of the most polynomials swapped out at once.
+ */
+template <typename Fr> typename PolynomialStoreFile<Fr>::Slot PolynomialStoreFile<Fr>::allocate(const size_t size)
+{
+    auto free_slot = free_slots_.lower_bound(size);
+    if (free_slot != free_slots_.end()) {
+        Slot slot{ free_slot->second, free_slot->first, size };
+        free_slots_.erase(free_slot);
+        return slot;
+    }
+    Slot slot{ end_, size, size };
+    end_ += size * sizeof(Fr);
+    return slot;
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::release(Slot const& slot)
+{
+    free_slots_.emplace(slot.capacity, slot.offset);
+}
+
+/**
+ * A polynomial that is put while it is being prefetched would be read back stale, so its read is dropped (destroying
+ * the future of a read in flight waits for it)
+ */
+template <typename Fr> void PolynomialStoreFile<Fr>::cancel_prefetch(std::string const& key)
+{
+    prefetched_.erase(key);
+}
+
+template <typename Fr> void PolynomialStoreFile<Fr>::fill_prefetch_window()
+{
+    while (prefetched_.size() < PREFETCH_DEPTH && !pending_.empty()) {
+        auto key = std::move(pending_.front());
+        pending_.pop_front();
+        auto it = slots_.find(key);
+        if (it == slots_.end() || prefetched_.contains(key)) {
+            continue;
+        }
+        prefetched_.emplace(key, std::async(PREFETCH_POLICY, &PolynomialStoreFile::read, fd_, it->second));
+    }
+}
+
+template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStoreFile<Fr>::read(const int fd, Slot const& slot)
+{
+    Polynomial p(slot.size);
+    auto* buf = reinterpret_cast<uint8_t*>(p.data().get());
+    size_t remaining = slot.size * sizeof(Fr);
+    auto offset = static_cast<off_t>(slot.offset);
+    while (remaining > 0) {
+        const auto num_read = pread(fd, buf, remaining, offset);
+        if (num_read <= 0) {
+            throw_or_abort("Failed to read spilled polynomial");
+        }
+        buf += num_read;
+        remaining -= static_cast<size_t>(num_read);
+        offset += num_read;
+    }
+    return p;
+}
+
+template class PolynomialStoreFile<barretenberg::fr>;
+
+} // namespace proof_system
+#endif
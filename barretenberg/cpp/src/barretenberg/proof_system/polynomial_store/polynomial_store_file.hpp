@@ -0,0 +1,86 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <deque>
+#include <future>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace proof_system {
+
+/**
+ * An external store for native builds that spills polynomials to a local file, so that a PolynomialStoreCache can
+ * keep a bounded number of polynomials in memory. The file is created on the first put, in the system's temporary
+ * directory unless another is given, and is unlinked straight away so that it is cleaned up with the store.
+ *
+ * Reads can be overlapped with proving: given the keys the prover will ask for next (in order), `prefetch` keeps up to
+ * PREFETCH_DEPTH of them being read in the background. A get of a key that was prefetched waits for its read, and
+ * any other key is read on the spot. Builds without multithreading defer the reads to the get instead.
+ */
+template <typename Fr> class PolynomialStoreFile {
+  private:
+    using Polynomial = barretenberg::Polynomial<Fr>;
+
+    struct Slot {
+        size_t offset;
+        size_t capacity;
+        size_t size;
+    };
+
+    std::string directory_;
+    int fd_ = -1;
+    size_t end_ = 0;
+    std::unordered_map<std::string, Slot> slots_;
+    // Offsets of the regions of removed polynomials, by capacity, to be reused by later puts
+    std::multimap<size_t, size_t> free_slots_;
+    std::deque<std::string> pending_;
+    std::unordered_map<std::string, std::future<Polynomial>> prefetched_;
+
+#ifdef NO_MULTITHREADING
+    static constexpr std::launch PREFETCH_POLICY = std::launch::deferred;
+#else
+    static constexpr std::launch PREFETCH_POLICY = std::launch::async;
+#endif
+
+  public:
+    static constexpr size_t PREFETCH_DEPTH = 4;
+
+    PolynomialStoreFile();
+    explicit PolynomialStoreFile(std::string directory);
+    PolynomialStoreFile(const PolynomialStoreFile& other) = delete;
+    PolynomialStoreFile(PolynomialStoreFile&& other) noexcept;
+    PolynomialStoreFile& operator=(const PolynomialStoreFile& other) = delete;
+    PolynomialStoreFile& operator=(PolynomialStoreFile&& other) noexcept;
+    ~PolynomialStoreFile();
+
+    void put(std::string const& key, Polynomial&& value);
+
+    Polynomial get(std::string const& key);
+
+    void remove(std::string const& key);
+
+    /**
+     * Sets the keys that will be read next, replacing any previous ones. Keys that are not in the store are skipped.
+     */
+    void prefetch(std::vector<std::string> const& keys);
+
+    bool contains(std::string const& key) const { return slots_.contains(key); }
+
+    /**
+     * The size of the file, including the regions of removed polynomials that are waiting to be reused.
+     */
+    size_t get_file_size() const { return end_; }
+
+  private:
+    void open_file();
+    Slot allocate(size_t size);
+    void release(Slot const& slot);
+    void cancel_prefetch(std::string const& key);
+    void fill_prefetch_window();
+    static Polynomial read(int fd, Slot const& slot);
+};
+
+extern template class PolynomialStoreFile<barretenberg::fr>;
+
+} // namespace proof_system
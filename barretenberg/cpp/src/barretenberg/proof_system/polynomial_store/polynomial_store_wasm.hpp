@@ -2,6 +2,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace proof_system {
 
@@ -14,6 +15,12 @@ template <typename Fr> class PolynomialStoreWasm {
     void put(std::string const& key, Polynomial&& value);
 
     Polynomial get(std::string const& key);
+
+    // The JavaScript environment keeps its copy until the key is put again
+    void remove(std::string const& key) { size_map.erase(key); }
+
+    // The data is held by the JavaScript environment, which reads it synchronously
+    void prefetch(std::vector<std::string> const&) {}
 };
 
 extern template class PolynomialStoreWasm<barretenberg::fr>;
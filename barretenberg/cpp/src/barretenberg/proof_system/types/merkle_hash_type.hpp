@@ -2,5 +2,5 @@
 
 namespace proof_system::merkle {
 // TODO(Cody) Get rid of this?
-enum HashType { FIXED_BASE_PEDERSEN, LOOKUP_PEDERSEN };
+enum HashType { FIXED_BASE_PEDERSEN, LOOKUP_PEDERSEN, POSEIDON2 };
 } // namespace proof_system::merkle
\ No newline at end of file
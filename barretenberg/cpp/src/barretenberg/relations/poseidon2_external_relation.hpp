@@ -0,0 +1,105 @@
+#pragma once
+#include "barretenberg/relations/relation_types.hpp"
+
+namespace proof_system {
+
+template <typename FF_> class Poseidon2ExternalRelationImpl {
+  public:
+    using FF = FF_;
+
+    static constexpr std::array<size_t, 4> SUBRELATION_PARTIAL_LENGTHS{
+        7, // external poseidon2 round sub-relation for first value
+        7, // external poseidon2 round sub-relation for second value
+        7, // external poseidon2 round sub-relation for third value
+        7, // external poseidon2 round sub-relation for fourth value
+    };
+
+    /**
+     * @brief Expression for a full (external) round of the Poseidon2 permutation.
+     * @details The row holds the state (w_1, w_2, w_3, w_4) entering the round and the round constants in (q_1, q_2,
+     * q_3, q_4); the next row holds the state leaving the round. The relation is defined as
+     *    q_poseidon2_external * \sum{ i = [0, 3]} \alpha^i (v_i - w_{i+1}_shift)
+     *      where
+     *      u_i = (w_{i+1} + q_{i+1})^5
+     *      v = M_E * u
+     *
+     * with M_E the 4x4 external MDS matrix
+     *    | 5 7 1 3 |
+     *    | 4 6 1 1 |
+     *    | 1 3 5 7 |
+     *    | 1 1 4 6 |
+     * which is applied with the same sequence of additions as crypto::Poseidon2Permutation.
+     *
+     * @param evals transformed to `evals + C(in(X)...)*scaling_factor`
+     * @param in an std::array containing the fully extended Univariate edges.
+     * @param parameters contains beta, gamma, and public_input_delta, ....
+     * @param scaling_factor optional term to scale the evaluation before adding to evals.
+     */
+    template <typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+    inline static void accumulate(ContainerOverSubrelations& accumulators,
+                                  const AllEntities& in,
+                                  const Parameters&,
+                                  const FF& scaling_factor)
+    {
+        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using View = typename Accumulator::View;
+        auto w_l = View(in.w_l);
+        auto w_r = View(in.w_r);
+        auto w_o = View(in.w_o);
+        auto w_4 = View(in.w_4);
+        auto w_l_shift = View(in.w_l_shift);
+        auto w_r_shift = View(in.w_r_shift);
+        auto w_o_shift = View(in.w_o_shift);
+        auto w_4_shift = View(in.w_4_shift);
+        auto q_l = View(in.q_l);
+        auto q_r = View(in.q_r);
+        auto q_o = View(in.q_o);
+        auto q_4 = View(in.q_4);
+        auto q_poseidon2_external = View(in.q_poseidon2_external);
+
+        // add round constants
+        auto s1 = w_l + q_l;
+        auto s2 = w_r + q_r;
+        auto s3 = w_o + q_o;
+        auto s4 = w_4 + q_4;
+
+        // apply s-box round
+        auto u1 = s1 * s1;
+        u1 *= u1;
+        u1 *= s1;
+        auto u2 = s2 * s2;
+        u2 *= u2;
+        u2 *= s2;
+        auto u3 = s3 * s3;
+        u3 *= u3;
+        u3 *= s3;
+        auto u4 = s4 * s4;
+        u4 *= u4;
+        u4 *= s4;
+
+        // multiply by the external matrix
+        auto t0 = u1 + u2; // A + B
+        auto t1 = u3 + u4; // C + D
+        auto t2 = u2 + u2; // 2B
+        t2 += t1;          // 2B + C + D
+        auto t3 = u4 + u4; // 2D
+        t3 += t0;          // 2D + A + B
+        auto v4 = t1 + t1;
+        v4 += v4;
+        v4 += t3; // A + B + 4C + 6D
+        auto v2 = t0 + t0;
+        v2 += v2;
+        v2 += t2;          // 4A + 6B + C + D
+        auto v1 = t3 + v2; // 5A + 7B + C + 3D
+        auto v3 = t2 + v4; // A + 3B + 5C + 7D
+
+        auto q_pos_by_scaling = q_poseidon2_external * scaling_factor;
+        std::get<0>(accumulators) += q_pos_by_scaling * (v1 - w_l_shift);
+        std::get<1>(accumulators) += q_pos_by_scaling * (v2 - w_r_shift);
+        std::get<2>(accumulators) += q_pos_by_scaling * (v3 - w_o_shift);
+        std::get<3>(accumulators) += q_pos_by_scaling * (v4 - w_4_shift);
+    };
+};
+
+template <typename FF> using Poseidon2ExternalRelation = Relation<Poseidon2ExternalRelationImpl<FF>>;
+} // namespace proof_system
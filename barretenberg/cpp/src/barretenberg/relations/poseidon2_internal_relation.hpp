@@ -0,0 +1,78 @@
+#pragma once
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/relations/relation_types.hpp"
+
+namespace proof_system {
+
+template <typename FF_> class Poseidon2InternalRelationImpl {
+  public:
+    using FF = FF_;
+
+    static constexpr std::array<size_t, 4> SUBRELATION_PARTIAL_LENGTHS{
+        7, // internal poseidon2 round sub-relation for first value
+        7, // internal poseidon2 round sub-relation for second value
+        7, // internal poseidon2 round sub-relation for third value
+        7, // internal poseidon2 round sub-relation for fourth value
+    };
+
+    /**
+     * @brief Expression for a partial (internal) round of the Poseidon2 permutation.
+     * @details The row holds the state (w_1, w_2, w_3, w_4) entering the round and the round constant of the first
+     * state element in q_1; the next row holds the state leaving the round. The relation is defined as
+     *    q_poseidon2_internal * \sum{ i = [0, 3]} \alpha^i (v_i - w_{i+1}_shift)
+     *      where
+     *      u_1 = (w_1 + q_1)^5, u_i = w_i for i > 1
+     *      v_i = D_i * u_i + \sum{ j = [1, 4]} u_j
+     *
+     * with D the diagonal of the internal matrix M_I = D + 1, as given by
+     * Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal.
+     *
+     * @param evals transformed to `evals + C(in(X)...)*scaling_factor`
+     * @param in an std::array containing the fully extended Univariate edges.
+     * @param parameters contains beta, gamma, and public_input_delta, ....
+     * @param scaling_factor optional term to scale the evaluation before adding to evals.
+     */
+    template <typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+    inline static void accumulate(ContainerOverSubrelations& accumulators,
+                                  const AllEntities& in,
+                                  const Parameters&,
+                                  const FF& scaling_factor)
+    {
+        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using View = typename Accumulator::View;
+        const auto& internal_matrix_diagonal = crypto::Poseidon2Bn254ScalarFieldParams::internal_matrix_diagonal;
+
+        auto w_l = View(in.w_l);
+        auto w_r = View(in.w_r);
+        auto w_o = View(in.w_o);
+        auto w_4 = View(in.w_4);
+        auto w_l_shift = View(in.w_l_shift);
+        auto w_r_shift = View(in.w_r_shift);
+        auto w_o_shift = View(in.w_o_shift);
+        auto w_4_shift = View(in.w_4_shift);
+        auto q_l = View(in.q_l);
+        auto q_poseidon2_internal = View(in.q_poseidon2_internal);
+
+        // add round constant and apply the s-box to the first value only
+        auto s1 = w_l + q_l;
+        auto u1 = s1 * s1;
+        u1 *= u1;
+        u1 *= s1;
+
+        // multiply by the internal matrix
+        auto sum = u1 + w_r + w_o + w_4;
+        auto v1 = u1 * FF(internal_matrix_diagonal[0]) + sum;
+        auto v2 = w_r * FF(internal_matrix_diagonal[1]) + sum;
+        auto v3 = w_o * FF(internal_matrix_diagonal[2]) + sum;
+        auto v4 = w_4 * FF(internal_matrix_diagonal[3]) + sum;
+
+        auto q_pos_by_scaling = q_poseidon2_internal * scaling_factor;
+        std::get<0>(accumulators) += q_pos_by_scaling * (v1 - w_l_shift);
+        std::get<1>(accumulators) += q_pos_by_scaling * (v2 - w_r_shift);
+        std::get<2>(accumulators) += q_pos_by_scaling * (v3 - w_o_shift);
+        std::get<3>(accumulators) += q_pos_by_scaling * (v4 - w_4_shift);
+    };
+};
+
+template <typename FF> using Poseidon2InternalRelation = Relation<Poseidon2InternalRelationImpl<FF>>;
+} // namespace proof_system
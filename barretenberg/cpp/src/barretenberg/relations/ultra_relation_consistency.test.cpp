@@ -11,6 +11,8 @@
  * satisfied in general by random inputs) only that the two implementations are equivalent.
  *
  */
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/relations/auxiliary_relation.hpp"
@@ -18,6 +20,8 @@
 #include "barretenberg/relations/gen_perm_sort_relation.hpp"
 #include "barretenberg/relations/lookup_relation.hpp"
 #include "barretenberg/relations/permutation_relation.hpp"
+#include "barretenberg/relations/poseidon2_external_relation.hpp"
+#include "barretenberg/relations/poseidon2_internal_relation.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/ultra_arithmetic_relation.hpp"
 #include <gtest/gtest.h>
@@ -28,7 +32,7 @@ namespace proof_system::ultra_relation_consistency_tests {
 
 using FF = barretenberg::fr;
 struct InputElements {
-    static constexpr size_t NUM_ELEMENTS = 43;
+    static constexpr size_t NUM_ELEMENTS = 45;
     std::array<FF, NUM_ELEMENTS> _data;
 
     static InputElements get_random()
@@ -92,6 +96,8 @@ struct InputElements {
     FF& sorted_accum_shift = std::get<40>(_data);
     FF& z_perm_shift = std::get<41>(_data);
     FF& z_lookup_shift = std::get<42>(_data);
+    FF& q_poseidon2_external = std::get<43>(_data);
+    FF& q_poseidon2_internal = std::get<44>(_data);
 };
 
 class UltraRelationConsistency : public testing::Test {
@@ -551,4 +557,66 @@ TEST_F(UltraRelationConsistency, AuxiliaryRelation)
     run_test(/*random_inputs=*/true);
 };
 
+TEST_F(UltraRelationConsistency, Poseidon2ExternalRelation)
+{
+    const auto run_test = [](bool random_inputs) {
+        using Relation = Poseidon2ExternalRelation<FF>;
+        using SumcheckArrayOfValuesOverSubrelations = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+        using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+        const InputElements input_elements = random_inputs ? InputElements::get_random() : InputElements::get_special();
+        const auto& q_poseidon2_external = input_elements.q_poseidon2_external;
+
+        // A full round: add the round constants held in the selectors, apply the S-box to every element and multiply
+        // by the external matrix
+        Permutation::State state{ input_elements.w_l, input_elements.w_r, input_elements.w_o, input_elements.w_4 };
+        Permutation::add_round_constants(
+            state, { input_elements.q_l, input_elements.q_r, input_elements.q_o, input_elements.q_4 });
+        Permutation::apply_sbox(state);
+        Permutation::matrix_multiplication_external(state);
+
+        SumcheckArrayOfValuesOverSubrelations expected_values;
+        expected_values[0] = q_poseidon2_external * (state[0] - input_elements.w_l_shift);
+        expected_values[1] = q_poseidon2_external * (state[1] - input_elements.w_r_shift);
+        expected_values[2] = q_poseidon2_external * (state[2] - input_elements.w_o_shift);
+        expected_values[3] = q_poseidon2_external * (state[3] - input_elements.w_4_shift);
+
+        const auto parameters = RelationParameters<FF>::get_random();
+
+        validate_relation_execution<Relation>(expected_values, input_elements, parameters);
+    };
+    run_test(/*random_inputs=*/false);
+    run_test(/*random_inputs=*/true);
+};
+
+TEST_F(UltraRelationConsistency, Poseidon2InternalRelation)
+{
+    const auto run_test = [](bool random_inputs) {
+        using Relation = Poseidon2InternalRelation<FF>;
+        using SumcheckArrayOfValuesOverSubrelations = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+        using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+        const InputElements input_elements = random_inputs ? InputElements::get_random() : InputElements::get_special();
+        const auto& q_poseidon2_internal = input_elements.q_poseidon2_internal;
+
+        // A partial round: only the first element gets a round constant and goes through the S-box
+        Permutation::State state{ input_elements.w_l, input_elements.w_r, input_elements.w_o, input_elements.w_4 };
+        state[0] += input_elements.q_l;
+        Permutation::apply_single_sbox(state[0]);
+        Permutation::matrix_multiplication_internal(state);
+
+        SumcheckArrayOfValuesOverSubrelations expected_values;
+        expected_values[0] = q_poseidon2_internal * (state[0] - input_elements.w_l_shift);
+        expected_values[1] = q_poseidon2_internal * (state[1] - input_elements.w_r_shift);
+        expected_values[2] = q_poseidon2_internal * (state[2] - input_elements.w_o_shift);
+        expected_values[3] = q_poseidon2_internal * (state[3] - input_elements.w_4_shift);
+
+        const auto parameters = RelationParameters<FF>::get_random();
+
+        validate_relation_execution<Relation>(expected_values, input_elements, parameters);
+    };
+    run_test(/*random_inputs=*/false);
+    run_test(/*random_inputs=*/true);
+};
+
 } // namespace proof_system::ultra_relation_consistency_tests
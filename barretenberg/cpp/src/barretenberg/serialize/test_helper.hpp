@@ -9,7 +9,7 @@
  */
 template <typename T> std::pair<T, T> msgpack_roundtrip(const T& object)
 {
-    T result;
+    T result{};
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, object);
     msgpack::unpack(buffer.data(), buffer.size()).get().convert(result);
@@ -1013,6 +1013,40 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, Straus)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // enough points to be split across threads, with a zero scalar, a point at infinity, a repeated point and a point
+    // next to its negation
+    constexpr size_t num_points = 67;
+    std::vector<Fr> scalars(num_points);
+    std::vector<AffineElement> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalars[3] = Fr::zero();
+    points[5] = Curve::Group::affine_point_at_infinity;
+    points[8] = points[7];
+    points[10] = -points[9];
+    scalars[10] = scalars[9];
+
+    for (const size_t size : std::array<size_t, 4>{ 0, 1, 11, num_points }) {
+        Element expected = Curve::Group::point_at_infinity;
+        for (size_t i = 0; i < size; ++i) {
+            if (!points[i].is_point_at_infinity()) {
+                expected += Element(points[i]) * scalars[i];
+            }
+        }
+        Element result = barretenberg::scalar_multiplication::straus<Curve>(scalars.data(), points.data(), size);
+        EXPECT_EQ(result, expected) << "size " << size;
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerZeroPoints)
 {
     using Curve = TypeParam;
@@ -0,0 +1,82 @@
+/**
+ * @file multi_buffer_hash.bench.cpp
+ * @brief Throughput of the native SHA-256, Blake2s and Blake3s implementations when hashing many independent messages,
+ * one per backend (scalar, SHA-NI, AVX2, AVX-512). Backends that the CPU does not support are skipped.
+ */
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/blake3s/blake3s.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+
+using namespace benchmark;
+using crypto::multi_buffer::Backend;
+
+namespace {
+constexpr size_t NUM_MESSAGES = 4096;
+
+std::vector<std::vector<uint8_t>> generate_messages(const size_t message_size)
+{
+    std::vector<std::vector<uint8_t>> messages(NUM_MESSAGES, std::vector<uint8_t>(message_size));
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+        for (size_t j = 0; j < message_size; ++j) {
+            messages[i][j] = static_cast<uint8_t>(i * 131 + j * 7);
+        }
+    }
+    return messages;
+}
+
+/**
+ * @brief Hash NUM_MESSAGES messages of state.range(0) bytes each with `hash_many` and the given backend
+ */
+template <typename HashMany> void hash_many_bench(State& state, HashMany hash_many, Backend backend) noexcept
+{
+    if (!crypto::multi_buffer::is_supported(backend)) {
+        state.SkipWithError("backend not supported by this CPU");
+        return;
+    }
+    const auto message_size = static_cast<size_t>(state.range(0));
+    const auto messages = generate_messages(message_size);
+    for (auto _ : state) {
+        DoNotOptimize(hash_many(messages, backend));
+    }
+    const auto num_hashes = static_cast<double>(state.iterations()) * static_cast<double>(NUM_MESSAGES);
+    state.counters["hashes"] = Counter(num_hashes, Counter::kIsRate);
+    state.counters["bytes"] = Counter(num_hashes * static_cast<double>(message_size), Counter::kIsRate);
+}
+
+void sha256_bench(State& state, Backend backend) noexcept
+{
+    hash_many_bench(
+        state, [](const auto& messages, Backend b) { return sha256::sha256_many(messages, b); }, backend);
+}
+
+void blake2s_bench(State& state, Backend backend) noexcept
+{
+    hash_many_bench(
+        state, [](const auto& messages, Backend b) { return blake2::blake2s_many(messages, b); }, backend);
+}
+
+void blake3s_bench(State& state, Backend backend) noexcept
+{
+    hash_many_bench(
+        state, [](const auto& messages, Backend b) { return blake3::blake3s_many(messages, b); }, backend);
+}
+} // namespace
+
+// 32 and 64 bytes are the sizes of hash pairs and tree leaves; 1024 bytes shows the steady-state block rate
+#define MULTI_BUFFER_BENCHMARK(hash, backend)                                                                          \
+    BENCHMARK_CAPTURE(hash##_bench, backend, Backend::backend)->Arg(32)->Arg(64)->Arg(1024)->Unit(kMicrosecond)
+
+MULTI_BUFFER_BENCHMARK(sha256, SCALAR);
+MULTI_BUFFER_BENCHMARK(sha256, SHA_NI);
+MULTI_BUFFER_BENCHMARK(sha256, AVX2);
+MULTI_BUFFER_BENCHMARK(sha256, AVX512);
+MULTI_BUFFER_BENCHMARK(blake2s, SCALAR);
+MULTI_BUFFER_BENCHMARK(blake2s, AVX2);
+MULTI_BUFFER_BENCHMARK(blake2s, AVX512);
+MULTI_BUFFER_BENCHMARK(blake3s, SCALAR);
+MULTI_BUFFER_BENCHMARK(blake3s, AVX2);
+MULTI_BUFFER_BENCHMARK(blake3s, AVX512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,58 @@
+#include "poseidon2.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+using namespace barretenberg;
+using namespace proof_system;
+
+/**
+ * @brief Hash a vector of field elements. If all of them are constants, so is the result.
+ */
+template <typename C> field_t<C> poseidon2<C>::hash(const std::vector<field_t>& inputs)
+{
+    C* builder = nullptr;
+    for (const auto& input : inputs) {
+        if (input.get_context() != nullptr) {
+            builder = input.get_context();
+            break;
+        }
+    }
+    if (builder == nullptr) {
+        std::vector<fr> native_inputs;
+        native_inputs.reserve(inputs.size());
+        for (const auto& input : inputs) {
+            native_inputs.emplace_back(input.get_value());
+        }
+        return field_t(crypto::Poseidon2<Params>::hash(native_inputs));
+    }
+    return Sponge::hash_fixed_length(*builder, inputs);
+}
+
+/**
+ * @brief Hash a byte_array by packing it into field elements of 31 bytes each (the last one possibly shorter),
+ * followed by the number of bytes as a constant, consistent with crypto::Poseidon2::hash_buffer
+ */
+template <typename C> field_t<C> poseidon2<C>::hash_buffer(const stdlib::byte_array<C>& input)
+{
+    const size_t num_bytes = input.size();
+    const size_t bytes_per_element = 31;
+    size_t num_elements = static_cast<size_t>(num_bytes % bytes_per_element != 0) + (num_bytes / bytes_per_element);
+
+    std::vector<field_t> elements;
+    for (size_t i = 0; i < num_elements; ++i) {
+        size_t bytes_to_slice = 0;
+        if (i == num_elements - 1) {
+            bytes_to_slice = num_bytes - (i * bytes_per_element);
+        } else {
+            bytes_to_slice = bytes_per_element;
+        }
+        auto element = static_cast<field_t>(input.slice(i * bytes_per_element, bytes_to_slice));
+        elements.emplace_back(element);
+    }
+    elements.emplace_back(field_t(num_bytes));
+    return hash(elements);
+}
+INSTANTIATE_STDLIB_TYPE(poseidon2);
+
+} // namespace proof_system::plonk::stdlib
@@ -0,0 +1,38 @@
+#pragma once
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/stdlib/hash/poseidon2/poseidon2_permutation.hpp"
+#include "barretenberg/stdlib/hash/poseidon2/sponge/sponge.hpp"
+#include "barretenberg/stdlib/primitives/byte_array/byte_array.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+
+#include "../../primitives/circuit_builders/circuit_builders.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+using namespace barretenberg;
+/**
+ * @brief stdlib class that evaluates in-circuit poseidon2 hashes, consistent with behavior in
+ * crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>
+ *
+ * @details A hash of n field elements costs ceil(n / 3) permutations. In a GoblinUltra circuit a permutation takes 73
+ * rows, plus one addition gate per element absorbed into the state.
+ *
+ * @tparam Builder
+ */
+template <typename Builder> class poseidon2 {
+
+  private:
+    using field_t = stdlib::field_t<Builder>;
+    using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+    using Permutation = Poseidon2Permutation<Builder, Params>;
+    // We only support a rate of 3 and a capacity of 1 so that the state fits in the 4 wires of a row
+    using Sponge = FieldSponge<Params::t - 1, 1, Params::t, Permutation, Builder>;
+
+  public:
+    static field_t hash(const std::vector<field_t>& in);
+    static field_t hash_buffer(const stdlib::byte_array<Builder>& input);
+};
+
+EXTERN_STDLIB_TYPE(poseidon2);
+
+} // namespace proof_system::plonk::stdlib
@@ -0,0 +1,166 @@
+#include "poseidon2.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+namespace test_StdlibPoseidon2 {
+using namespace barretenberg;
+using namespace proof_system::plonk;
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+template <typename Builder> class StdlibPoseidon2 : public testing::Test {
+    using field_ct = stdlib::field_t<Builder>;
+    using witness_ct = stdlib::witness_t<Builder>;
+    using byte_array_ct = stdlib::byte_array<Builder>;
+    using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+    using Permutation = stdlib::Poseidon2Permutation<Builder, Params>;
+    using NativePermutation = crypto::Poseidon2Permutation<Params>;
+    using poseidon2 = stdlib::poseidon2<Builder>;
+    using native_poseidon2 = crypto::Poseidon2<Params>;
+
+  public:
+    static void test_permutation()
+    {
+        Builder builder;
+
+        typename NativePermutation::State native_input;
+        typename Permutation::State input;
+        for (size_t i = 0; i < Params::t; ++i) {
+            native_input[i] = fr::random_element(&engine);
+            input[i] = witness_ct(&builder, native_input[i]);
+        }
+
+        auto result = Permutation::permutation(&builder, input);
+        auto expected = NativePermutation::permutation(native_input);
+        for (size_t i = 0; i < Params::t; ++i) {
+            EXPECT_EQ(result[i].get_value(), expected[i]);
+        }
+
+        info("num gates = ", builder.get_num_gates());
+        EXPECT_TRUE(builder.check_circuit());
+    }
+
+    static void test_hash(const size_t num_inputs)
+    {
+        Builder builder;
+
+        std::vector<fr> native_inputs;
+        std::vector<field_ct> inputs;
+        for (size_t i = 0; i < num_inputs; ++i) {
+            native_inputs.emplace_back(fr::random_element(&engine));
+            inputs.emplace_back(witness_ct(&builder, native_inputs.back()));
+        }
+
+        auto result = poseidon2::hash(inputs);
+        EXPECT_EQ(result.get_value(), native_poseidon2::hash(native_inputs));
+
+        info("num gates = ", builder.get_num_gates());
+        EXPECT_TRUE(builder.check_circuit());
+    }
+
+    static void test_hash_constants()
+    {
+        Builder builder;
+
+        std::vector<fr> native_inputs;
+        std::vector<field_ct> constant_inputs;
+        std::vector<field_ct> mixed_inputs;
+        for (size_t i = 0; i < 4; ++i) {
+            native_inputs.emplace_back(fr::random_element(&engine));
+            constant_inputs.emplace_back(native_inputs.back());
+            if (i % 2 == 0) {
+                mixed_inputs.emplace_back(witness_ct(&builder, native_inputs.back()));
+            } else {
+                mixed_inputs.emplace_back(native_inputs.back());
+            }
+        }
+        const fr expected = native_poseidon2::hash(native_inputs);
+
+        auto constant_result = poseidon2::hash(constant_inputs);
+        EXPECT_TRUE(constant_result.is_constant());
+        EXPECT_EQ(constant_result.get_value(), expected);
+
+        auto mixed_result = poseidon2::hash(mixed_inputs);
+        EXPECT_EQ(mixed_result.get_value(), expected);
+
+        EXPECT_TRUE(builder.check_circuit());
+    }
+
+    static void test_hash_byte_array()
+    {
+        const size_t num_input_bytes = 100;
+
+        Builder builder;
+
+        std::vector<uint8_t> input;
+        input.reserve(num_input_bytes);
+        for (size_t i = 0; i < num_input_bytes; ++i) {
+            input.push_back(engine.get_random_uint8());
+        }
+
+        byte_array_ct circuit_input(&builder, input);
+        auto result = poseidon2::hash_buffer(circuit_input);
+        EXPECT_EQ(result.get_value(), native_poseidon2::hash_buffer(input));
+
+        EXPECT_TRUE(builder.check_circuit());
+    }
+
+    /**
+     * @brief The output of a permutation is bound to its input: changing the value of an intermediate state makes the
+     * circuit unsatisfiable
+     */
+    static void test_permutation_failure()
+    {
+        Builder builder;
+
+        typename Permutation::State input;
+        for (size_t i = 0; i < Params::t; ++i) {
+            input[i] = witness_ct(&builder, fr::random_element(&engine));
+        }
+        auto result = Permutation::permutation(&builder, input);
+        EXPECT_TRUE(builder.check_circuit());
+
+        builder.variables[builder.real_variable_index[result[1].witness_index]] += 1;
+        EXPECT_FALSE(builder.check_circuit());
+    }
+};
+
+using CircuitTypes = testing::Types<proof_system::StandardCircuitBuilder,
+                                    proof_system::UltraCircuitBuilder,
+                                    proof_system::GoblinUltraCircuitBuilder>;
+
+TYPED_TEST_SUITE(StdlibPoseidon2, CircuitTypes);
+
+TYPED_TEST(StdlibPoseidon2, Permutation)
+{
+    TestFixture::test_permutation();
+}
+
+TYPED_TEST(StdlibPoseidon2, HashSmall)
+{
+    TestFixture::test_hash(2);
+}
+
+TYPED_TEST(StdlibPoseidon2, HashLarge)
+{
+    TestFixture::test_hash(10);
+}
+
+TYPED_TEST(StdlibPoseidon2, HashConstants)
+{
+    TestFixture::test_hash_constants();
+}
+
+TYPED_TEST(StdlibPoseidon2, HashByteArray)
+{
+    TestFixture::test_hash_byte_array();
+}
+
+TYPED_TEST(StdlibPoseidon2, PermutationFailure)
+{
+    TestFixture::test_permutation_failure();
+}
+
+} // namespace test_StdlibPoseidon2
@@ -0,0 +1,158 @@
+#include "poseidon2_permutation.hpp"
+#include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+/**
+ * @brief Apply the Poseidon2 permutation to `input`
+ *
+ * @param builder context of the circuit; inputs may be constants
+ * @param input state of the permutation
+ * @return State
+ */
+template <typename Builder, typename Params>
+typename Poseidon2Permutation<Builder, Params>::State Poseidon2Permutation<Builder, Params>::permutation(
+    Builder* builder, const State& input)
+{
+    constexpr size_t rounds_f_beginning = rounds_f / 2;
+    constexpr size_t p_end = rounds_f_beginning + rounds_p;
+    const auto& round_constants = NativePermutation::round_constants;
+
+    // deep copy
+    State current_state(input);
+
+    // Apply 1st linear layer
+    matrix_multiplication_external(current_state);
+
+    if constexpr (IsGoblinBuilder<Builder>) {
+        // The state is threaded through consecutive rows: each round gate constrains the values in the next row to
+        // be the state leaving the round, so the rows of one permutation must not be interleaved with other gates
+        NativeState native_state;
+        std::array<uint32_t, t> state_indices;
+        for (size_t i = 0; i < t; ++i) {
+            native_state[i] = current_state[i].get_value();
+            state_indices[i] = current_state[i].is_constant()
+                                   ? builder->put_constant_variable(native_state[i])
+                                   : current_state[i].normalize().witness_index;
+        }
+        const auto add_state_variables = [&]() {
+            for (size_t i = 0; i < t; ++i) {
+                state_indices[i] = builder->add_variable(native_state[i]);
+            }
+        };
+
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            builder->create_poseidon2_external_gate(
+                { state_indices[0], state_indices[1], state_indices[2], state_indices[3], i });
+            NativePermutation::add_round_constants(native_state, round_constants[i]);
+            NativePermutation::apply_sbox(native_state);
+            NativePermutation::matrix_multiplication_external(native_state);
+            add_state_variables();
+        }
+
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            builder->create_poseidon2_internal_gate(
+                { state_indices[0], state_indices[1], state_indices[2], state_indices[3], i });
+            native_state[0] += round_constants[i][0];
+            NativePermutation::apply_single_sbox(native_state[0]);
+            NativePermutation::matrix_multiplication_internal(native_state);
+            add_state_variables();
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            builder->create_poseidon2_external_gate(
+                { state_indices[0], state_indices[1], state_indices[2], state_indices[3], i });
+            NativePermutation::add_round_constants(native_state, round_constants[i]);
+            NativePermutation::apply_sbox(native_state);
+            NativePermutation::matrix_multiplication_external(native_state);
+            add_state_variables();
+        }
+
+        // The last round gate reads the output state from the row that follows it
+        builder->create_dummy_constraints({ state_indices[0], state_indices[1], state_indices[2], state_indices[3] });
+
+        for (size_t i = 0; i < t; ++i) {
+            current_state[i] = field_t::from_witness_index(builder, state_indices[i]);
+        }
+    } else {
+        static_cast<void>(builder);
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            current_state[0] += round_constants[i][0];
+            apply_single_sbox(current_state[0]);
+            matrix_multiplication_internal(current_state);
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+    }
+    return current_state;
+}
+
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::add_round_constants(State& input, const RoundConstants& rc)
+{
+    for (size_t i = 0; i < t; ++i) {
+        input[i] += rc[i];
+    }
+}
+
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::apply_single_sbox(field_t& input)
+{
+    // hardcoded assumption that d = 5
+    auto xx = input.sqr();
+    auto xxxx = xx.sqr();
+    input *= xxxx;
+}
+
+template <typename Builder, typename Params> void Poseidon2Permutation<Builder, Params>::apply_sbox(State& input)
+{
+    for (auto& in : input) {
+        apply_single_sbox(in);
+    }
+}
+
+/**
+ * @brief Multiply the state by the 4x4 external MDS matrix, with the same sequence of additions as the native
+ * permutation. Scaling a field_t by a constant is free, so this costs one addition gate per line.
+ */
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::matrix_multiplication_external(State& input)
+{
+    static_assert(t == 4);
+    auto t0 = input[0] + input[1]; // A + B
+    auto t1 = input[2] + input[3]; // C + D
+    auto t2 = input[1] * 2 + t1;   // 2B + C + D
+    auto t3 = input[3] * 2 + t0;   // 2D + A + B
+    auto t4 = t1 * 4 + t3;         // A + B + 4C + 6D
+    auto t5 = t0 * 4 + t2;         // 4A + 6B + C + D
+    auto t6 = t3 + t5;             // 5A + 7B + C + 3D
+    auto t7 = t2 + t4;             // A + 3B + 5C + 7D
+    input[0] = t6;
+    input[1] = t5;
+    input[2] = t7;
+    input[3] = t4;
+}
+
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::matrix_multiplication_internal(State& input)
+{
+    static_assert(t == 4);
+    auto sum = input[0].add_two(input[1], input[2]) + input[3];
+    for (size_t i = 0; i < t; ++i) {
+        input[i] = input[i] * NativePermutation::internal_matrix_diagonal[i] + sum;
+    }
+}
+
+INSTANTIATE_STDLIB_TYPE_VA(Poseidon2Permutation, crypto::Poseidon2Bn254ScalarFieldParams);
+
+} // namespace proof_system::plonk::stdlib
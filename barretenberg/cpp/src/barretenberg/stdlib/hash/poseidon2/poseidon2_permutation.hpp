@@ -0,0 +1,51 @@
+#pragma once
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
+#include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+
+#include <array>
+
+namespace proof_system::plonk::stdlib {
+
+/**
+ * @brief In-circuit Poseidon2 permutation, consistent with crypto::Poseidon2Permutation
+ *
+ * @details With a GoblinUltra builder every round of the permutation is a single row of the execution trace,
+ * constrained by the Poseidon2 external and internal round relations: the row holds the state entering the round and
+ * the next row the state leaving it. A permutation then costs 8 arithmetic gates for the initial linear layer, one row
+ * per round and one row holding the output state. Builders without these gates evaluate the rounds with ordinary
+ * field_t arithmetic.
+ *
+ * @tparam Builder
+ * @tparam Params
+ */
+template <typename Builder, typename Params> class Poseidon2Permutation {
+  public:
+    using NativePermutation = crypto::Poseidon2Permutation<Params>;
+    // t = sponge permutation size (in field elements)
+    static constexpr size_t t = Params::t;
+    // number of full sbox rounds
+    static constexpr size_t rounds_f = Params::rounds_f;
+    // number of partial sbox rounds
+    static constexpr size_t rounds_p = Params::rounds_p;
+    static constexpr size_t NUM_ROUNDS = Params::rounds_f + Params::rounds_p;
+
+    using FF = typename Params::FF;
+    using field_t = stdlib::field_t<Builder>;
+    using State = std::array<field_t, t>;
+    using NativeState = typename NativePermutation::State;
+    using RoundConstants = typename NativePermutation::RoundConstants;
+
+    static State permutation(Builder* builder, const State& input);
+
+    static void add_round_constants(State& input, const RoundConstants& rc);
+    static void apply_single_sbox(field_t& input);
+    static void apply_sbox(State& input);
+    static void matrix_multiplication_external(State& input);
+    static void matrix_multiplication_internal(State& input);
+};
+
+EXTERN_STDLIB_TYPE_VA(Poseidon2Permutation, crypto::Poseidon2Bn254ScalarFieldParams);
+
+} // namespace proof_system::plonk::stdlib
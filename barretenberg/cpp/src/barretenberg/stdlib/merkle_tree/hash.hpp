@@ -3,21 +3,70 @@
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
+#include "barretenberg/stdlib/hash/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include <vector>
 
 namespace proof_system::plonk::stdlib::merkle_tree {
 
+/**
+ * @brief Hash functions that merkle trees can be instantiated with. A policy hashes a pair of child nodes into their
+ * parent, and a list of field elements into a leaf. It also hashes pairs of nodes in a circuit, so that membership
+ * proofs can be checked against trees built with the same policy.
+ */
+struct PedersenHashPolicy {
+    static barretenberg::fr hash(const std::vector<barretenberg::fr>& inputs)
+    {
+        return crypto::pedersen_hash::hash(inputs);
+    }
+
+    static barretenberg::fr hash_pair(const barretenberg::fr& lhs, const barretenberg::fr& rhs)
+    {
+        return crypto::pedersen_hash::hash({ lhs, rhs });
+    }
+
+    template <typename Builder>
+    static field_t<Builder> hash_pair(const field_t<Builder>& lhs,
+                                      const field_t<Builder>& rhs,
+                                      const bool skip_field_validation = false)
+    {
+        if (skip_field_validation) {
+            return pedersen_hash<Builder>::hash_skip_field_validation({ lhs, rhs }, 0);
+        }
+        return pedersen_hash<Builder>::hash({ lhs, rhs }, 0);
+    }
+};
+
+struct Poseidon2HashPolicy {
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static barretenberg::fr hash(const std::vector<barretenberg::fr>& inputs) { return Poseidon2::hash(inputs); }
+
+    static barretenberg::fr hash_pair(const barretenberg::fr& lhs, const barretenberg::fr& rhs)
+    {
+        std::array<barretenberg::fr, 2> inputs{ lhs, rhs };
+        return Poseidon2::hash(inputs);
+    }
+
+    // The inputs are absorbed as field elements, so there is no field validation to skip
+    template <typename Builder>
+    static field_t<Builder> hash_pair(const field_t<Builder>& lhs, const field_t<Builder>& rhs, const bool = false)
+    {
+        return poseidon2<Builder>::hash({ lhs, rhs });
+    }
+};
+
 inline barretenberg::fr hash_pair_native(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
 {
-    return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
+    return PedersenHashPolicy::hash_pair(lhs, rhs); // uses lookup tables
 }
 
 inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
 {
-    return crypto::pedersen_hash::hash(inputs); // uses lookup tables
+    return PedersenHashPolicy::hash(inputs); // uses lookup tables
 }
 
 /**
@@ -26,6 +75,7 @@ inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
  * @param input: vector of leaf values.
  * @returns root as field
  */
+template <typename HashingPolicy = PedersenHashPolicy>
 inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
@@ -35,7 +85,7 @@ inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> c
     while (layer.size() > 1) {
         std::vector<barretenberg::fr> next_layer(layer.size() / 2);
         for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
+            next_layer[i] = HashingPolicy::hash_pair(layer[i * 2], layer[i * 2 + 1]);
         }
         layer = std::move(next_layer);
     }
@@ -44,6 +94,7 @@ inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> c
 }
 
 // TODO write test
+template <typename HashingPolicy = PedersenHashPolicy>
 inline std::vector<barretenberg::fr> compute_tree_native(std::vector<barretenberg::fr> const& input)
 {
     // Check if the input vector size is a power of 2.
@@ -54,7 +105,7 @@ inline std::vector<barretenberg::fr> compute_tree_native(std::vector<barretenber
     while (layer.size() > 1) {
         std::vector<barretenberg::fr> next_layer(layer.size() / 2);
         for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
+            next_layer[i] = HashingPolicy::hash_pair(layer[i * 2], layer[i * 2 + 1]);
             tree.push_back(next_layer[i]);
         }
         layer = std::move(next_layer);
@@ -1,7 +1,7 @@
 #pragma once
-#include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/byte_array/byte_array.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "hash.hpp"
 #include "hash_path.hpp"
 
 namespace proof_system::plonk {
@@ -19,10 +19,11 @@ template <typename Builder> using bit_vector = std::vector<bool_t<Builder>>;
  * @param at_height: The height of the subtree,
  * @param is_updating_tree: set to true if we're updating the tree.
  * @tparam Builder: type of builder.
+ * @tparam HashingPolicy: hash combining two sibling nodes, see hash.hpp.
  *
  * @see Check full documentation: https://hackmd.io/2zyJc6QhRuugyH8D78Tbqg?view
  */
-template <typename Builder>
+template <typename Builder, typename HashingPolicy = PedersenHashPolicy>
 field_t<Builder> compute_subtree_root(hash_path<Builder> const& hashes,
                                       field_t<Builder> const& value,
                                       bit_vector<Builder> const& index,
@@ -41,11 +42,7 @@ field_t<Builder> compute_subtree_root(hash_path<Builder> const& hashes,
         // current iff path_bit If either of these does not hold, then the final computed merkle root will not match
         field_t<Builder> left = field_t<Builder>::conditional_assign(path_bit, hashes[i].first, current);
         field_t<Builder> right = field_t<Builder>::conditional_assign(path_bit, current, hashes[i].second);
-        if (is_updating_tree) {
-            current = pedersen_hash<Builder>::hash({ left, right }, 0);
-        } else {
-            current = pedersen_hash<Builder>::hash_skip_field_validation({ left, right }, 0);
-        }
+        current = HashingPolicy::template hash_pair<Builder>(left, right, !is_updating_tree);
     }
 
     return current;
@@ -62,10 +59,11 @@ field_t<Builder> compute_subtree_root(hash_path<Builder> const& hashes,
  * @param at_height: The height of the subtree,
  * @param is_updating_tree: set to true if we're updating the tree.
  * @tparam Builder: type of builder.
+ * @tparam HashingPolicy: hash combining two sibling nodes, see hash.hpp.
  *
  * @see Check full documentation: https://hackmd.io/2zyJc6QhRuugyH8D78Tbqg?view
  */
-template <typename Builder>
+template <typename Builder, typename HashingPolicy = PedersenHashPolicy>
 bool_t<Builder> check_subtree_membership(field_t<Builder> const& root,
                                          hash_path<Builder> const& hashes,
                                          field_t<Builder> const& value,
@@ -73,7 +71,7 @@ bool_t<Builder> check_subtree_membership(field_t<Builder> const& root,
                                          size_t at_height,
                                          bool const is_updating_tree = false)
 {
-    return (compute_subtree_root(hashes, value, index, at_height, is_updating_tree) == root);
+    return (compute_subtree_root<Builder, HashingPolicy>(hashes, value, index, at_height, is_updating_tree) == root);
 }
 
 /**
@@ -88,8 +86,9 @@ bool_t<Builder> check_subtree_membership(field_t<Builder> const& root,
  * @param is_updating_tree: set to true if we're updating the tree,
  * @param msg: error message.
  * @tparam Builder: type of builder.
+ * @tparam HashingPolicy: hash combining two sibling nodes, see hash.hpp.
  */
-template <typename Builder>
+template <typename Builder, typename HashingPolicy = PedersenHashPolicy>
 void assert_check_subtree_membership(field_t<Builder> const& root,
                                      hash_path<Builder> const& hashes,
                                      field_t<Builder> const& value,
@@ -98,7 +97,8 @@ void assert_check_subtree_membership(field_t<Builder> const& root,
                                      bool const is_updating_tree = false,
                                      std::string const& msg = "assert_check_subtree_membership")
 {
-    auto exists = check_subtree_membership(root, hashes, value, index, at_height, is_updating_tree);
+    auto exists =
+        check_subtree_membership<Builder, HashingPolicy>(root, hashes, value, index, at_height, is_updating_tree);
     exists.assert_equal(true, msg);
 }
 
@@ -112,15 +112,16 @@ void assert_check_subtree_membership(field_t<Builder> const& root,
  * @param index: The index of the leaf in the tree,
  * @param is_updating_tree: set to true if we're updating the tree.
  * @tparam Builder: type of builder.
+ * @tparam HashingPolicy: hash combining two sibling nodes, see hash.hpp.
  */
-template <typename Builder>
+template <typename Builder, typename HashingPolicy = PedersenHashPolicy>
 bool_t<Builder> check_membership(field_t<Builder> const& root,
                                  hash_path<Builder> const& hashes,
                                  field_t<Builder> const& value,
                                  bit_vector<Builder> const& index,
                                  bool const is_updating_tree = false)
 {
-    return check_subtree_membership(root, hashes, value, index, 0, is_updating_tree);
+    return check_subtree_membership<Builder, HashingPolicy>(root, hashes, value, index, 0, is_updating_tree);
 }
 
 /**
@@ -134,8 +135,9 @@ bool_t<Builder> check_membership(field_t<Builder> const& root,
  * @param is_updating_tree: set to true if we're updating the tree,
  * @param msg: error message.
  * @tparam Builder: type of builder.
+ * @tparam HashingPolicy: hash combining two sibling nodes, see hash.hpp.
  */
-template <typename Builder>
+template <typename Builder, typename HashingPolicy = PedersenHashPolicy>
 void assert_check_membership(field_t<Builder> const& root,
                              hash_path<Builder> const& hashes,
                              field_t<Builder> const& value,
@@ -143,7 +145,8 @@ void assert_check_membership(field_t<Builder> const& root,
                              bool const is_updating_tree = false,
                              std::string const& msg = "assert_check_membership")
 {
-    auto exists = stdlib::merkle_tree::check_membership(root, hashes, value, index, is_updating_tree);
+    auto exists =
+        stdlib::merkle_tree::check_membership<Builder, HashingPolicy>(root, hashes, value, index, is_updating_tree);
     exists.assert_equal(true, msg);
 }
 
@@ -5,6 +5,7 @@
 #include "memory_tree.hpp"
 #include "merkle_tree.hpp"
 
+#include "barretenberg/proof_system/circuit_builder/goblin_ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 
 namespace {
@@ -50,6 +51,29 @@ TEST(stdlib_merkle_tree, test_check_membership)
     EXPECT_EQ(result, true);
 }
 
+TEST(stdlib_merkle_tree, test_check_membership_poseidon2)
+{
+    using GoblinBuilder = proof_system::GoblinUltraCircuitBuilder;
+    using goblin_field_ct = field_t<GoblinBuilder>;
+    using goblin_witness_ct = witness_t<GoblinBuilder>;
+
+    MemoryStore store;
+    auto db = MerkleTree<MemoryStore, Poseidon2HashPolicy>(store, 3);
+    db.update_element(5, 42);
+    auto builder = GoblinBuilder();
+
+    auto index = goblin_field_ct(goblin_witness_ct(&builder, fr(5))).decompose_into_bits();
+    goblin_field_ct root = goblin_witness_ct(&builder, db.root());
+    bool_t<GoblinBuilder> is_member = check_membership<GoblinBuilder, Poseidon2HashPolicy>(
+        root, create_witness_hash_path(builder, db.get_hash_path(5)), goblin_field_ct(42), index);
+
+    printf("num gates = %zu\n", builder.get_num_gates());
+
+    bool result = builder.check_circuit();
+    EXPECT_EQ(is_member.get_value(), true);
+    EXPECT_EQ(result, true);
+}
+
 TEST(stdlib_merkle_tree, test_batch_update_membership)
 {
     MemoryStore store;
@@ -5,7 +5,8 @@ namespace proof_system::plonk {
 namespace stdlib {
 namespace merkle_tree {
 
-MemoryTree::MemoryTree(size_t depth)
+template <typename HashingPolicy>
+MemoryTree<HashingPolicy>::MemoryTree(size_t depth)
     : depth_(depth)
 {
 
@@ -20,13 +21,13 @@ MemoryTree::MemoryTree(size_t depth)
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     root_ = current;
 }
 
-fr_hash_path MemoryTree::get_hash_path(size_t index)
+template <typename HashingPolicy> fr_hash_path MemoryTree<HashingPolicy>::get_hash_path(size_t index)
 {
     fr_hash_path path(depth_);
     size_t offset = 0;
@@ -41,7 +42,7 @@ fr_hash_path MemoryTree::get_hash_path(size_t index)
     return path;
 }
 
-fr_sibling_path MemoryTree::get_sibling_path(size_t index)
+template <typename HashingPolicy> fr_sibling_path MemoryTree<HashingPolicy>::get_sibling_path(size_t index)
 {
     fr_sibling_path path(depth_);
     size_t offset = 0;
@@ -59,7 +60,7 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
     return path;
 }
 
-fr MemoryTree::update_element(size_t index, fr const& value)
+template <typename HashingPolicy> fr MemoryTree<HashingPolicy>::update_element(size_t index, fr const& value)
 {
     size_t offset = 0;
     size_t layer_size = total_size_;
@@ -67,7 +68,7 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     for (size_t i = 0; i < depth_; ++i) {
         hashes_[offset + index] = current;
         index &= (~0ULL) - 1;
-        current = hash_pair_native(hashes_[offset + index], hashes_[offset + index + 1]);
+        current = HashingPolicy::hash_pair(hashes_[offset + index], hashes_[offset + index + 1]);
         offset += layer_size;
         layer_size >>= 1;
         index >>= 1;
@@ -76,6 +77,9 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+template class MemoryTree<PedersenHashPolicy>;
+template class MemoryTree<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
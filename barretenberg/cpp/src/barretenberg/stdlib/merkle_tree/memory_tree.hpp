@@ -1,4 +1,5 @@
 #pragma once
+#include "hash.hpp"
 #include "hash_path.hpp"
 
 namespace proof_system::plonk {
@@ -22,9 +23,9 @@ using namespace barretenberg;
  *
  * Here, depth_ = 3 and {h_{0,j}}_{i=0..7} are leaf values.
  * Also, root_ = h_{3,0} and total_size_ = (2 * 8 - 2) = 14.
- * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1.
+ * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1, and `hash` is given by `HashingPolicy`.
  */
-class MemoryTree {
+template <typename HashingPolicy = PedersenHashPolicy> class MemoryTree {
   public:
     MemoryTree(size_t depth);
 
@@ -43,6 +44,9 @@ class MemoryTree {
     std::vector<barretenberg::fr> hashes_;
 };
 
+extern template class MemoryTree<PedersenHashPolicy>;
+extern template class MemoryTree<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -22,38 +23,62 @@ static std::vector<fr> VALUES = []() {
     return values;
 }();
 
-void hash(State& state) noexcept
+template <typename HashingPolicy> void hash(State& state) noexcept
 {
     for (auto _ : state) {
-        hash_pair_native({ 0, 0, 0, 0 }, { 1, 1, 1, 1 });
+        DoNotOptimize(HashingPolicy::hash_pair({ 0, 0, 0, 0 }, { 1, 1, 1, 1 }));
     }
 }
-BENCHMARK(hash)->MinTime(5);
+BENCHMARK_TEMPLATE(hash, PedersenHashPolicy)->MinTime(5);
+BENCHMARK_TEMPLATE(hash, Poseidon2HashPolicy)->MinTime(5);
 
-void update_first_element(State& state) noexcept
+template <typename HashingPolicy> void update_first_element(State& state) noexcept
 {
     MemoryStore store;
-    MerkleTree<MemoryStore> db(store, DEPTH);
+    MerkleTree<MemoryStore, HashingPolicy> db(store, DEPTH);
 
     for (auto _ : state) {
         db.update_element(0, VALUES[1]);
     }
 }
-BENCHMARK(update_first_element)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(update_first_element, PedersenHashPolicy)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(update_first_element, Poseidon2HashPolicy)->Unit(benchmark::kMillisecond);
 
-void update_elements(State& state) noexcept
+template <typename HashingPolicy> void update_elements(State& state) noexcept
 {
     for (auto _ : state) {
         state.PauseTiming();
         MemoryStore store;
-        MerkleTree<MemoryStore> db(store, DEPTH);
+        MerkleTree<MemoryStore, HashingPolicy> db(store, DEPTH);
         state.ResumeTiming();
         for (size_t i = 0; i < (size_t)state.range(0); ++i) {
             db.update_element(i, VALUES[i]);
         }
     }
 }
-BENCHMARK(update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+BENCHMARK_TEMPLATE(update_elements, PedersenHashPolicy)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(256, MAX);
+BENCHMARK_TEMPLATE(update_elements, Poseidon2HashPolicy)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(256, MAX);
+
+template <typename HashingPolicy> void update_memory_tree_elements(State& state) noexcept
+{
+    constexpr size_t MEMORY_TREE_DEPTH = 12;
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryTree<HashingPolicy> tree(MEMORY_TREE_DEPTH);
+        state.ResumeTiming();
+        for (size_t i = 0; i < (size_t)state.range(0); ++i) {
+            tree.update_element(i, VALUES[i]);
+        }
+    }
+}
+BENCHMARK_TEMPLATE(update_memory_tree_elements, PedersenHashPolicy)->Unit(benchmark::kMillisecond)->Arg(MAX);
+BENCHMARK_TEMPLATE(update_memory_tree_elements, Poseidon2HashPolicy)->Unit(benchmark::kMillisecond)->Arg(MAX);
 
 void update_random_elements(State& state) noexcept
 {
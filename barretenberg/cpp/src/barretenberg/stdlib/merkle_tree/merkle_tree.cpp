@@ -23,8 +23,8 @@ template <typename T> inline bool bit_set(T const& index, size_t i)
     return bool((index >> i) & 0x1);
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     : store_(store)
     , depth_(depth)
     , tree_id_(tree_id)
@@ -36,29 +36,30 @@ MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     auto current = fr(0);
     for (size_t i = 0; i < depth; ++i) {
         zero_hashes_[i] = current;
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(MerkleTree&& other)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(MerkleTree&& other)
     : store_(other.store_)
     , zero_hashes_(std::move(other.zero_hashes_))
     , depth_(other.depth_)
     , tree_id_(other.tree_id_)
 {}
 
-template <typename Store> MerkleTree<Store>::~MerkleTree() {}
+template <typename Store, typename HashingPolicy> MerkleTree<Store, HashingPolicy>::~MerkleTree() {}
 
-template <typename Store> fr MerkleTree<Store>::root() const
+template <typename Store, typename HashingPolicy> fr MerkleTree<Store, HashingPolicy>::root() const
 {
     std::vector<uint8_t> root;
     std::vector<uint8_t> key = { tree_id_ };
     bool status = store_.get(key, root);
-    return status ? from_buffer<fr>(root) : hash_pair_native(zero_hashes_.back(), zero_hashes_.back());
+    return status ? from_buffer<fr>(root) : HashingPolicy::hash_pair(zero_hashes_.back(), zero_hashes_.back());
 }
 
-template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>::size() const
+template <typename Store, typename HashingPolicy>
+typename MerkleTree<Store, HashingPolicy>::index_t MerkleTree<Store, HashingPolicy>::size() const
 {
     std::vector<uint8_t> size_buf;
     std::vector<uint8_t> key = { tree_id_ };
@@ -66,7 +67,8 @@ template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>:
     return status ? from_buffer<index_t>(size_buf, 32) : 0;
 }
 
-template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_hash_path MerkleTree<Store, HashingPolicy>::get_hash_path(index_t index)
 {
     fr_hash_path path(depth_);
 
@@ -107,7 +109,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             } else {
                 // Requesting path to a different, independent element.
@@ -127,7 +129,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             }
             break;
@@ -137,7 +139,8 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
     return path;
 }
 
-template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_sibling_path MerkleTree<Store, HashingPolicy>::get_sibling_path(index_t index)
 {
     fr_sibling_path path(depth_);
 
@@ -196,7 +199,8 @@ template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(in
     return path;
 }
 
-template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(index_t index, fr const& value)
 {
     auto leaf = value;
     using serialize::write;
@@ -216,18 +220,19 @@ template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr
     return r;
 }
 
-template <typename Store> fr MerkleTree<Store>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
 {
     bool a_is_right = bit_set(a_index, height - 1);
     auto left = a_is_right ? b : a;
     auto right = a_is_right ? a : b;
-    auto key = hash_pair_native(left, right);
+    auto key = HashingPolicy::hash_pair(left, right);
     put(key, left, right);
     return key;
 }
 
-template <typename Store>
-fr MerkleTree<Store>::fork_stump(
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::fork_stump(
     fr const& value1, index_t index1, fr const& value2, index_t index2, size_t height, size_t common_height)
 {
     if (height == common_height) {
@@ -252,8 +257,8 @@ fr MerkleTree<Store>::fork_stump(
     }
 }
 
-template <typename Store>
-fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t index, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(fr const& root, fr const& value, index_t index, size_t height)
 {
     // Base layer of recursion at height = 0.
     if (height == 0) {
@@ -299,7 +304,7 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
         } else {
             left = subtree_root;
         }
-        auto new_root = hash_pair_native(left, right);
+        auto new_root = HashingPolicy::hash_pair(left, right);
         put(new_root, left, right);
 
         // Remove the old node only while rolling back in recursion.
@@ -310,7 +315,8 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
     }
 }
 
-template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
 {
     fr current = value;
     for (size_t i = 0; i < height; ++i) {
@@ -323,12 +329,13 @@ template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t he
             right = zero_hashes_[i];
             left = current;
         }
-        current = hash_pair_native(left, right);
+        current = HashingPolicy::hash_pair(left, right);
     }
     return current;
 }
 
-template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& left, fr const& right)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put(fr const& key, fr const& left, fr const& right)
 {
     std::vector<uint8_t> value;
     write(value, left);
@@ -336,7 +343,8 @@ template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& l
     store_.put(key.to_buffer(), value);
 }
 
-template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put_stump(fr const& key, index_t index, fr const& value)
 {
     std::vector<uint8_t> buf;
     write(buf, value);
@@ -346,12 +354,13 @@ template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index
     store_.put(key.to_buffer(), buf);
 }
 
-template <typename Store> void MerkleTree<Store>::remove(fr const& key)
+template <typename Store, typename HashingPolicy> void MerkleTree<Store, HashingPolicy>::remove(fr const& key)
 {
     store_.del(key.to_buffer());
 }
 
-template class MerkleTree<MemoryStore>;
+template class MerkleTree<MemoryStore, PedersenHashPolicy>;
+template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
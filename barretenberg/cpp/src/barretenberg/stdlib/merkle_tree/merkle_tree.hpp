@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "hash.hpp"
 #include "hash_path.hpp"
 
 namespace proof_system::plonk {
@@ -10,7 +11,11 @@ using namespace barretenberg;
 
 class MemoryStore;
 
-template <typename Store> class MerkleTree {
+/**
+ * @tparam Store key-value store holding the nodes of the tree
+ * @tparam HashingPolicy hash function used to compress pairs of nodes (see hash.hpp)
+ */
+template <typename Store, typename HashingPolicy = PedersenHashPolicy> class MerkleTree {
   public:
     typedef uint256_t index_t;
 
@@ -97,7 +102,8 @@ template <typename Store> class MerkleTree {
     uint8_t tree_id_;
 };
 
-extern template class MerkleTree<MemoryStore>;
+extern template class MerkleTree<MemoryStore, PedersenHashPolicy>;
+extern template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
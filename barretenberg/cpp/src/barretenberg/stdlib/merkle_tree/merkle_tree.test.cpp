@@ -55,6 +55,35 @@ TEST(stdlib_merkle_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_merkle_tree, test_poseidon2_hashing_policy)
+{
+    constexpr size_t depth = 6;
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    MemoryStore store;
+    MerkleTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+
+    std::vector<fr> leaves(1 << depth);
+    for (size_t i = 0; i < leaves.size(); i += 3) {
+        leaves[i] = VALUES[i + 1];
+        memdb.update_element(i, leaves[i]);
+        db.update_element(i, leaves[i]);
+    }
+
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(memdb.root(), compute_tree_root_native<Poseidon2HashPolicy>(leaves));
+
+    // The hash function is part of the tree's definition
+    MemoryTree pedersen_memdb(depth);
+    for (size_t i = 0; i < leaves.size(); i += 3) {
+        pedersen_memdb.update_element(i, leaves[i]);
+    }
+    EXPECT_NE(pedersen_memdb.root(), memdb.root());
+}
+
 TEST(stdlib_merkle_tree, test_size)
 {
     MemoryStore store;
@@ -1,4 +1,5 @@
 #pragma once
+#include "../hash.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 
@@ -24,7 +25,10 @@ struct nullifier_leaf {
         return os;
     }
 
-    barretenberg::fr hash() const { return stdlib::merkle_tree::hash_native({ value, nextIndex, nextValue }); }
+    template <typename HashingPolicy = PedersenHashPolicy> barretenberg::fr hash() const
+    {
+        return HashingPolicy::hash({ value, nextIndex, nextValue });
+    }
 };
 
 /**
@@ -72,7 +76,10 @@ class WrappedNullifierLeaf {
      *
      * @return barretenberg::fr
      */
-    barretenberg::fr hash() const { return data.has_value() ? data.value().hash() : barretenberg::fr::zero(); }
+    template <typename HashingPolicy = PedersenHashPolicy> barretenberg::fr hash() const
+    {
+        return data.has_value() ? data.value().hash<HashingPolicy>() : barretenberg::fr::zero();
+    }
 
     /**
      * @brief Generate a zero leaf (call the constructor with no arguments)
@@ -5,30 +5,31 @@ namespace proof_system::plonk {
 namespace stdlib {
 namespace merkle_tree {
 
-NullifierMemoryTree::NullifierMemoryTree(size_t depth)
-    : MemoryTree(depth)
+template <typename HashingPolicy>
+NullifierMemoryTree<HashingPolicy>::NullifierMemoryTree(size_t depth)
+    : MemoryTree<HashingPolicy>(depth)
 {
     ASSERT(depth_ >= 1 && depth <= 32);
     total_size_ = 1UL << depth_;
     hashes_.resize(total_size_ * 2 - 2);
 
     // Build the entire tree and fill with 0 hashes.
-    auto current = WrappedNullifierLeaf::zero().hash();
+    auto current = WrappedNullifierLeaf::zero().hash<HashingPolicy>();
     size_t layer_size = total_size_;
     for (size_t offset = 0; offset < hashes_.size(); offset += layer_size, layer_size /= 2) {
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
-    root_ = update_element(0, initial_leaf.hash());
+    root_ = update_element(0, initial_leaf.hash<HashingPolicy>());
 }
 
-fr NullifierMemoryTree::update_element(fr const& value)
+template <typename HashingPolicy> fr NullifierMemoryTree<HashingPolicy>::update_element(fr const& value)
 {
     // Find the leaf with the value closest and less than `value`
 
@@ -36,7 +37,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
     if (value == 0) {
         auto zero_leaf = WrappedNullifierLeaf::zero();
         leaves_.push_back(zero_leaf);
-        return update_element(leaves_.size() - 1, zero_leaf.hash());
+        return update_element(leaves_.size() - 1, zero_leaf.hash<HashingPolicy>());
     }
 
     size_t current;
@@ -60,18 +61,21 @@ fr NullifierMemoryTree::update_element(fr const& value)
     }
 
     // Update the old leaf in the tree
-    auto old_leaf_hash = current_leaf.hash();
+    auto old_leaf_hash = current_leaf.hash<HashingPolicy>();
     size_t old_leaf_index = current;
     auto root = update_element(old_leaf_index, old_leaf_hash);
 
     // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
+    auto new_leaf_hash = new_leaf.hash<HashingPolicy>();
     size_t new_leaf_index = is_already_present ? old_leaf_index : leaves_.size() - 1;
     root = update_element(new_leaf_index, new_leaf_hash);
 
     return root;
 }
 
+template class NullifierMemoryTree<PedersenHashPolicy>;
+template class NullifierMemoryTree<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
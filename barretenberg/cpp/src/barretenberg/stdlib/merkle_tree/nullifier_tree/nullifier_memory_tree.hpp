@@ -67,14 +67,15 @@ using namespace barretenberg;
  *  nextIdx   2       4       3       1        0       0       0       0
  *  nextVal   10      50      20      30       0       0       0       0
  */
-class NullifierMemoryTree : public MemoryTree {
+template <typename HashingPolicy = PedersenHashPolicy>
+class NullifierMemoryTree : public MemoryTree<HashingPolicy> {
 
   public:
     NullifierMemoryTree(size_t depth);
 
-    using MemoryTree::get_hash_path;
-    using MemoryTree::root;
-    using MemoryTree::update_element;
+    using MemoryTree<HashingPolicy>::get_hash_path;
+    using MemoryTree<HashingPolicy>::root;
+    using MemoryTree<HashingPolicy>::update_element;
 
     fr update_element(fr const& value);
 
@@ -86,13 +87,16 @@ class NullifierMemoryTree : public MemoryTree {
     const std::vector<WrappedNullifierLeaf>& get_leaves() { return leaves_; }
 
   protected:
-    using MemoryTree::depth_;
-    using MemoryTree::hashes_;
-    using MemoryTree::root_;
-    using MemoryTree::total_size_;
+    using MemoryTree<HashingPolicy>::depth_;
+    using MemoryTree<HashingPolicy>::hashes_;
+    using MemoryTree<HashingPolicy>::root_;
+    using MemoryTree<HashingPolicy>::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
 };
 
+extern template class NullifierMemoryTree<PedersenHashPolicy>;
+extern template class NullifierMemoryTree<Poseidon2HashPolicy>;
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
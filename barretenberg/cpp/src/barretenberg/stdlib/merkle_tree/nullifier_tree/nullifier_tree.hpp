@@ -9,7 +9,8 @@ namespace merkle_tree {
 
 using namespace barretenberg;
 
-template <typename Store> class NullifierTree : public MerkleTree<Store> {
+template <typename Store, typename HashingPolicy = PedersenHashPolicy>
+class NullifierTree : public MerkleTree<Store, HashingPolicy> {
   public:
     typedef uint256_t index_t;
 
@@ -18,27 +19,28 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     NullifierTree(NullifierTree&& other);
     ~NullifierTree();
 
-    using MerkleTree<Store>::get_hash_path;
-    using MerkleTree<Store>::root;
-    using MerkleTree<Store>::size;
-    using MerkleTree<Store>::depth;
+    using MerkleTree<Store, HashingPolicy>::get_hash_path;
+    using MerkleTree<Store, HashingPolicy>::root;
+    using MerkleTree<Store, HashingPolicy>::size;
+    using MerkleTree<Store, HashingPolicy>::depth;
 
     fr update_element(fr const& value);
 
   private:
-    using MerkleTree<Store>::update_element;
-    using MerkleTree<Store>::get_element;
-    using MerkleTree<Store>::compute_zero_path_hash;
+    using MerkleTree<Store, HashingPolicy>::update_element;
+    using MerkleTree<Store, HashingPolicy>::get_element;
+    using MerkleTree<Store, HashingPolicy>::compute_zero_path_hash;
 
   private:
-    using MerkleTree<Store>::store_;
-    using MerkleTree<Store>::zero_hashes_;
-    using MerkleTree<Store>::depth_;
-    using MerkleTree<Store>::tree_id_;
+    using MerkleTree<Store, HashingPolicy>::store_;
+    using MerkleTree<Store, HashingPolicy>::zero_hashes_;
+    using MerkleTree<Store, HashingPolicy>::depth_;
+    using MerkleTree<Store, HashingPolicy>::tree_id_;
     std::vector<WrappedNullifierLeaf> leaves;
 };
 
-extern template class NullifierTree<MemoryStore>;
+extern template class NullifierTree<MemoryStore, PedersenHashPolicy>;
+extern template class NullifierTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
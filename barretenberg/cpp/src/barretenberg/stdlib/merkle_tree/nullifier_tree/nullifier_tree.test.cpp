@@ -63,6 +63,26 @@ TEST(stdlib_nullifier_tree, test_kv_memory_vs_memory_consistency)
     EXPECT_EQ(db.root(), memdb.root());
 }
 
+TEST(stdlib_nullifier_tree, test_poseidon2_hashing_policy)
+{
+    constexpr size_t depth = 3;
+    NullifierMemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    MemoryStore store;
+    NullifierTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+
+    for (size_t i = 1; i < (1UL << depth); ++i) {
+        memdb.update_element(VALUES[(i * 5) % (1UL << depth)]);
+        db.update_element(VALUES[(i * 5) % (1UL << depth)]);
+    }
+
+    for (size_t i = 0; i < (1UL << depth); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_NE(memdb.root(), NullifierMemoryTree(depth).root());
+}
+
 TEST(stdlib_nullifier_tree, test_size)
 {
     MemoryStore store;
@@ -81,47 +81,13 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_witness(Circuit& c
 
     for (auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
-        for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
-            } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
-            }
-        }
-
-#ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
-#else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
-#endif
-
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+        plookup::for_each_sorted_list_entry(table, [&](const std::array<fr, 3>& components) {
             s_1[s_index] = components[0];
             s_2[s_index] = components[1];
             s_3[s_index] = components[2];
             s_4[s_index] = table_index;
             ++s_index;
-        }
+        });
     }
 
     // Polynomial memory is zeroed out when constructed with size hint, so we don't have to initialize trailing
@@ -338,6 +304,8 @@ template <class Flavor> void ProverInstance_<Flavor>::initialize_prover_polynomi
         prover_polynomials.lookup_inverses = proving_key->lookup_inverses;
         prover_polynomials.q_busread = proving_key->q_busread;
         prover_polynomials.databus_id = proving_key->databus_id;
+        prover_polynomials.q_poseidon2_external = proving_key->q_poseidon2_external;
+        prover_polynomials.q_poseidon2_internal = proving_key->q_poseidon2_internal;
     }
 
     // These polynomials have not yet been computed; initialize them so prover_polynomials is "full" and we can use
@@ -530,6 +498,8 @@ std::shared_ptr<typename Flavor::VerificationKey> ProverInstance_<Flavor>::compu
         verification_key->lagrange_ecc_op = commitment_key->commit(proving_key->lagrange_ecc_op);
         verification_key->q_busread = commitment_key->commit(proving_key->q_busread);
         verification_key->databus_id = commitment_key->commit(proving_key->databus_id);
+        verification_key->q_poseidon2_external = commitment_key->commit(proving_key->q_poseidon2_external);
+        verification_key->q_poseidon2_internal = commitment_key->commit(proving_key->q_poseidon2_internal);
     }
 
     return verification_key;
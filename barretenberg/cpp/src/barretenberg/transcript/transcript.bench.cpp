@@ -0,0 +1,74 @@
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/transcript/transcript.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+using FF = barretenberg::fr;
+
+/**
+ * @brief Prover side of a transcript shaped like sumcheck: each round sends a few univariate evaluations and draws one
+ * challenge
+ */
+template <typename Hash> void transcript_rounds(State& state) noexcept
+{
+    constexpr size_t ELEMENTS_PER_ROUND = 6;
+    const auto num_rounds = static_cast<size_t>(state.range(0));
+    std::vector<FF> elements(ELEMENTS_PER_ROUND);
+    for (auto& element : elements) {
+        element = FF::random_element();
+    }
+    for (auto _ : state) {
+        proof_system::honk::BaseTranscript<FF, Hash> transcript;
+        for (size_t round = 0; round < num_rounds; ++round) {
+            for (size_t i = 0; i < ELEMENTS_PER_ROUND; ++i) {
+                transcript.send_to_verifier("element", elements[i]);
+            }
+            DoNotOptimize(transcript.get_challenge("challenge"));
+        }
+    }
+}
+
+/**
+ * @brief Prover side of a single round that sends many field elements at once, like a round of commitments, and draws
+ * one challenge
+ */
+template <typename Hash> void transcript_large_round(State& state) noexcept
+{
+    const auto num_elements = static_cast<size_t>(state.range(0));
+    std::vector<FF> elements(num_elements);
+    for (auto& element : elements) {
+        element = FF::random_element();
+    }
+    for (auto _ : state) {
+        proof_system::honk::BaseTranscript<FF, Hash> transcript;
+        for (const auto& element : elements) {
+            transcript.send_to_verifier("element", element);
+        }
+        DoNotOptimize(transcript.get_challenge("challenge"));
+    }
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(transcript_rounds, proof_system::honk::PedersenBlake3sHash)->Unit(kMillisecond)->Arg(20);
+BENCHMARK_TEMPLATE(transcript_rounds, proof_system::honk::Poseidon2Hash)->Unit(kMillisecond)->Arg(20);
+BENCHMARK_TEMPLATE(transcript_rounds, proof_system::honk::Blake3sTreeHash)->Unit(kMillisecond)->Arg(20);
+
+BENCHMARK_TEMPLATE(transcript_large_round, proof_system::honk::PedersenBlake3sHash)
+    ->Unit(kMicrosecond)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Arg(16384);
+BENCHMARK_TEMPLATE(transcript_large_round, proof_system::honk::Poseidon2Hash)
+    ->Unit(kMicrosecond)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Arg(16384);
+BENCHMARK_TEMPLATE(transcript_large_round, proof_system::honk::Blake3sTreeHash)
+    ->Unit(kMicrosecond)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Arg(16384);
+
+BENCHMARK_MAIN();
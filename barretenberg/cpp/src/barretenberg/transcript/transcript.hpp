@@ -1,8 +1,12 @@
 #pragma once
 
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/blake3s/blake3s.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+
+#include <algorithm>
 
 namespace proof_system::honk {
 
@@ -47,13 +51,103 @@ class TranscriptManifest {
     bool operator==(const TranscriptManifest& other) const = default;
 };
 
+/**
+ * @brief Challenge hash that pre-hashes the round data with Pedersen and derives the challenge bytes with Blake3s
+ */
+struct PedersenBlake3sHash {
+    static std::array<uint8_t, 32> hash(const std::vector<uint8_t>& buffer)
+    {
+        // Pre-hash the full buffer to minimize the amount of data passed to the cryptographic hash function.
+        // Only a collision-resistant hash-function like Pedersen is required for this step.
+        // Note: this pre-hashing is an efficiency trick that may be discareded if using a SNARK-friendly or in contexts
+        // (eg smart contract verification) where the cost of elliptic curve operations is high.
+        std::vector<uint8_t> compressed_buffer = to_buffer(crypto::pedersen_hash::hash_buffer(buffer));
+
+        // Use a strong hash function to derive the new challenge_buffer.
+        auto base_hash = blake3::blake3s(compressed_buffer);
+
+        std::array<uint8_t, 32> result;
+        std::copy_n(base_hash.begin(), result.size(), result.begin());
+        return result;
+    }
+};
+
+/**
+ * @brief Challenge hash that hashes the round data with Poseidon2 alone, which is far cheaper to compute natively and
+ * in a circuit
+ */
+struct Poseidon2Hash {
+    static std::array<uint8_t, 32> hash(const std::vector<uint8_t>& buffer)
+    {
+        using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+        const std::vector<uint8_t> hash_bytes = to_buffer(Poseidon2::hash_buffer(buffer));
+
+        // Challenges are read from the first half of the buffer. Put the low 128 bits of the (big-endian) field element
+        // there, since its high bits are not uniformly distributed.
+        std::array<uint8_t, 32> result;
+        std::copy_n(hash_bytes.begin() + 16, 16, result.begin());
+        std::copy_n(hash_bytes.begin(), 16, result.begin() + 16);
+        return result;
+    }
+};
+
+/**
+ * @brief Challenge hash that pre-hashes the round data with a two-level tree of Blake3s hashes rather than a serial
+ * chain of Pedersen hashes
+ *
+ * @details The buffer is split into chunks of CHUNK_SIZE bytes (the last one possibly shorter) that are hashed
+ * independently, many at a time with the multi-buffer Blake3s and across threads for large rounds. The challenge is
+ * the Blake3s hash of the buffer length followed by the chunk digests; the length fixes how the buffer was chunked.
+ */
+struct Blake3sTreeHash {
+    static constexpr size_t CHUNK_SIZE = 256;
+    // Below this many chunks per thread, starting threads costs more than it saves
+    static constexpr size_t MIN_CHUNKS_PER_THREAD = 64;
+
+    static std::array<uint8_t, 32> hash(const std::vector<uint8_t>& buffer)
+    {
+        constexpr size_t DIGEST_SIZE = blake3::BLAKE3_OUT_LEN;
+        const size_t num_chunks = std::max((buffer.size() + CHUNK_SIZE - 1) / CHUNK_SIZE, size_t(1));
+
+        std::vector<uint8_t> root_buffer = to_buffer(static_cast<uint64_t>(buffer.size()));
+        const size_t digests_offset = root_buffer.size();
+        root_buffer.resize(digests_offset + num_chunks * DIGEST_SIZE);
+
+        const size_t num_threads = std::clamp(num_chunks / MIN_CHUNKS_PER_THREAD, size_t(1), get_num_cpus());
+        const size_t chunks_per_thread = (num_chunks + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * chunks_per_thread, num_chunks);
+            const size_t end = std::min(start + chunks_per_thread, num_chunks);
+            std::vector<std::vector<uint8_t>> chunks(end - start);
+            for (size_t i = start; i < end; ++i) {
+                const auto chunk_begin = static_cast<std::ptrdiff_t>(std::min(i * CHUNK_SIZE, buffer.size()));
+                const auto chunk_end = static_cast<std::ptrdiff_t>(std::min((i + 1) * CHUNK_SIZE, buffer.size()));
+                chunks[i - start].assign(buffer.begin() + chunk_begin, buffer.begin() + chunk_end);
+            }
+            const auto digests = blake3::blake3s_many(chunks);
+            for (size_t i = start; i < end; ++i) {
+                std::copy(digests[i - start].begin(),
+                          digests[i - start].end(),
+                          root_buffer.begin() + static_cast<std::ptrdiff_t>(digests_offset + i * DIGEST_SIZE));
+            }
+        });
+
+        auto base_hash = blake3::blake3s(root_buffer);
+        std::array<uint8_t, 32> result;
+        std::copy_n(base_hash.begin(), result.size(), result.begin());
+        return result;
+    }
+};
+
 /**
  * @brief Common transcript class for both parties. Stores the data for the current round, as well as the
  * manifest.
  *
  * @tparam FF Field from which we sample challenges.
+ * @tparam Hash Hash function from which challenges are derived, see PedersenBlake3sHash, Poseidon2Hash and
+ * Blake3sTreeHash. Prover and verifier must agree on it.
  */
-template <typename FF> class BaseTranscript {
+template <typename FF, typename Hash = PedersenBlake3sHash> class BaseTranscript {
   public:
     BaseTranscript() = default;
 
@@ -99,30 +193,25 @@ template <typename FF> class BaseTranscript {
         // TODO(Adrian): Do we want to use a domain separator as the initial challenge buffer?
         // We could be cheeky and use the hash of the manifest as domain separator, which would prevent us from having
         // to domain separate all the data. (See https://safe-hash.dev)
-        std::vector<uint8_t> full_buffer;
+        // Note: the buffer is sized up front rather than grown with insert(), which GCC misreads as an overflow once
+        // this function is inlined into its callers (-Wstringop-overflow)
+        const size_t previous_challenge_size = is_first_challenge ? 0 : previous_challenge_buffer.size();
+        std::vector<uint8_t> full_buffer(previous_challenge_size + current_round_data.size());
         if (!is_first_challenge) {
             // if not the first challenge, we can use the previous_challenge_buffer
-            full_buffer.insert(full_buffer.end(), previous_challenge_buffer.begin(), previous_challenge_buffer.end());
+            std::copy(previous_challenge_buffer.begin(), previous_challenge_buffer.end(), full_buffer.begin());
         } else {
             // Update is_first_challenge for the future
             is_first_challenge = false;
         }
         if (!current_round_data.empty()) {
-            full_buffer.insert(full_buffer.end(), current_round_data.begin(), current_round_data.end());
+            std::copy(current_round_data.begin(),
+                      current_round_data.end(),
+                      full_buffer.begin() + static_cast<std::ptrdiff_t>(previous_challenge_size));
             current_round_data.clear(); // clear the round data buffer since it has been used
         }
 
-        // Pre-hash the full buffer to minimize the amount of data passed to the cryptographic hash function.
-        // Only a collision-resistant hash-function like Pedersen is required for this step.
-        // Note: this pre-hashing is an efficiency trick that may be discareded if using a SNARK-friendly or in contexts
-        // (eg smart contract verification) where the cost of elliptic curve operations is high.
-        std::vector<uint8_t> compressed_buffer = to_buffer(crypto::pedersen_hash::hash_buffer(full_buffer));
-
-        // Use a strong hash function to derive the new challenge_buffer.
-        auto base_hash = blake3::blake3s(compressed_buffer);
-
-        std::array<uint8_t, HASH_OUTPUT_SIZE> new_challenge_buffer;
-        std::copy_n(base_hash.begin(), HASH_OUTPUT_SIZE, new_challenge_buffer.begin());
+        std::array<uint8_t, HASH_OUTPUT_SIZE> new_challenge_buffer = Hash::hash(full_buffer);
         // update previous challenge buffer for next time we call this function
         previous_challenge_buffer = new_challenge_buffer;
         return new_challenge_buffer;
@@ -245,7 +334,7 @@ template <typename FF> class BaseTranscript {
         auto element_bytes = to_buffer(element);
         proof_data.insert(proof_data.end(), element_bytes.begin(), element_bytes.end());
 
-        BaseTranscript<FF>::consume_prover_element_bytes(label, element_bytes);
+        BaseTranscript::consume_prover_element_bytes(label, element_bytes);
     }
 
     /**
@@ -262,7 +351,7 @@ template <typename FF> class BaseTranscript {
         auto element_bytes = std::span{ proof_data }.subspan(num_bytes_read, element_size);
         num_bytes_read += element_size;
 
-        BaseTranscript<FF>::consume_prover_element_bytes(label, element_bytes);
+        BaseTranscript::consume_prover_element_bytes(label, element_bytes);
 
         T element = from_buffer<T>(element_bytes);
 
@@ -275,9 +364,9 @@ template <typename FF> class BaseTranscript {
      *
      * @return BaseTranscript
      */
-    static BaseTranscript<FF> prover_init_empty()
+    static BaseTranscript prover_init_empty()
     {
-        BaseTranscript<FF> transcript;
+        BaseTranscript transcript;
         constexpr uint32_t init{ 42 }; // arbitrary
         transcript.send_to_verifier("Init", init);
         return transcript;
@@ -290,9 +379,9 @@ template <typename FF> class BaseTranscript {
      * @param transcript
      * @return BaseTranscript
      */
-    static BaseTranscript<FF> verifier_init_empty(const BaseTranscript<FF>& transcript)
+    static BaseTranscript verifier_init_empty(const BaseTranscript& transcript)
     {
-        BaseTranscript<FF> verifier_transcript{ transcript.proof_data };
+        BaseTranscript verifier_transcript{ transcript.proof_data };
         [[maybe_unused]] auto _ = verifier_transcript.template receive_from_prover<uint32_t>("Init");
         return verifier_transcript;
     };
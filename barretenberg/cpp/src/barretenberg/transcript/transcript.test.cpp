@@ -15,4 +15,67 @@ TEST(BaseTranscript, Basic)
     auto received = transcript.template receive_from_prover<FF>("something");
     EXPECT_EQ(received, elt);
 }
+
+TEST(BaseTranscript, Poseidon2ChallengesAgree)
+{
+    using Poseidon2Transcript = proof_system::honk::BaseTranscript<FF, proof_system::honk::Poseidon2Hash>;
+
+    Poseidon2Transcript prover_transcript;
+    Transcript default_transcript;
+    std::vector<FF> elements;
+    for (size_t i = 0; i < 5; ++i) {
+        elements.emplace_back(FF::random_element());
+        prover_transcript.send_to_verifier("element_" + std::to_string(i), elements.back());
+        default_transcript.send_to_verifier("element_" + std::to_string(i), elements.back());
+    }
+    auto prover_challenges = prover_transcript.get_challenges("alpha", "beta");
+
+    Poseidon2Transcript verifier_transcript(prover_transcript.proof_data);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        EXPECT_EQ(verifier_transcript.receive_from_prover<FF>("element_" + std::to_string(i)), elements[i]);
+    }
+    auto verifier_challenges = verifier_transcript.get_challenges("alpha", "beta");
+
+    EXPECT_EQ(prover_challenges, verifier_challenges);
+    EXPECT_NE(prover_challenges[0], prover_challenges[1]);
+    EXPECT_NE(prover_challenges[0], default_transcript.get_challenge("alpha"));
+    EXPECT_EQ(prover_transcript.get_manifest(), verifier_transcript.get_manifest());
+}
+
+TEST(BaseTranscript, Blake3sTreeChallengesAgree)
+{
+    using Blake3sTreeHash = proof_system::honk::Blake3sTreeHash;
+    using Blake3sTreeTranscript = proof_system::honk::BaseTranscript<FF, Blake3sTreeHash>;
+
+    // enough data in the first round to be hashed as many chunks on at least two threads, and a short second round
+    constexpr size_t multi_thread_size = 2 * Blake3sTreeHash::MIN_CHUNKS_PER_THREAD * Blake3sTreeHash::CHUNK_SIZE;
+    constexpr size_t num_elements = multi_thread_size / sizeof(FF) + 1;
+    Blake3sTreeTranscript prover_transcript;
+    std::vector<FF> elements;
+    for (size_t i = 0; i < num_elements; ++i) {
+        elements.emplace_back(FF::random_element());
+        prover_transcript.send_to_verifier("element_" + std::to_string(i), elements[i]);
+    }
+    auto prover_alpha = prover_transcript.get_challenge("alpha");
+    prover_transcript.send_to_verifier("last", elements[0]);
+    auto prover_beta = prover_transcript.get_challenge("beta");
+
+    Blake3sTreeTranscript verifier_transcript(prover_transcript.proof_data);
+    for (size_t i = 0; i < num_elements; ++i) {
+        EXPECT_EQ(verifier_transcript.receive_from_prover<FF>("element_" + std::to_string(i)), elements[i]);
+    }
+    EXPECT_EQ(verifier_transcript.get_challenge("alpha"), prover_alpha);
+    EXPECT_EQ(verifier_transcript.receive_from_prover<FF>("last"), elements[0]);
+    EXPECT_EQ(verifier_transcript.get_challenge("beta"), prover_beta);
+    EXPECT_EQ(prover_transcript.get_manifest(), verifier_transcript.get_manifest());
+
+    // the challenge depends on every chunk and on where the buffer ends
+    std::vector<uint8_t> buffer(multi_thread_size + 100, 7);
+    const auto challenge = Blake3sTreeHash::hash(buffer);
+    buffer[multi_thread_size - 1] ^= 1;
+    EXPECT_NE(Blake3sTreeHash::hash(buffer), challenge);
+    buffer[multi_thread_size - 1] ^= 1;
+    buffer.push_back(0);
+    EXPECT_NE(Blake3sTreeHash::hash(buffer), challenge);
+}
 } // namespace barretenberg::honk_transcript_tests
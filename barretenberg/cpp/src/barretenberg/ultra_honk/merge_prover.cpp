@@ -92,14 +92,17 @@ template <typename Flavor> plonk::proof& MergeProver_<Flavor>::construct_proof()
     auto alpha = transcript.get_challenge("alpha");
 
     // Constuct batched polynomial to opened via KZG
-    auto batched_polynomial = Polynomial(N);
+    std::vector<std::span<const FF>> batched_polynomials;
+    std::vector<FF> batching_scalars;
     auto batched_eval = FF(0);
     auto alpha_pow = FF(1);
     for (auto& claim : opening_claims) {
-        batched_polynomial.add_scaled(claim.polynomial, alpha_pow);
+        batched_polynomials.emplace_back(claim.polynomial);
+        batching_scalars.emplace_back(alpha_pow);
         batched_eval += alpha_pow * claim.opening_pair.evaluation;
         alpha_pow *= alpha;
     }
+    auto batched_polynomial = Polynomial::linear_combination(batched_polynomials, batching_scalars, N);
 
     // Construct and commit to KZG quotient polynomial q = (f - v) / (X - kappa)
     auto quotient = batched_polynomial;
@@ -1,3 +1,5 @@
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/flavor/goblin_translator.hpp"
 #include "barretenberg/honk/proof_system/permutation_library.hpp"
 #include "barretenberg/proof_system/library/grand_product_library.hpp"
@@ -7,6 +9,8 @@
 #include "barretenberg/relations/gen_perm_sort_relation.hpp"
 #include "barretenberg/relations/lookup_relation.hpp"
 #include "barretenberg/relations/permutation_relation.hpp"
+#include "barretenberg/relations/poseidon2_external_relation.hpp"
+#include "barretenberg/relations/poseidon2_internal_relation.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/ultra_arithmetic_relation.hpp"
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
@@ -235,6 +239,43 @@ template <typename Flavor> void create_some_ecc_op_queue_gates(auto& circuit_bui
     }
 }
 
+template <typename Flavor> void create_some_poseidon2_gates(auto& circuit_builder)
+{
+    using FF = typename Flavor::FF;
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    static_assert(proof_system::IsGoblinFlavor<Flavor>);
+
+    // Apply the first two external rounds and the first two internal rounds to a random state. Each round reads its
+    // output from the next row, so the last round is followed by a row holding the output state.
+    Permutation::State state{ FF::random_element(), FF::random_element(), FF::random_element(), FF::random_element() };
+    std::array<uint32_t, 4> state_indices;
+    const auto add_state_variables = [&]() {
+        for (size_t i = 0; i < 4; ++i) {
+            state_indices[i] = circuit_builder.add_variable(state[i]);
+        }
+    };
+    add_state_variables();
+    for (size_t round_idx = 0; round_idx < 2; ++round_idx) {
+        circuit_builder.create_poseidon2_external_gate(
+            { state_indices[0], state_indices[1], state_indices[2], state_indices[3], round_idx });
+        Permutation::add_round_constants(state, Permutation::round_constants[round_idx]);
+        Permutation::apply_sbox(state);
+        Permutation::matrix_multiplication_external(state);
+        add_state_variables();
+    }
+    const size_t first_internal_round = Permutation::rounds_f / 2;
+    for (size_t round_idx = first_internal_round; round_idx < first_internal_round + 2; ++round_idx) {
+        circuit_builder.create_poseidon2_internal_gate(
+            { state_indices[0], state_indices[1], state_indices[2], state_indices[3], round_idx });
+        state[0] += Permutation::round_constants[round_idx][0];
+        Permutation::apply_single_sbox(state[0]);
+        Permutation::matrix_multiplication_internal(state);
+        add_state_variables();
+    }
+    circuit_builder.create_dummy_constraints(
+        { state_indices[0], state_indices[1], state_indices[2], state_indices[3] });
+}
+
 class RelationCorrectnessTests : public ::testing::Test {
   protected:
     static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
@@ -319,6 +360,7 @@ TEST_F(RelationCorrectnessTests, GoblinUltraRelationCorrectness)
     create_some_elliptic_curve_addition_gates<Flavor>(builder);
     create_some_RAM_gates<Flavor>(builder);
     create_some_ecc_op_queue_gates<Flavor>(builder); // Goblin!
+    create_some_poseidon2_gates<Flavor>(builder);
 
     // Create a prover (it will compute proving key and witness)
     auto composer = GoblinUltraComposer();
@@ -343,6 +385,8 @@ TEST_F(RelationCorrectnessTests, GoblinUltraRelationCorrectness)
     ensure_non_zero(proving_key->q_elliptic);
     ensure_non_zero(proving_key->q_aux);
     ensure_non_zero(proving_key->q_busread);
+    ensure_non_zero(proving_key->q_poseidon2_external);
+    ensure_non_zero(proving_key->q_poseidon2_internal);
 
     ensure_non_zero(proving_key->calldata);
     ensure_non_zero(proving_key->calldata_read_counts);
@@ -363,6 +407,8 @@ TEST_F(RelationCorrectnessTests, GoblinUltraRelationCorrectness)
     check_relation<Flavor, std::tuple_element_t<6, Relations>>(circuit_size, prover_polynomials, params);
     check_linearly_dependent_relation<Flavor, std::tuple_element_t<7, Relations>>(
         circuit_size, prover_polynomials, params);
+    check_relation<Flavor, std::tuple_element_t<8, Relations>>(circuit_size, prover_polynomials, params);
+    check_relation<Flavor, std::tuple_element_t<9, Relations>>(circuit_size, prover_polynomials, params);
 }
 
 /**
@@ -60,6 +60,30 @@ class UltraHonkComposerTests : public ::testing::Test {
     static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
 };
 
+/**
+ * @brief The prover records the memory used by each of its rounds
+ */
+TEST_F(UltraHonkComposerTests, MemoryReport)
+{
+    auto circuit_builder = proof_system::UltraCircuitBuilder();
+    auto indices = add_variables(circuit_builder, { 1, 2, 3, 4, 5, 6, 7, 8 });
+    for (size_t i = 0; i < indices.size(); i++) {
+        circuit_builder.create_new_range_constraint(indices[i], 8);
+    }
+    circuit_builder.create_sort_constraint(indices);
+
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(circuit_builder);
+    auto prover = composer.create_prover(instance);
+    auto verifier = composer.create_verifier(instance);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    ASSERT_EQ(prover.memory_report.phases.size(), 7UL);
+    EXPECT_EQ(prover.memory_report.phases[2].phase, "sorted_list_accumulator");
+    EXPECT_GT(prover.memory_report.get_peak_bytes(), 0UL);
+}
+
 /**
  * @brief A quick test to ensure that none of our polynomials are identically zero
  *
@@ -157,28 +157,44 @@ template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::export_proof()
 
 template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::construct_proof()
 {
+    memory_report.clear();
+
     // Add circuit size public input size and public inputs to transcript.
+    memory_report.start_phase();
     execute_preamble_round();
+    memory_report.end_phase("preamble");
 
     // Compute first three wire commitments
+    memory_report.start_phase();
     execute_wire_commitments_round();
+    memory_report.end_phase("wire_commitments");
 
     // Compute sorted list accumulator and commitment
+    memory_report.start_phase();
     execute_sorted_list_accumulator_round();
+    memory_report.end_phase("sorted_list_accumulator");
 
     // Fiat-Shamir: beta & gamma
+    memory_report.start_phase();
     execute_log_derivative_inverse_round();
+    memory_report.end_phase("log_derivative_inverse");
 
     // Compute grand product(s) and commitments.
+    memory_report.start_phase();
     execute_grand_product_computation_round();
+    memory_report.end_phase("grand_product_computation");
 
     // Fiat-Shamir: alpha
     // Run sumcheck subprotocol.
+    memory_report.start_phase();
     execute_relation_check_rounds();
+    memory_report.end_phase("relation_check");
 
     // Fiat-Shamir: rho, y, x, z
     // Execute Zeromorph multilinear PCS
+    memory_report.start_phase();
     execute_zeromorph_rounds();
+    memory_report.end_phase("zeromorph");
 
     return export_proof();
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/common/memory_report.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
@@ -54,6 +55,9 @@ template <UltraFlavor Flavor> class UltraProver_ {
 
     using ZeroMorph = pcs::zeromorph::ZeroMorphProver_<Curve>;
 
+    // The peak and live memory of each round of the last call to construct_proof
+    barretenberg::MemoryReport memory_report;
+
   private:
     plonk::proof proof;
 };
@@ -62,5 +66,6 @@ extern template class UltraProver_<honk::flavor::Ultra>;
 extern template class UltraProver_<honk::flavor::GoblinUltra>;
 
 using UltraProver = UltraProver_<honk::flavor::Ultra>;
+using GoblinUltraProver = UltraProver_<honk::flavor::GoblinUltra>;
 
 } // namespace proof_system::honk